@@ -23,6 +23,9 @@ class Gmpy2Build(build_ext):
          "Windows and MSVC"),
         ('static', None, "Enable static linking compile time options."),
         ('gdb', None, "Build with debug symbols."),
+        ('contextvars', None, "Store the current context in a contextvars."
+         "ContextVar instead of the thread state (Python 3.7+)"),
+        ('nointern', None, "Do not preallocate and share small mpz values"),
     ]
 
     def initialize_options(self):
@@ -33,6 +36,8 @@ class Gmpy2Build(build_ext):
         self.mpir = False
         self.static = False
         self.gdb = False
+        self.contextvars = False
+        self.nointern = False
 
     def finalize_options(self):
         build_ext.finalize_options(self)
@@ -53,6 +58,11 @@ class Gmpy2Build(build_ext):
             _comp_args.append('DSTATIC=1')
         if self.gdb:
             _comp_args.append('ggdb')
+        if self.contextvars:
+            _comp_args.append('DCONTEXTVARS=1')
+        if self.nointern:
+            _comp_args.append('DMPZ_INTERN_MIN=0')
+            _comp_args.append('DMPZ_INTERN_MAX=-1')
 
     def build_extensions(self):
         compiler = self.compiler.compiler_type
@@ -357,6 +357,32 @@
  *      directly.
  *   Convert `mpz` to a type using __new__ instead of a factory
  *      function.
+ *   Cache powers of the base when converting very large integers
+ *      to or from strings.
+ *   Add parse_many() for bulk conversion of strings and buffers.
+ *   Add pack_many(), unpack_many(), dump_many(), and load_many() for
+ *      storing sequences of values in a single indexed record stream.
+ *   Add mpz_array for on-demand access to memory-mapped record streams.
+ *   Support out-of-band buffers for large values with pickle protocol 5.
+ *   Add mutable xmpfr type with in-place arithmetic and fma_inplace().
+ *   Add mutable xmpq type with optional deferred canonicalization.
+ *   Add mutable xmpc type with in-place arithmetic and fma_inplace().
+ *   Add build option to store the context in a contextvars.ContextVar.
+ *   Add precision= and round= keywords to math functions and add/sub/mul/div.
+ *   Add context.track_flags to skip exception flag bookkeeping.
+ *   Add fdot() and polyval().
+ *   Add fsum_accumulator for exact streaming summation.
+ *   Add isum() and qsum().
+ *   Move the probable prime tests to a C core exported by the C-API.
+ *   Calculate Lucas sequences modulo small odd n in Montgomery form.
+ *   Use a deterministic word sized primality test for n < 2**64.
+ *   Add threads keyword to is_prime() and new strong_prp_bases().
+ *   Add mpz_urandomb_many(), mpfr_random_many(), mpfr_grandom_many().
+ *   Add Philox random_state with jumped() and spawn().
+ *   Faster hash() for mpq without temporary mpz values.
+ *   Faster hash() for mpfr and mpc values with trailing zero limbs.
+ *   Faster mpz arithmetic and comparison with small Python integers.
+ *   Reintroduced interning of small mpz values.
  *
  *
  ************************************************************************
@@ -394,6 +420,9 @@
  */
 #define PY_SSIZE_T_CLEAN
 #include "Python.h"
+#ifndef WITHOUT_THREADS
+#include "pythread.h"
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -453,7 +482,14 @@ static struct gmpy_global global;
 
 /* Support for context manager. */
 
-#ifdef WITHOUT_THREADS
+#if defined(CONTEXTVARS)
+/* Context variable holding the current context */
+static PyObject *current_context_var = NULL;
+/* Invariant: NULL or a new reference to the most recently accessed context */
+static CTXT_Object *cached_context = NULL;
+/* Value of tstate->context_ver when cached_context was accessed */
+static uint64_t cached_context_ver = 0;
+#elif defined(WITHOUT_THREADS)
 /* Use a module-level context. */
 static CTXT_Object *module_context = NULL;
 #else
@@ -492,6 +528,7 @@ static PyObject *GMPyExc_Erange = NULL;
 /* Support for conversion to/from binary representation. */
 
 #include "gmpy2_binary.c"
+#include "gmpy2_mpz_array.c"
 
 /* Support for conversions to/from numeric types. */
 
@@ -500,6 +537,8 @@ static PyObject *GMPyExc_Erange = NULL;
 #include "gmpy2_convert_gmp.c"
 #include "gmpy2_convert_mpfr.c"
 #include "gmpy2_convert_mpc.c"
+#include "gmpy2_mpz_str.c"
+#include "gmpy2_parse.c"
 
 /* Support for random numbers. */
 
@@ -507,6 +546,7 @@ static PyObject *GMPyExc_Erange = NULL;
 
 /* Support for Lucas sequences. */
 
+#include "gmpy_mpz_mont.c"
 #include "gmpy_mpz_lucas.c"
 
 /* Support for probable-prime tests. */
@@ -523,6 +563,9 @@ static PyObject *GMPyExc_Erange = NULL;
 #include "gmpy2_mpz_bitops.c"
 #include "gmpy2_mpz_inplace.c"
 #include "gmpy2_xmpz_inplace.c"
+#include "gmpy2_xmpq_inplace.c"
+#include "gmpy2_xmpfr_inplace.c"
+#include "gmpy2_xmpc_inplace.c"
 
 /* Begin includes of refactored code. */
 
@@ -538,6 +581,7 @@ static PyObject *GMPyExc_Erange = NULL;
 #include "gmpy2_sub.c"
 #include "gmpy2_truediv.c"
 #include "gmpy2_math.c"
+#include "gmpy2_fsum_accumulator.c"
 #include "gmpy2_const.c"
 #include "gmpy2_square.c"
 #include "gmpy2_format.c"
@@ -562,15 +606,18 @@ static PyObject *GMPyExc_Erange = NULL;
 #include "gmpy2_mpz.c"
 #include "gmpy2_xmpz.c"
 #include "gmpy2_mpq.c"
+#include "gmpy2_xmpq.c"
 #include "gmpy2_mpfr.c"
+#include "gmpy2_xmpfr.c"
 #include "gmpy2_mpc.c"
+#include "gmpy2_xmpc.c"
 
 #include "gmpy2_context.c"
 
 static PyMethodDef Pygmpy_methods [] =
 {
     { "_printf", GMPy_printf, METH_VARARGS, GMPy_doc_function_printf },
-    { "add", GMPy_Context_Add, METH_VARARGS, GMPy_doc_function_add },
+    { "add", (PyCFunction)GMPy_Context_Add, GMPY_METH_KWARGS, GMPy_doc_function_add },
     { "bit_clear", GMPy_MPZ_bit_clear_function, METH_VARARGS, doc_bit_clear_function },
     { "bit_flip", GMPy_MPZ_bit_flip_function, METH_VARARGS, doc_bit_flip_function },
     { "bit_length", GMPy_MPZ_bit_length_function, METH_O, doc_bit_length_function },
@@ -589,10 +636,11 @@ static PyMethodDef Pygmpy_methods [] =
     { "c_mod_2exp", GMPy_MPZ_c_mod_2exp, METH_VARARGS, doc_c_mod_2exp },
     { "denom", GMPy_MPQ_Function_Denom, METH_O, GMPy_doc_mpq_function_denom },
     { "digits", GMPy_Context_Digits, METH_VARARGS, GMPy_doc_context_digits },
-    { "div", GMPy_Context_TrueDiv, METH_VARARGS, GMPy_doc_truediv },
+    { "div", (PyCFunction)GMPy_Context_TrueDiv, GMPY_METH_KWARGS, GMPy_doc_truediv },
     { "divexact", GMPy_MPZ_Function_Divexact, METH_VARARGS, GMPy_doc_mpz_function_divexact },
     { "divm", GMPy_MPZ_Function_Divm, METH_VARARGS, GMPy_doc_mpz_function_divm },
     { "double_fac", GMPy_MPZ_Function_DoubleFac, METH_O, GMPy_doc_mpz_function_double_fac },
+    { "dump_many", GMPy_MPANY_Dump_Many, METH_VARARGS, doc_dump_many },
     { "fac", GMPy_MPZ_Function_Fac, METH_O, GMPy_doc_mpz_function_fac },
     { "fib", GMPy_MPZ_Function_Fib, METH_O, GMPy_doc_mpz_function_fib },
     { "fib2", GMPy_MPZ_Function_Fib2, METH_O, GMPy_doc_mpz_function_fib2 },
@@ -613,6 +661,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "iroot_rem", GMPy_MPZ_Function_IrootRem, METH_VARARGS, GMPy_doc_mpz_function_iroot_rem },
     { "isqrt", GMPy_MPZ_Function_Isqrt, METH_O, GMPy_doc_mpz_function_isqrt },
     { "isqrt_rem", GMPy_MPZ_Function_IsqrtRem, METH_O, GMPy_doc_mpz_function_isqrt_rem },
+    { "isum", GMPy_MPZ_Function_Isum, METH_O, GMPy_doc_mpz_function_isum },
     { "is_bpsw_prp", GMPY_mpz_is_bpsw_prp, METH_VARARGS, doc_mpz_is_bpsw_prp },
     { "is_congruent", GMPy_MPZ_Function_IsCongruent, METH_VARARGS, GMPy_doc_mpz_function_is_congruent },
     { "is_divisible", GMPy_MPZ_Function_IsDivisible, METH_VARARGS, GMPy_doc_mpz_function_is_divisible },
@@ -624,7 +673,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "is_lucas_prp", GMPY_mpz_is_lucas_prp, METH_VARARGS, doc_mpz_is_lucas_prp },
     { "is_odd", GMPy_MPZ_Function_IsOdd, METH_O, GMPy_doc_mpz_function_is_odd },
     { "is_power", GMPy_MPZ_Function_IsPower, METH_O, GMPy_doc_mpz_function_is_power },
-    { "is_prime", GMPy_MPZ_Function_IsPrime, METH_VARARGS, GMPy_doc_mpz_function_is_prime },
+    { "is_prime", (PyCFunction)GMPy_MPZ_Function_IsPrime, METH_VARARGS | METH_KEYWORDS, GMPy_doc_mpz_function_is_prime },
     { "is_selfridge_prp", GMPY_mpz_is_selfridge_prp, METH_VARARGS, doc_mpz_is_selfridge_prp },
     { "is_square", GMPy_MPZ_Function_IsSquare, METH_O, GMPy_doc_mpz_function_is_square },
     { "is_strong_prp", GMPY_mpz_is_strong_prp, METH_VARARGS, doc_mpz_is_strong_prp },
@@ -642,6 +691,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "lucasv", GMPY_mpz_lucasv, METH_VARARGS, doc_mpz_lucasv },
     { "lucasv_mod", GMPY_mpz_lucasv_mod, METH_VARARGS, doc_mpz_lucasv_mod },
     { "lucas2", GMPy_MPZ_Function_Lucas2, METH_O, GMPy_doc_mpz_function_lucas2 },
+    { "load_many", (PyCFunction)GMPy_MPANY_Load_Many, METH_VARARGS | METH_KEYWORDS, doc_load_many },
     { "mod", GMPy_Context_Mod, METH_VARARGS, GMPy_doc_mod },
     { "mp_version", GMPy_get_mp_version, METH_NOARGS, GMPy_doc_mp_version },
     { "mp_limbsize", GMPy_get_mp_limbsize, METH_NOARGS, GMPy_doc_mp_limbsize },
@@ -652,22 +702,27 @@ static PyMethodDef Pygmpy_methods [] =
     { "mpz_random", GMPy_MPZ_random_Function, METH_VARARGS, GMPy_doc_mpz_random_function },
     { "mpz_rrandomb", GMPy_MPZ_rrandomb_Function, METH_VARARGS, GMPy_doc_mpz_rrandomb_function },
     { "mpz_urandomb", GMPy_MPZ_urandomb_Function, METH_VARARGS, GMPy_doc_mpz_urandomb_function },
-    { "mul", GMPy_Context_Mul, METH_VARARGS, GMPy_doc_function_mul },
+    { "mpz_urandomb_many", (PyCFunction)GMPy_MPZ_urandomb_many_Function, METH_VARARGS | METH_KEYWORDS, GMPy_doc_mpz_urandomb_many_function },
+    { "mul", (PyCFunction)GMPy_Context_Mul, GMPY_METH_KWARGS, GMPy_doc_function_mul },
     { "multi_fac", GMPy_MPZ_Function_MultiFac, METH_VARARGS, GMPy_doc_mpz_function_multi_fac },
     { "next_prime", GMPy_MPZ_Function_NextPrime, METH_O, GMPy_doc_mpz_function_next_prime },
     { "numer", GMPy_MPQ_Function_Numer, METH_O, GMPy_doc_mpq_function_numer },
     { "num_digits", GMPy_MPZ_Function_NumDigits, METH_VARARGS, GMPy_doc_mpz_function_num_digits },
     { "pack", GMPy_MPZ_pack, METH_VARARGS, doc_pack },
+    { "pack_many", GMPy_MPANY_Pack_Many, METH_O, doc_pack_many },
+    { "parse_many", (PyCFunction)GMPy_Function_ParseMany, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_parse_many },
     { "popcount", GMPy_MPZ_popcount, METH_O, doc_popcount },
     { "powmod", GMPy_Integer_PowMod, METH_VARARGS, GMPy_doc_integer_powmod },
     { "primorial", GMPy_MPZ_Function_Primorial, METH_O, GMPy_doc_mpz_function_primorial },
     { "qdiv", GMPy_MPQ_Function_Qdiv, METH_VARARGS, GMPy_doc_function_qdiv },
+    { "qsum", GMPy_MPQ_Function_Qsum, METH_O, GMPy_doc_mpq_function_qsum },
     { "remove", GMPy_MPZ_Function_Remove, METH_VARARGS, GMPy_doc_mpz_function_remove },
-    { "random_state", GMPy_RandomState_Factory, METH_VARARGS, GMPy_doc_random_state_factory },
+    { "random_state", (PyCFunction)GMPy_RandomState_Factory, METH_VARARGS | METH_KEYWORDS, GMPy_doc_random_state_factory },
     { "set_cache", GMPy_set_cache, METH_VARARGS, GMPy_doc_set_cache },
     { "sign", GMPy_Context_Sign, METH_O, GMPy_doc_function_sign },
     { "square", GMPy_Context_Square, METH_O, GMPy_doc_function_square },
-    { "sub", GMPy_Context_Sub, METH_VARARGS, GMPy_doc_sub },
+    { "strong_prp_bases", (PyCFunction)GMPY_mpz_strong_prp_bases, METH_VARARGS | METH_KEYWORDS, doc_mpz_strong_prp_bases },
+    { "sub", (PyCFunction)GMPy_Context_Sub, GMPY_METH_KWARGS, GMPy_doc_sub },
     { "to_binary", GMPy_MPANY_To_Binary, METH_O, doc_to_binary },
     { "t_div", GMPy_MPZ_t_div, METH_VARARGS, doc_t_div },
     { "t_div_2exp", GMPy_MPZ_t_div_2exp, METH_VARARGS, doc_t_div_2exp },
@@ -676,19 +731,21 @@ static PyMethodDef Pygmpy_methods [] =
     { "t_mod", GMPy_MPZ_t_mod, METH_VARARGS, doc_t_mod },
     { "t_mod_2exp", GMPy_MPZ_t_mod_2exp, METH_VARARGS, doc_t_mod_2exp },
     { "unpack", GMPy_MPZ_unpack, METH_VARARGS, doc_unpack },
+    { "unpack_many", (PyCFunction)GMPy_MPANY_Unpack_Many, METH_VARARGS | METH_KEYWORDS, doc_unpack_many },
     { "version", GMPy_get_version, METH_NOARGS, GMPy_doc_version },
     { "xbit_mask", GMPy_XMPZ_Function_XbitMask, METH_O, GMPy_doc_xmpz_function_xbit_mask },
+    { "_from_buffer", GMPy_MPANY_From_Buffer, METH_VARARGS, GMPy_doc_function_from_buffer },
     { "_mpmath_normalize", Pympz_mpmath_normalize, METH_VARARGS, doc_mpmath_normalizeg },
     { "_mpmath_create", Pympz_mpmath_create, METH_VARARGS, doc_mpmath_createg },
 
-    { "acos", GMPy_Context_Acos, METH_O, GMPy_doc_function_acos },
-    { "acosh", GMPy_Context_Acosh, METH_O, GMPy_doc_function_acosh },
+    { "acos", (PyCFunction)GMPy_Context_Acos, GMPY_METH_KWARGS, GMPy_doc_function_acos },
+    { "acosh", (PyCFunction)GMPy_Context_Acosh, GMPY_METH_KWARGS, GMPy_doc_function_acosh },
     { "ai", GMPy_Context_Ai, METH_O, GMPy_doc_function_ai },
     { "agm", GMPy_Context_AGM, METH_VARARGS, GMPy_doc_function_agm },
-    { "asin", GMPy_Context_Asin, METH_O, GMPy_doc_function_asin },
-    { "asinh", GMPy_Context_Asinh, METH_O, GMPy_doc_function_asinh },
-    { "atan", GMPy_Context_Atan, METH_O, GMPy_doc_function_atan },
-    { "atanh", GMPy_Context_Atanh, METH_O, GMPy_doc_function_atanh },
+    { "asin", (PyCFunction)GMPy_Context_Asin, GMPY_METH_KWARGS, GMPy_doc_function_asin },
+    { "asinh", (PyCFunction)GMPy_Context_Asinh, GMPY_METH_KWARGS, GMPy_doc_function_asinh },
+    { "atan", (PyCFunction)GMPy_Context_Atan, GMPY_METH_KWARGS, GMPy_doc_function_atan },
+    { "atanh", (PyCFunction)GMPy_Context_Atanh, GMPY_METH_KWARGS, GMPy_doc_function_atanh },
     { "atan2", GMPy_Context_Atan2, METH_VARARGS, GMPy_doc_function_atan2 },
     { "can_round", GMPy_MPFR_Can_Round, METH_VARARGS, GMPy_doc_mpfr_can_round },
     { "cbrt", GMPy_Context_Cbrt, METH_O, GMPy_doc_function_cbrt },
@@ -700,8 +757,8 @@ static PyMethodDef Pygmpy_methods [] =
     { "const_pi", (PyCFunction)GMPy_Function_Const_Pi, METH_VARARGS | METH_KEYWORDS, GMPy_doc_function_const_pi },
     { "context", (PyCFunction)GMPy_CTXT_Context, METH_VARARGS | METH_KEYWORDS, GMPy_doc_context },
     { "copy_sign", GMPy_MPFR_copy_sign, METH_VARARGS, GMPy_doc_mpfr_copy_sign },
-    { "cos", GMPy_Context_Cos, METH_O, GMPy_doc_function_cos },
-    { "cosh", GMPy_Context_Cosh, METH_O, GMPy_doc_function_cosh },
+    { "cos", (PyCFunction)GMPy_Context_Cos, GMPY_METH_KWARGS, GMPy_doc_function_cos },
+    { "cosh", (PyCFunction)GMPy_Context_Cosh, GMPY_METH_KWARGS, GMPy_doc_function_cosh },
     { "cot", GMPy_Context_Cot, METH_O, GMPy_doc_function_cot },
     { "coth", GMPy_Context_Coth, METH_O, GMPy_doc_function_coth },
     { "csc", GMPy_Context_Csc, METH_O, GMPy_doc_function_csc },
@@ -712,12 +769,13 @@ static PyMethodDef Pygmpy_methods [] =
     { "eint", GMPy_Context_Eint, METH_O, GMPy_doc_function_eint },
     { "erf", GMPy_Context_Erf, METH_O, GMPy_doc_function_erf },
     { "erfc", GMPy_Context_Erfc, METH_O, GMPy_doc_function_erfc },
-    { "exp", GMPy_Context_Exp, METH_O, GMPy_doc_function_exp },
+    { "exp", (PyCFunction)GMPy_Context_Exp, GMPY_METH_KWARGS, GMPy_doc_function_exp },
     { "expm1", GMPy_Context_Expm1, METH_O, GMPy_doc_function_expm1 },
     { "exp10", GMPy_Context_Exp10, METH_O, GMPy_doc_function_exp10 },
     { "exp2", GMPy_Context_Exp2, METH_O, GMPy_doc_function_exp2 },
     { "f2q", GMPy_Context_F2Q, METH_VARARGS, GMPy_doc_function_f2q },
     { "factorial", GMPy_Context_Factorial, METH_O, GMPy_doc_function_factorial },
+    { "fdot", GMPy_Context_Fdot, METH_VARARGS, GMPy_doc_function_fdot },
     { "floor", GMPy_Context_Floor, METH_O, GMPy_doc_function_floor },
     { "fma", GMPy_Context_FMA, METH_VARARGS, GMPy_doc_function_fma },
     { "fms", GMPy_Context_FMS, METH_VARARGS, GMPy_doc_function_fms },
@@ -751,9 +809,9 @@ static PyMethodDef Pygmpy_methods [] =
     { "li2", GMPy_Context_Li2, METH_O, GMPy_doc_function_li2 },
     { "lngamma", GMPy_Context_Lngamma, METH_O, GMPy_doc_function_lngamma },
     { "local_context", (PyCFunction)GMPy_CTXT_Local, METH_VARARGS | METH_KEYWORDS, GMPy_doc_local_context },
-    { "log", GMPy_Context_Log, METH_O, GMPy_doc_function_log },
+    { "log", (PyCFunction)GMPy_Context_Log, GMPY_METH_KWARGS, GMPy_doc_function_log },
     { "log1p", GMPy_Context_Log1p, METH_O, GMPy_doc_function_log1p },
-    { "log10", GMPy_Context_Log10, METH_O, GMPy_doc_function_log10 },
+    { "log10", (PyCFunction)GMPy_Context_Log10, GMPY_METH_KWARGS, GMPy_doc_function_log10 },
     { "log2", GMPy_Context_Log2, METH_O, GMPy_doc_function_log2 },
     { "maxnum", GMPy_Context_Maxnum, METH_VARARGS, GMPy_doc_function_maxnum },
     { "minnum", GMPy_Context_Minnum, METH_VARARGS, GMPy_doc_function_minnum },
@@ -761,6 +819,8 @@ static PyMethodDef Pygmpy_methods [] =
     { "mpfr_from_old_binary", GMPy_MPFR_From_Old_Binary, METH_O, doc_mpfr_from_old_binary },
     { "mpfr_random", GMPy_MPFR_random_Function, METH_VARARGS, GMPy_doc_mpfr_random_function },
     { "mpfr_grandom", GMPy_MPFR_grandom_Function, METH_VARARGS, GMPy_doc_mpfr_grandom_function },
+    { "mpfr_random_many", (PyCFunction)GMPy_MPFR_random_many_Function, METH_VARARGS | METH_KEYWORDS, GMPy_doc_mpfr_random_many_function },
+    { "mpfr_grandom_many", (PyCFunction)GMPy_MPFR_grandom_many_Function, METH_VARARGS | METH_KEYWORDS, GMPy_doc_mpfr_grandom_many_function },
     { "mul_2exp", GMPy_Context_Mul_2exp, METH_VARARGS, GMPy_doc_function_mul_2exp },
     { "nan", GMPy_MPFR_set_nan, METH_NOARGS, GMPy_doc_mpfr_set_nan },
     { "next_above", GMPy_Context_NextAbove, METH_O, GMPy_doc_function_next_above },
@@ -784,13 +844,13 @@ static PyMethodDef Pygmpy_methods [] =
     { "set_context", GMPy_CTXT_Set, METH_O, GMPy_doc_set_context },
     { "set_exp", GMPy_MPFR_set_exp, METH_VARARGS, GMPy_doc_mpfr_set_exp },
     { "set_sign", GMPy_MPFR_set_sign, METH_VARARGS, GMPy_doc_mpfr_set_sign },
-    { "sin", GMPy_Context_Sin, METH_O, GMPy_doc_function_sin },
-    { "sin_cos", GMPy_Context_Sin_Cos, METH_O, GMPy_doc_function_sin_cos },
-    { "sinh", GMPy_Context_Sinh, METH_O, GMPy_doc_function_sinh },
+    { "sin", (PyCFunction)GMPy_Context_Sin, GMPY_METH_KWARGS, GMPy_doc_function_sin },
+    { "sin_cos", (PyCFunction)GMPy_Context_Sin_Cos, GMPY_METH_KWARGS, GMPy_doc_function_sin_cos },
+    { "sinh", (PyCFunction)GMPy_Context_Sinh, GMPY_METH_KWARGS, GMPy_doc_function_sinh },
     { "sinh_cosh", GMPy_Context_Sinh_Cosh, METH_O, GMPy_doc_function_sinh_cosh },
-    { "sqrt", GMPy_Context_Sqrt, METH_O, GMPy_doc_function_sqrt },
-    { "tan", GMPy_Context_Tan, METH_O, GMPy_doc_function_tan },
-    { "tanh", GMPy_Context_Tanh, METH_O, GMPy_doc_function_tanh },
+    { "sqrt", (PyCFunction)GMPy_Context_Sqrt, GMPY_METH_KWARGS, GMPy_doc_function_sqrt },
+    { "tan", (PyCFunction)GMPy_Context_Tan, GMPY_METH_KWARGS, GMPy_doc_function_tan },
+    { "tanh", (PyCFunction)GMPy_Context_Tanh, GMPY_METH_KWARGS, GMPy_doc_function_tanh },
     { "trunc", GMPy_Context_Trunc, METH_O, GMPy_doc_function_trunc},
 #ifdef VECTOR
     { "vector", GMPy_Context_Vector, METH_O, GMPy_doc_function_vector},
@@ -805,6 +865,7 @@ static PyMethodDef Pygmpy_methods [] =
     { "mpc_random", GMPy_MPC_random_Function, METH_VARARGS, GMPy_doc_mpc_random_function },
     { "norm", GMPy_Context_Norm, METH_O, GMPy_doc_function_norm },
     { "polar", GMPy_Context_Polar, METH_O, GMPy_doc_function_polar },
+    { "polyval", GMPy_Context_Polyval, METH_VARARGS, GMPy_doc_function_polyval },
     { "phase", GMPy_Context_Phase, METH_O, GMPy_doc_function_phase },
     { "proj", GMPy_Context_Proj, METH_O, GMPy_doc_function_proj },
     { "rect", GMPy_Context_Rect, METH_VARARGS, GMPy_doc_function_rect },
@@ -929,6 +990,11 @@ PyMODINIT_FUNC initgmpy2(void)
         INITERROR;
         /* LCOV_EXCL_STOP */
     }
+    if (PyType_Ready(&XMPQ_Type) < 0) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
     if (PyType_Ready(&XMPZ_Type) < 0) {
         /* LCOV_EXCL_START */
         INITERROR;
@@ -944,6 +1010,11 @@ PyMODINIT_FUNC initgmpy2(void)
         INITERROR;
         /* LCOV_EXCL_STOP */
     }
+    if (PyType_Ready(&XMPFR_Type) < 0) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
     if (PyType_Ready(&CTXT_Type) < 0) {
         /* LCOV_EXCL_START */
         INITERROR;
@@ -959,11 +1030,33 @@ PyMODINIT_FUNC initgmpy2(void)
         INITERROR;
         /* LCOV_EXCL_STOP */
     }
+    if (PyType_Ready(&XMPC_Type) < 0) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
     if (PyType_Ready(&RandomState_Type) < 0) {
         /* LCOV_EXCL_START */
         INITERROR;
         /* LCOV_EXCL_STOP */
     }
+    if (PyType_Ready(&MPZ_Array_Type) < 0) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+    if (PyType_Ready(&FsumAcc_Type) < 0) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+#if PY_VERSION_HEX >= 0x03080000
+    if (PyType_Ready(&GMPy_LimbView_Type) < 0) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+#endif
 
     /* Initialize the global structure. Eventually this should be module local. */
     global.cache_size = 100;
@@ -977,6 +1070,13 @@ PyMODINIT_FUNC initgmpy2(void)
     set_gmpympfrcache();
     set_gmpympccache();
 
+    /* Create the interned small mpz values. */
+    if (init_gmpympzintern() < 0) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+
     /* Initialize exceptions. */
     GMPyExc_GmpyError = PyErr_NewException("gmpy2.gmpy2Error", PyExc_ArithmeticError, NULL);
     if (!GMPyExc_GmpyError) {
@@ -1069,18 +1169,57 @@ PyMODINIT_FUNC initgmpy2(void)
     Py_INCREF(&MPQ_Type);
     PyModule_AddObject(gmpy_module, "mpq", (PyObject*)&MPQ_Type);
 
+    /* Add the XMPQ type to the module namespace. */
+
+    Py_INCREF(&XMPQ_Type);
+    PyModule_AddObject(gmpy_module, "xmpq", (PyObject*)&XMPQ_Type);
+
     /* Add the MPFR type to the module namespace. */
 
     Py_INCREF(&MPFR_Type);
     PyModule_AddObject(gmpy_module, "mpfr", (PyObject*)&MPFR_Type);
 
+    /* Add the XMPFR type to the module namespace. */
+
+    Py_INCREF(&XMPFR_Type);
+    PyModule_AddObject(gmpy_module, "xmpfr", (PyObject*)&XMPFR_Type);
+
     /* Add the MPC type to the module namespace. */
 
     Py_INCREF(&MPC_Type);
     PyModule_AddObject(gmpy_module, "mpc", (PyObject*)&MPC_Type);
 
+    /* Add the XMPC type to the module namespace. */
+
+    Py_INCREF(&XMPC_Type);
+    PyModule_AddObject(gmpy_module, "xmpc", (PyObject*)&XMPC_Type);
+
+    /* Add the mpz_array type to the module namespace. */
+
+    Py_INCREF(&MPZ_Array_Type);
+    PyModule_AddObject(gmpy_module, "mpz_array", (PyObject*)&MPZ_Array_Type);
+
+    /* Add the fsum_accumulator type to the module namespace. */
+
+    Py_INCREF(&FsumAcc_Type);
+    PyModule_AddObject(gmpy_module, "fsum_accumulator", (PyObject*)&FsumAcc_Type);
+
     /* Initialize thread local contexts. */
-#ifdef WITHOUT_THREADS
+#if defined(CONTEXTVARS)
+    current_context_var = PyContextVar_New("gmpy2_context", NULL);
+    if (!current_context_var) {
+        /* LCOV_EXCL_START */
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+    Py_INCREF(Py_True);
+    if (PyModule_AddObject(gmpy_module, "HAVE_THREADS", Py_True) < 0) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(Py_True);
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+#elif defined(WITHOUT_THREADS)
     module_context = (CTXT_Object*)GMPy_CTXT_New();
     if (!module_context) {
         /* LCOV_EXCL_START */
@@ -1105,6 +1244,37 @@ PyMODINIT_FUNC initgmpy2(void)
     }
 #endif
 
+#ifdef CONTEXTVARS
+    Py_INCREF(Py_True);
+    if (PyModule_AddObject(gmpy_module, "HAVE_CONTEXTVARS", Py_True) < 0) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(Py_True);
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+#else
+    Py_INCREF(Py_False);
+    if (PyModule_AddObject(gmpy_module, "HAVE_CONTEXTVARS", Py_False) < 0) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(Py_False);
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+#endif
+
+#if MPZ_INTERN_MAX >= MPZ_INTERN_MIN
+    temp = Py_BuildValue("(ii)", MPZ_INTERN_MIN, MPZ_INTERN_MAX);
+#else
+    Py_INCREF(Py_None);
+    temp = Py_None;
+#endif
+    if (!temp || PyModule_AddObject(gmpy_module, "MPZ_INTERN", temp) < 0) {
+        /* LCOV_EXCL_START */
+        Py_XDECREF(temp);
+        INITERROR;
+        /* LCOV_EXCL_STOP */
+    }
+
     /* Add the constants for defining rounding modes. */
     if (PyModule_AddIntConstant(gmpy_module, "RoundToNearest", MPFR_RNDN) < 0) {
         /* LCOV_EXCL_START */
@@ -1187,11 +1357,11 @@ PyMODINIT_FUNC initgmpy2(void)
     GMPy_C_API[MPZ_Type_NUM] = (void*)&MPZ_Type;
     GMPy_C_API[XMPZ_Type_NUM] = (void*)&XMPZ_Type;
     GMPy_C_API[MPQ_Type_NUM] = (void*)&MPQ_Type;
-    GMPy_C_API[XMPQ_Type_NUM] = (void*)&MPQ_Type;
+    GMPy_C_API[XMPQ_Type_NUM] = (void*)&XMPQ_Type;
     GMPy_C_API[MPFR_Type_NUM] = (void*)&MPFR_Type;
-    GMPy_C_API[XMPFR_Type_NUM] = (void*)&MPFR_Type;
+    GMPy_C_API[XMPFR_Type_NUM] = (void*)&XMPFR_Type;
     GMPy_C_API[MPC_Type_NUM] = (void*)&MPC_Type;
-    GMPy_C_API[XMPC_Type_NUM] = (void*)&MPC_Type;
+    GMPy_C_API[XMPC_Type_NUM] = (void*)&XMPC_Type;
     GMPy_C_API[CTXT_Type_NUM] = (void*)&CTXT_Type;
     GMPy_C_API[CTXT_Manager_Type_NUM] = (void*)&CTXT_Manager_Type;
     GMPy_C_API[RandomState_Type_NUM] = (void*)&RandomState_Type;
@@ -1220,6 +1390,19 @@ PyMODINIT_FUNC initgmpy2(void)
     GMPy_C_API[GMPy_MPC_Dealloc_NUM] = (void*)GMPy_MPC_Dealloc;
     GMPy_C_API[GMPy_MPC_ConvertArg_NUM] = (void*)GMPy_MPC_ConvertArg;
 
+    GMPy_C_API[GMPy_MPZ_Lucas_UV_NUM] = (void*)GMPy_MPZ_Lucas_UV;
+    GMPy_C_API[GMPy_MPZ_Is_Fermat_PRP_NUM] = (void*)GMPy_MPZ_Is_Fermat_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_Euler_PRP_NUM] = (void*)GMPy_MPZ_Is_Euler_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_Strong_PRP_NUM] = (void*)GMPy_MPZ_Is_Strong_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_Fibonacci_PRP_NUM] = (void*)GMPy_MPZ_Is_Fibonacci_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_Lucas_PRP_NUM] = (void*)GMPy_MPZ_Is_Lucas_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_StrongLucas_PRP_NUM] = (void*)GMPy_MPZ_Is_StrongLucas_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_ExtraStrongLucas_PRP_NUM] = (void*)GMPy_MPZ_Is_ExtraStrongLucas_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_Selfridge_PRP_NUM] = (void*)GMPy_MPZ_Is_Selfridge_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_StrongSelfridge_PRP_NUM] = (void*)GMPy_MPZ_Is_StrongSelfridge_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_BPSW_PRP_NUM] = (void*)GMPy_MPZ_Is_BPSW_PRP;
+    GMPy_C_API[GMPy_MPZ_Is_StrongBPSW_PRP_NUM] = (void*)GMPy_MPZ_Is_StrongBPSW_PRP;
+
     c_api_object = PyCapsule_New((void *)GMPy_C_API, "gmpy2._C_API", NULL);
 
     if (c_api_object != NULL) {
@@ -1229,15 +1412,15 @@ PyMODINIT_FUNC initgmpy2(void)
 
     /* Add support for pickling. */
 #ifdef PY3
+    /* mpz, mpq, mpfr, and mpc provide __reduce_ex__() so they can use
+     * out-of-band buffers with pickle protocol 5. A copyreg entry would
+     * take precedence over it, so only xmpz is registered.
+     */
     copy_reg_module = PyImport_ImportModule("copyreg");
     if (copy_reg_module) {
         char* enable_pickle =
             "def gmpy2_reducer(x): return (gmpy2.from_binary, (gmpy2.to_binary(x),))\n"
-            "copyreg.pickle(type(gmpy2.mpz(0)), gmpy2_reducer)\n"
-            "copyreg.pickle(type(gmpy2.xmpz(0)), gmpy2_reducer)\n"
-            "copyreg.pickle(type(gmpy2.mpq(0)), gmpy2_reducer)\n"
-            "copyreg.pickle(type(gmpy2.mpfr(0)), gmpy2_reducer)\n"
-            "copyreg.pickle(type(gmpy2.mpc(0,0)), gmpy2_reducer)\n";
+            "copyreg.pickle(type(gmpy2.xmpz(0)), gmpy2_reducer)\n";
 
         namespace = PyDict_New();
         result = NULL;
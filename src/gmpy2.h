@@ -73,6 +73,10 @@ extern "C" {
 #  error "GMPY2 requires Python 2.6 or later."
 #endif
 
+#if defined(CONTEXTVARS) && PY_VERSION_HEX < 0x03070000
+#  error "The contextvars option requires Python 3.7 or later."
+#endif
+
 /* Include headers for GMP/MPIR, MPFR, and MPC. */
 
 #ifdef MPIR
@@ -139,6 +143,15 @@ typedef struct {
     Py_hash_t  hash_cache;
 } MPQ_Object;
 
+typedef struct {
+    PyObject_HEAD
+    mpq_t q;
+    Py_hash_t  hash_cache;
+    int lazy;                /* defer canonicalization of the value      */
+    int canonical;           /* value is known to be in canonical form   */
+    mp_bitcnt_t limit;       /* canonicalize when num or den exceeds it  */
+} XMPQ_Object;
+
 typedef struct {
     PyObject_HEAD
     mpfr_t f;
@@ -146,6 +159,13 @@ typedef struct {
     int rc;
 } MPFR_Object;
 
+typedef struct {
+    PyObject_HEAD
+    mpfr_t f;
+    Py_hash_t hash_cache;
+    int rc;
+} XMPFR_Object;
+
 typedef struct {
     PyObject_HEAD
     mpc_t c;
@@ -153,6 +173,13 @@ typedef struct {
     int rc;
 } MPC_Object;
 
+typedef struct {
+    PyObject_HEAD
+    mpc_t c;
+    Py_hash_t hash_cache;
+    int rc;
+} XMPC_Object;
+
 typedef struct {
     PyObject_HEAD
     gmp_randstate_t state;
@@ -178,6 +205,7 @@ typedef struct {
     mpfr_rnd_t imag_round;   /* current rounding mode for Im(MPC) */
     int allow_complex;       /* if 1, allow mpfr functions to return an mpc */
     int rational_division;   /* if 1, mpz/mpz returns an mpq result */
+    int track_flags;         /* if 0, do not update the exception flags */
 } gmpy_context;
 
 typedef struct {
@@ -309,9 +337,71 @@ typedef struct {
 #define GMPy_MPC_ConvertArg_RETURN  int
 #define GMPy_MPC_ConvertArg_PROTO   (PyObject *arg, PyObject **ptr)
 
+/* The following function is found in gmpy_mpz_lucas. */
+
+#define GMPy_MPZ_Lucas_UV_NUM                    30
+#define GMPy_MPZ_Lucas_UV_RETURN                 void
+#define GMPy_MPZ_Lucas_UV_PROTO                  (mpz_ptr u, mpz_ptr v, mpz_ptr qk, mpz_srcptr p, mpz_srcptr q, mpz_srcptr k, mpz_srcptr n)
+
+/* The following functions are found in gmpy_mpz_prp. They return one of
+ * the GMPY_PRP_* codes below.
+ */
+
+#define GMPy_MPZ_Is_Fermat_PRP_NUM               31
+#define GMPy_MPZ_Is_Fermat_PRP_RETURN            int
+#define GMPy_MPZ_Is_Fermat_PRP_PROTO             (mpz_srcptr n, mpz_srcptr a)
+
+#define GMPy_MPZ_Is_Euler_PRP_NUM                32
+#define GMPy_MPZ_Is_Euler_PRP_RETURN             int
+#define GMPy_MPZ_Is_Euler_PRP_PROTO              (mpz_srcptr n, mpz_srcptr a)
+
+#define GMPy_MPZ_Is_Strong_PRP_NUM               33
+#define GMPy_MPZ_Is_Strong_PRP_RETURN            int
+#define GMPy_MPZ_Is_Strong_PRP_PROTO             (mpz_srcptr n, mpz_srcptr a)
+
+#define GMPy_MPZ_Is_Fibonacci_PRP_NUM            34
+#define GMPy_MPZ_Is_Fibonacci_PRP_RETURN         int
+#define GMPy_MPZ_Is_Fibonacci_PRP_PROTO          (mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+
+#define GMPy_MPZ_Is_Lucas_PRP_NUM                35
+#define GMPy_MPZ_Is_Lucas_PRP_RETURN             int
+#define GMPy_MPZ_Is_Lucas_PRP_PROTO              (mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+
+#define GMPy_MPZ_Is_StrongLucas_PRP_NUM          36
+#define GMPy_MPZ_Is_StrongLucas_PRP_RETURN       int
+#define GMPy_MPZ_Is_StrongLucas_PRP_PROTO        (mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+
+#define GMPy_MPZ_Is_ExtraStrongLucas_PRP_NUM     37
+#define GMPy_MPZ_Is_ExtraStrongLucas_PRP_RETURN  int
+#define GMPy_MPZ_Is_ExtraStrongLucas_PRP_PROTO   (mpz_srcptr n, mpz_srcptr p)
+
+#define GMPy_MPZ_Is_Selfridge_PRP_NUM            38
+#define GMPy_MPZ_Is_Selfridge_PRP_RETURN         int
+#define GMPy_MPZ_Is_Selfridge_PRP_PROTO          (mpz_srcptr n)
+
+#define GMPy_MPZ_Is_StrongSelfridge_PRP_NUM      39
+#define GMPy_MPZ_Is_StrongSelfridge_PRP_RETURN   int
+#define GMPy_MPZ_Is_StrongSelfridge_PRP_PROTO    (mpz_srcptr n)
+
+#define GMPy_MPZ_Is_BPSW_PRP_NUM                 40
+#define GMPy_MPZ_Is_BPSW_PRP_RETURN              int
+#define GMPy_MPZ_Is_BPSW_PRP_PROTO               (mpz_srcptr n)
+
+#define GMPy_MPZ_Is_StrongBPSW_PRP_NUM           41
+#define GMPy_MPZ_Is_StrongBPSW_PRP_RETURN        int
+#define GMPy_MPZ_Is_StrongBPSW_PRP_PROTO         (mpz_srcptr n)
+
+#define GMPY_PRP_COMPOSITE        0
+#define GMPY_PRP_PROBABLE_PRIME   1
+#define GMPY_PRP_ERROR_A         -1   /* the base a is less than 2 */
+#define GMPY_PRP_ERROR_N         -2   /* n is not greater than 0 */
+#define GMPY_PRP_ERROR_GCD       -3   /* n has a factor in common with the parameters */
+#define GMPY_PRP_ERROR_PQ        -4   /* invalid Lucas parameters */
+#define GMPY_PRP_ERROR_D         -5   /* no Selfridge parameter D was found */
+
 /* Total number of C-API pointers. */
 
-#define GMPy_API_pointers 30
+#define GMPy_API_pointers 42
 
 /* End of C-API definitions. */
 
@@ -408,6 +498,29 @@ typedef struct {
  * here. The default value is 100.*/
 #define MAX_CACHE 1000
 
+/* mpz values in the interval [MPZ_INTERN_MIN, MPZ_INTERN_MAX] are created
+ * once when the module is loaded. mpz() and the mpz arithmetic slots return
+ * a new reference to the shared object instead of allocating a new one.
+ * Both limits can be changed at compile time; interning is disabled when
+ * MPZ_INTERN_MAX is less than MPZ_INTERN_MIN.
+ */
+#ifndef MPZ_INTERN_MIN
+#  define MPZ_INTERN_MIN -256
+#endif
+#ifndef MPZ_INTERN_MAX
+#  define MPZ_INTERN_MAX 1024
+#endif
+#if MPZ_INTERN_MIN < -32767 || MPZ_INTERN_MAX > 32767
+#  error "MPZ_INTERN_MIN and MPZ_INTERN_MAX must be in [-32767, 32767]"
+#endif
+
+/* Operands whose absolute value is at most MPZ_INTERN_OPERAND_MAX can be
+ * added, subtracted, and multiplied as C longs without overflow. */
+#define MPZ_INTERN_OPERAND_MAX ((1L << (sizeof(long) * 4 - 1)) - 1)
+#define MPZ_IS_INTERN_OPERAND(v) \
+    ((v) >= -MPZ_INTERN_OPERAND_MAX && (v) <= MPZ_INTERN_OPERAND_MAX)
+#define MPZ_IS_INTERNED(v) ((v) >= MPZ_INTERN_MIN && (v) <= MPZ_INTERN_MAX)
+
 #ifdef USE_ALLOCA
 #  define TEMP_ALLOC(B, S)     \
     if(S < ALLOC_THRESHOLD) {  \
@@ -450,8 +563,11 @@ typedef struct {
 #include "gmpy2_mpz.h"
 #include "gmpy2_xmpz.h"
 #include "gmpy2_mpq.h"
+#include "gmpy2_xmpq.h"
 #include "gmpy2_mpfr.h"
+#include "gmpy2_xmpfr.h"
 #include "gmpy2_mpc.h"
+#include "gmpy2_xmpc.h"
 #include "gmpy2_context.h"
 #include "gmpy2_random.h"
 
@@ -468,6 +584,8 @@ typedef struct {
 /* Support conversion to/from binary format. */
 
 #include "gmpy2_binary.h"
+#include "gmpy2_mpz_array.h"
+#include "gmpy2_fsum_accumulator.h"
 
 /* Support for mpz/xmpz specific functions. */
 
@@ -476,6 +594,8 @@ typedef struct {
 #include "gmpy2_convert_gmp.h"
 #include "gmpy2_convert_mpfr.h"
 #include "gmpy2_convert_mpc.h"
+#include "gmpy2_mpz_str.h"
+#include "gmpy2_parse.h"
 
 #include "gmpy2_mpz_divmod.h"
 #include "gmpy2_mpz_divmod2exp.h"
@@ -490,14 +610,21 @@ typedef struct {
 /* Support for mpq specific functions. */
 
 #include "gmpy2_mpq_misc.h"
+#include "gmpy2_xmpq_inplace.h"
 
 /* Support for mpfr specific functions. */
 
 #include "gmpy2_mpfr_misc.h"
+#include "gmpy2_xmpfr_inplace.h"
 
 /* Support for mpc specific functions. */
 
 #include "gmpy2_mpc_misc.h"
+#include "gmpy2_xmpc_inplace.h"
+
+/* Montgomery arithmetic used by the Lucas sequences and probable-prime tests. */
+
+#include "gmpy_mpz_mont.h"
 
 /* Support Lucas sequences. */
 
@@ -576,6 +703,19 @@ static void **GMPy_C_API;
 #define GMPy_MPC_Dealloc     (*(GMPy_MPC_Dealloc_RETURN     (*)GMPy_MPC_Dealloc_PROTO)     GMPy_C_API[GMPy_MPC_Dealloc_NUM])
 #define GMPy_MPC_ConvertArg  (*(GMPy_MPC_ConvertArg_RETURN  (*)GMPy_MPC_ConvertArg_PROTO)  GMPy_C_API[GMPy_MPC_ConvertArg_NUM])
 
+#define GMPy_MPZ_Lucas_UV (*(GMPy_MPZ_Lucas_UV_RETURN (*)GMPy_MPZ_Lucas_UV_PROTO) GMPy_C_API[GMPy_MPZ_Lucas_UV_NUM])
+#define GMPy_MPZ_Is_Fermat_PRP (*(GMPy_MPZ_Is_Fermat_PRP_RETURN (*)GMPy_MPZ_Is_Fermat_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_Fermat_PRP_NUM])
+#define GMPy_MPZ_Is_Euler_PRP (*(GMPy_MPZ_Is_Euler_PRP_RETURN (*)GMPy_MPZ_Is_Euler_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_Euler_PRP_NUM])
+#define GMPy_MPZ_Is_Strong_PRP (*(GMPy_MPZ_Is_Strong_PRP_RETURN (*)GMPy_MPZ_Is_Strong_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_Strong_PRP_NUM])
+#define GMPy_MPZ_Is_Fibonacci_PRP (*(GMPy_MPZ_Is_Fibonacci_PRP_RETURN (*)GMPy_MPZ_Is_Fibonacci_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_Fibonacci_PRP_NUM])
+#define GMPy_MPZ_Is_Lucas_PRP (*(GMPy_MPZ_Is_Lucas_PRP_RETURN (*)GMPy_MPZ_Is_Lucas_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_Lucas_PRP_NUM])
+#define GMPy_MPZ_Is_StrongLucas_PRP (*(GMPy_MPZ_Is_StrongLucas_PRP_RETURN (*)GMPy_MPZ_Is_StrongLucas_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_StrongLucas_PRP_NUM])
+#define GMPy_MPZ_Is_ExtraStrongLucas_PRP (*(GMPy_MPZ_Is_ExtraStrongLucas_PRP_RETURN (*)GMPy_MPZ_Is_ExtraStrongLucas_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_ExtraStrongLucas_PRP_NUM])
+#define GMPy_MPZ_Is_Selfridge_PRP (*(GMPy_MPZ_Is_Selfridge_PRP_RETURN (*)GMPy_MPZ_Is_Selfridge_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_Selfridge_PRP_NUM])
+#define GMPy_MPZ_Is_StrongSelfridge_PRP (*(GMPy_MPZ_Is_StrongSelfridge_PRP_RETURN (*)GMPy_MPZ_Is_StrongSelfridge_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_StrongSelfridge_PRP_NUM])
+#define GMPy_MPZ_Is_BPSW_PRP (*(GMPy_MPZ_Is_BPSW_PRP_RETURN (*)GMPy_MPZ_Is_BPSW_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_BPSW_PRP_NUM])
+#define GMPy_MPZ_Is_StrongBPSW_PRP (*(GMPy_MPZ_Is_StrongBPSW_PRP_RETURN (*)GMPy_MPZ_Is_StrongBPSW_PRP_PROTO) GMPy_C_API[GMPy_MPZ_Is_StrongBPSW_PRP_NUM])
+
 static int
 import_gmpy2(void)
 {
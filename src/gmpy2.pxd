@@ -124,6 +124,27 @@ cdef extern from "gmpy2.h":
     cdef bint MPFR_Check(object)
     cdef bint MPC_Check(object)
 
+    # Lucas sequences and probable prime tests
+    cdef int GMPY_PRP_COMPOSITE
+    cdef int GMPY_PRP_PROBABLE_PRIME
+    cdef int GMPY_PRP_ERROR_A
+    cdef int GMPY_PRP_ERROR_N
+    cdef int GMPY_PRP_ERROR_GCD
+    cdef int GMPY_PRP_ERROR_PQ
+    cdef int GMPY_PRP_ERROR_D
+    cdef void GMPy_MPZ_Lucas_UV(mpz_ptr u, mpz_ptr v, mpz_ptr qk, mpz_srcptr p, mpz_srcptr q, mpz_srcptr k, mpz_srcptr n)
+    cdef int GMPy_MPZ_Is_Fermat_PRP(mpz_srcptr n, mpz_srcptr a)
+    cdef int GMPy_MPZ_Is_Euler_PRP(mpz_srcptr n, mpz_srcptr a)
+    cdef int GMPy_MPZ_Is_Strong_PRP(mpz_srcptr n, mpz_srcptr a)
+    cdef int GMPy_MPZ_Is_Fibonacci_PRP(mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+    cdef int GMPy_MPZ_Is_Lucas_PRP(mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+    cdef int GMPy_MPZ_Is_StrongLucas_PRP(mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+    cdef int GMPy_MPZ_Is_ExtraStrongLucas_PRP(mpz_srcptr n, mpz_srcptr p)
+    cdef int GMPy_MPZ_Is_Selfridge_PRP(mpz_srcptr n)
+    cdef int GMPy_MPZ_Is_StrongSelfridge_PRP(mpz_srcptr n)
+    cdef int GMPy_MPZ_Is_BPSW_PRP(mpz_srcptr n)
+    cdef int GMPy_MPZ_Is_StrongBPSW_PRP(mpz_srcptr n)
+
 
 # Build a gmpy2 mpz from a gmp mpz
 cdef inline mpz GMPy_MPZ_From_mpz(mpz_srcptr z):
@@ -70,7 +70,9 @@ GMPy_Integer_Abs(PyObject *x, CTXT_Object *context)
 
     /* This is safe because result is not an incremented reference to an
      * existing value. Why?
-     *   1) No values are interned like Python's integers.
+     *   1) GMPy_MPZ_From_Integer() creates a new mpz for every argument
+     *      type except mpz. An mpz argument, which may be an interned value,
+     *      is returned itself with one more reference.
      *   2) MPZ is already handled so GMPy_MPZ_From_Integer() can't return
      *      an incremented reference to an existing value (which it would do
      *      if passed an MPZ).
@@ -143,7 +145,7 @@ GMPy_Real_Abs(PyObject *x, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_abs(result->f, tempx->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -175,7 +177,7 @@ GMPy_Complex_Abs(PyObject *x, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpc_abs(result->f, tempx->c, GET_MPC_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -48,7 +48,7 @@
  *   GMPy_Real_Add(Real, Real, context|NULL)
  *   GMPy_Complex_Add(Complex, Complex, context|NULL)
  *
- *   GMPy_Context_Add(context, args)
+ *   GMPy_Context_Add(context, GMPY_KWARGS_PARAMS)
  *
  */
 
@@ -150,15 +150,49 @@ GMPy_Integer_Add(PyObject *x, PyObject *y, CTXT_Object *context)
 static PyObject *
 GMPy_MPZ_Add_Slot(PyObject *x, PyObject *y)
 {
-    if (MPZ_Check(x) && MPZ_Check(y)) {
-        MPZ_Object *result = NULL;
+    MPZ_Object *result = NULL;
+    long temp, small;
 
+    if (MPZ_Check(x) && MPZ_Check(y)) {
+        if (GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            GMPy_MPZ_GetSmall(MPZ(y), &temp) &&
+            MPZ_IS_INTERNED(small + temp)) {
+            return GMPy_MPZ_Intern(small + temp);
+        }
         if ((result = GMPy_MPZ_New(NULL))) {
             mpz_add(result->z, MPZ(x), MPZ(y));
         }
         return (PyObject*)result;
     }
 
+    /* Fast path for an mpz and a small Python integer. */
+    if (MPZ_Check(x) && IS_SMALL_PYINT(y)) {
+        temp = SMALL_PYINT_AS_LONG(y);
+    }
+    else if (IS_SMALL_PYINT(x) && MPZ_Check(y)) {
+        temp = SMALL_PYINT_AS_LONG(x);
+        x = y;
+    }
+    else {
+        goto general;
+    }
+    if (MPZ_IS_INTERN_OPERAND(temp) &&
+        GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+        MPZ_IS_INTERNED(small + temp)) {
+        return GMPy_MPZ_Intern(small + temp);
+    }
+    if ((result = GMPy_MPZ_New(NULL))) {
+        if (temp >= 0) {
+            mpz_add_ui(result->z, MPZ(x), temp);
+        }
+        else {
+            mpz_sub_ui(result->z, MPZ(x), -temp);
+        }
+    }
+    return (PyObject*)result;
+
+  general:
+
     if (IS_INTEGER(x) && IS_INTEGER(y))
         return GMPy_Integer_Add(x, y, NULL);
 
@@ -270,9 +304,9 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPFR_Check(x)) {
-        if (MPFR_Check(y)) {
-            mpfr_clear_flags();
+    if (CHECK_MPFRANY(x)) {
+        if (CHECK_MPFRANY(y)) {
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
             goto done;
@@ -283,14 +317,14 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
             long temp = GMPy_Integer_AsLongAndError(y, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_add_si(result->f, MPFR(x), temp, GET_MPFR_ROUND(context));
                 goto done;
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, y);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_add_z(result->f, MPFR(x), global.tempz, GET_MPFR_ROUND(context));
                 goto done;
@@ -298,7 +332,7 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add_z(result->f, MPFR(x), MPZ(y), GET_MPFR_ROUND(context));
             goto done;
@@ -314,7 +348,7 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
                 /* LCOV_EXCL_STOP */
             }
 
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add_q(result->f, MPFR(x), tempy->q, GET_MPFR_ROUND(context));
             Py_DECREF((PyObject*)tempy);
@@ -322,27 +356,27 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add_d(result->f, MPFR(x), PyFloat_AS_DOUBLE(y), GET_MPFR_ROUND(context));
             goto done;
         }
     }
 
-    if (MPFR_Check(y)) {
+    if (CHECK_MPFRANY(y)) {
         if (PyIntOrLong_Check(x)) {
             int error;
             long temp = GMPy_Integer_AsLongAndError(x, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_add_si(result->f, MPFR(y), temp, GET_MPFR_ROUND(context));
                 goto done;
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, x);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_add_z(result->f, MPFR(y), global.tempz, GET_MPFR_ROUND(context));
                 goto done;
@@ -350,7 +384,7 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add_z(result->f, MPFR(y), MPZ(x), GET_MPFR_ROUND(context));
             goto done;
@@ -366,7 +400,7 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
                 /* LCOV_EXCL_STOP */
             }
 
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add_q(result->f, MPFR(y), tempx->q, GET_MPFR_ROUND(context));
             Py_DECREF((PyObject*)tempx);
@@ -374,7 +408,7 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add_d(result->f, MPFR(y), PyFloat_AS_DOUBLE(x), GET_MPFR_ROUND(context));
             goto done;
@@ -394,7 +428,7 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
             /* LCOV_EXCL_STOP */
         }
 
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_add(result->f, MPFR(tempx), MPFR(tempy), GET_MPFR_ROUND(context));
         Py_DECREF((PyObject*)tempx);
@@ -421,14 +455,14 @@ GMPy_Real_Add(PyObject *x, PyObject *y, CTXT_Object *context)
 static PyObject *
 GMPy_MPFR_Add_Slot(PyObject *x, PyObject *y)
 {
-    if ((MPFR_Check(x)) && MPFR_Check(y)) {
+    if ((CHECK_MPFRANY(x)) && CHECK_MPFRANY(y)) {
         MPFR_Object *result;
         CTXT_Object *context = NULL;
 
         CHECK_CONTEXT(context);
 
         if ((result = GMPy_MPFR_New(0, context))) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_add(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
             _GMPy_MPFR_Cleanup(&result, context);
@@ -463,7 +497,7 @@ GMPy_Complex_Add(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPC_Check(x) && MPC_Check(y)) {
+    if (CHECK_MPCANY(x) && CHECK_MPCANY(y)) {
 
         result->rc = mpc_add(result->c, MPC(x), MPC(y), GET_MPC_ROUND(context));
 
@@ -543,11 +577,12 @@ PyDoc_STRVAR(GMPy_doc_context_add,
 "Return x + y.");
 
 static PyObject *
-GMPy_Context_Add(PyObject *self, PyObject *args)
+GMPy_Context_Add(PyObject *self, GMPY_KWARGS_PARAMS)
 {
-    CTXT_Object *context = NULL;
+    CTXT_Object *context = NULL, *local, temp_context;
+    PyObject *result;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (GMPY_KWARGS_NARGS != 2) {
         TYPE_ERROR("add() requires 2 arguments");
         return NULL;
     }
@@ -559,8 +594,14 @@ GMPy_Context_Add(PyObject *self, PyObject *args)
         CHECK_CONTEXT(context);
     }
 
-    return GMPy_Number_Add(PyTuple_GET_ITEM(args, 0),
-                           PyTuple_GET_ITEM(args, 1),
-                           context);
+    if (!(local = GMPY_KWARGS_CONTEXT(context, &temp_context))) {
+        return NULL;
+    }
+
+    result = GMPy_Number_Add(GMPY_KWARGS_ARG(0),
+                             GMPY_KWARGS_ARG(1),
+                             local);
+    GMPy_CTXT_Merge_Flags(context, local);
+    return result;
 }
 
@@ -49,7 +49,7 @@ static PyObject * GMPy_MPQ_Add_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPFR_Add_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPC_Add_Slot(PyObject *x, PyObject *y);
 
-static PyObject * GMPy_Context_Add(PyObject *self, PyObject *args);
+static PyObject * GMPy_Context_Add(PyObject *self, GMPY_KWARGS_PARAMS);
 
 #ifdef __cplusplus
 }
@@ -662,8 +662,6 @@ PyDoc_STRVAR(doc_from_binary,
 static PyObject *
 GMPy_MPANY_From_Binary(PyObject *self, PyObject *other)
 {
-    unsigned char *buffer, *cp;
-    Py_ssize_t len;
     CTXT_Object *context = NULL;
 
     CHECK_CONTEXT(context);
@@ -673,15 +671,70 @@ GMPy_MPANY_From_Binary(PyObject *self, PyObject *other)
         return NULL;
     }
 
-    len = PyBytes_Size(other);
+    return GMPy_MPANY_From_CBinary((unsigned char*)PyBytes_AS_STRING(other),
+                                   PyBytes_GET_SIZE(other), context);
+}
+
+/* Decode len bytes starting at buffer. The buffer is not required to be
+ * owned by a bytes object so the record stream readers can decode in place.
+ *
+ * The mutable types xmpq, xmpfr, and xmpc are stored like mpq, mpfr, and
+ * mpc but with the type byte increased by 3 (0x06, 0x07, and 0x08). They
+ * are decoded as the immutable type and the value is then moved into a new
+ * mutable object.
+ */
+
+static PyObject *
+GMPy_MPANY_From_CBinaryCode(int code, unsigned char *buffer, Py_ssize_t len,
+                            CTXT_Object *context);
+
+static PyObject *
+GMPy_MPANY_From_CBinary(unsigned char *buffer, Py_ssize_t len,
+                        CTXT_Object *context)
+{
+    PyObject *temp, *result = NULL;
+
+    if (len < 2 || buffer[0] < 0x06 || buffer[0] > 0x08)
+        return GMPy_MPANY_From_CBinaryCode(len ? buffer[0] : 0, buffer, len, context);
+
+    if (!(temp = GMPy_MPANY_From_CBinaryCode(buffer[0] - 3, buffer, len, context)))
+        return NULL;
+
+    if (MPQ_Check(temp)) {
+        if ((result = (PyObject*)GMPy_XMPQ_New(context)))
+            mpq_swap(MPQ(result), MPQ(temp));
+    }
+    else if (MPFR_Check(temp)) {
+        if ((result = (PyObject*)GMPy_XMPFR_New(mpfr_get_prec(MPFR(temp)), context))) {
+            mpfr_swap(MPFR(result), MPFR(temp));
+            ((XMPFR_Object*)result)->rc = ((MPFR_Object*)temp)->rc;
+        }
+    }
+    else {
+        if ((result = (PyObject*)GMPy_XMPC_New(mpfr_get_prec(mpc_realref(MPC(temp))),
+                                               mpfr_get_prec(mpc_imagref(MPC(temp))),
+                                               context))) {
+            mpc_swap(MPC(result), MPC(temp));
+            ((XMPC_Object*)result)->rc = ((MPC_Object*)temp)->rc;
+        }
+    }
+    Py_DECREF(temp);
+    return result;
+}
+
+static PyObject *
+GMPy_MPANY_From_CBinaryCode(int code, unsigned char *buffer, Py_ssize_t len,
+                            CTXT_Object *context)
+{
+    unsigned char *cp;
+
     if (len < 2) {
         VALUE_ERROR("byte sequence too short for from_binary()");
         return NULL;
     }
-    buffer = (unsigned char*)PyBytes_AsString(other);
     cp = buffer;
 
-    switch (cp[0]) {
+    switch (code) {
         case 0x01: {
             MPZ_Object *result;
 
@@ -1216,8 +1269,29 @@ PyDoc_STRVAR(doc_to_binary,
 "Return a Python byte sequence that is a portable binary\n"
 "representation of a gmpy2 object x. The byte sequence can\n"
 "be passed to gmpy2.from_binary() to obtain an exact copy of\n"
-"x's value. Works with mpz, xmpz, mpq, mpfr, and mpc types. \n"
-"Raises TypeError if x is not a gmpy2 object.");
+"x's value. Works with mpz, xmpz, mpq, xmpq, mpfr, xmpfr, mpc, and\n"
+"xmpc types. Raises TypeError if x is not a gmpy2 object.");
+
+/* Encode an xmpq, xmpfr, or xmpc value; see GMPy_MPANY_From_CBinary(). */
+
+static PyObject *
+GMPy_MPANY_Mutable_To_Binary(PyObject *obj)
+{
+    PyObject *result;
+
+    if (XMPQ_Check(obj)) {
+        GMPy_XMPQ_Canonicalize(obj);
+        result = GMPy_MPQ_To_Binary((MPQ_Object*)obj);
+    }
+    else if (XMPFR_Check(obj))
+        result = GMPy_MPFR_To_Binary((MPFR_Object*)obj);
+    else
+        result = GMPy_MPC_To_Binary((MPC_Object*)obj);
+
+    if (result)
+        PyBytes_AS_STRING(result)[0] += 3;
+    return result;
+}
 
 static PyObject *
 GMPy_MPANY_To_Binary(PyObject *self, PyObject *other)
@@ -1232,7 +1306,1234 @@ GMPy_MPANY_To_Binary(PyObject *self, PyObject *other)
         return GMPy_MPFR_To_Binary((MPFR_Object*)other);
     else if(MPC_Check(other))
         return GMPy_MPC_To_Binary((MPC_Object*)other);
+    else if(XMPQ_Check(other) || XMPFR_Check(other) || XMPC_Check(other))
+        return GMPy_MPANY_Mutable_To_Binary(other);
     TYPE_ERROR("to_binary() argument type not supported");
     return NULL;
 }
 
+
+/* Format of the record stream written by pack_many() and dump_many().
+ *
+ * header:  8 bytes   b'GMPY2SEQ'
+ *          8 bytes   number of records
+ *          8 bytes   offset of the index, relative to the start of the
+ *                    header; 0 if the writer could not seek back to fill
+ *                    in the header (the number of records is then 0, too)
+ * records: length of the record as an unsigned LEB128 value (7 bits per
+ *          byte, least significant group first, high bit set on all but
+ *          the last byte), followed by the to_binary() encoding
+ * end:     0x00 (a record of length 0)
+ * index:   8 bytes   number of records
+ *          8 bytes   per record, offset of the record's length prefix
+ *                    relative to the start of the header
+ *
+ * All fixed width integers are unsigned and little-endian.
+ */
+
+#define STREAM_MAGIC       "GMPY2SEQ"
+#define STREAM_HEADER_SIZE 24
+#define STREAM_CHUNK       65536
+
+typedef unsigned PY_LONG_LONG stream_off_t;
+
+typedef struct {
+    unsigned char *buf;
+    size_t len;
+    size_t alloc;
+    PyObject *file;         /* NULL when packing into memory */
+    stream_off_t flushed;   /* bytes already passed to file.write() */
+    stream_off_t *offsets;
+    size_t count;
+    size_t offalloc;
+} stream_writer;
+
+typedef struct {
+    unsigned char *buf;
+    Py_ssize_t pos;
+    Py_ssize_t end;
+    Py_ssize_t alloc;
+    PyObject *file;         /* NULL when unpacking a buffer */
+    stream_off_t consumed;  /* bytes discarded from the front of buf */
+} stream_reader;
+
+static void
+stream_put_off(unsigned char *cp, stream_off_t v)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        cp[i] = (unsigned char)(v & 0xff);
+        v >>= 8;
+    }
+}
+
+static stream_off_t
+stream_get_off(const unsigned char *cp)
+{
+    stream_off_t v = 0;
+    int i;
+
+    for (i = 7; i >= 0; i--) {
+        v = (v << 8) | cp[i];
+    }
+    return v;
+}
+
+static int
+stream_reserve(stream_writer *w, size_t n)
+{
+    unsigned char *temp;
+    size_t newalloc;
+
+    if (w->alloc - w->len >= n)
+        return 0;
+    newalloc = w->alloc ? w->alloc : STREAM_CHUNK;
+    while (newalloc - w->len < n) {
+        if (newalloc > PY_SSIZE_T_MAX / 2) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        newalloc *= 2;
+    }
+    if (!(temp = PyMem_Realloc(w->buf, newalloc))) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    w->buf = temp;
+    w->alloc = newalloc;
+    return 0;
+}
+
+static int
+stream_write_file(PyObject *file, const unsigned char *buf, size_t len)
+{
+    PyObject *data, *temp;
+
+    if (!(data = PyBytes_FromStringAndSize((const char*)buf, len)))
+        return -1;
+    temp = PyObject_CallMethod(file, "write", "O", data);
+    Py_DECREF(data);
+    if (!temp)
+        return -1;
+    Py_DECREF(temp);
+    return 0;
+}
+
+static int
+stream_flush(stream_writer *w)
+{
+    if (!w->file || w->len == 0)
+        return 0;
+    if (stream_write_file(w->file, w->buf, w->len) < 0)
+        return -1;
+    w->flushed += w->len;
+    w->len = 0;
+    return 0;
+}
+
+static int
+stream_put_length(stream_writer *w, stream_off_t v)
+{
+    if (stream_reserve(w, 10) < 0)
+        return -1;
+    while (v >= 0x80) {
+        w->buf[w->len++] = (unsigned char)(v & 0x7f) | 0x80;
+        v >>= 7;
+    }
+    w->buf[w->len++] = (unsigned char)v;
+    return 0;
+}
+
+/* Append one record. mpz and xmpz values are exported directly into the
+ * stream buffer; the other types reuse their to_binary() encoding.
+ */
+
+static int
+stream_put_item(stream_writer *w, PyObject *obj)
+{
+    PyObject *temp;
+    size_t size;
+
+    if (w->count == w->offalloc) {
+        stream_off_t *newoff;
+        size_t newalloc = w->offalloc ? 2 * w->offalloc : 1024;
+
+        if (newalloc > PY_SSIZE_T_MAX / sizeof(stream_off_t) ||
+            !(newoff = PyMem_Realloc(w->offsets,
+                                     newalloc * sizeof(stream_off_t)))) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        w->offsets = newoff;
+        w->offalloc = newalloc;
+    }
+    w->offsets[w->count++] = w->flushed + w->len;
+
+    if (MPZ_Check(obj) || XMPZ_Check(obj)) {
+        mpz_srcptr z = MPZ(obj);
+        int sgn = mpz_sgn(z);
+
+        size = (sgn == 0) ? 2 : ((mpz_sizeinbase(z, 2) + 7) / 8) + 2;
+        if (stream_put_length(w, size) < 0 ||
+            stream_reserve(w, size) < 0)
+            return -1;
+        w->buf[w->len] = MPZ_Check(obj) ? 0x01 : 0x02;
+        w->buf[w->len + 1] = (sgn == 0) ? 0x00 : ((sgn > 0) ? 0x01 : 0x02);
+        if (sgn != 0)
+            mpz_export(w->buf + w->len + 2, NULL, -1, sizeof(char), 0, 0, z);
+        w->len += size;
+    }
+    else {
+        if (MPQ_Check(obj))
+            temp = GMPy_MPQ_To_Binary((MPQ_Object*)obj);
+        else if (MPFR_Check(obj))
+            temp = GMPy_MPFR_To_Binary((MPFR_Object*)obj);
+        else if (MPC_Check(obj))
+            temp = GMPy_MPC_To_Binary((MPC_Object*)obj);
+        else if (XMPQ_Check(obj) || XMPFR_Check(obj) || XMPC_Check(obj))
+            temp = GMPy_MPANY_Mutable_To_Binary(obj);
+        else {
+            TYPE_ERROR("pack_many() and dump_many() require mpz, xmpz, "
+                       "mpq, xmpq, mpfr, xmpfr, mpc, or xmpc values");
+            return -1;
+        }
+        if (!temp)
+            return -1;
+        size = PyBytes_GET_SIZE(temp);
+        if (stream_put_length(w, size) < 0 ||
+            stream_reserve(w, size) < 0) {
+            Py_DECREF(temp);
+            return -1;
+        }
+        memcpy(w->buf + w->len, PyBytes_AS_STRING(temp), size);
+        w->len += size;
+        Py_DECREF(temp);
+    }
+
+    if (w->file && w->len >= STREAM_CHUNK)
+        return stream_flush(w);
+    return 0;
+}
+
+/* Write the header, every item of seq, the end marker, and the index.
+ * Returns the offset of the index or -1 on error.
+ */
+
+static PY_LONG_LONG
+stream_write_all(stream_writer *w, PyObject *seq)
+{
+    PyObject *iter, *item;
+    stream_off_t index;
+    size_t i;
+
+    if (stream_reserve(w, STREAM_HEADER_SIZE) < 0)
+        return -1;
+    memcpy(w->buf, STREAM_MAGIC, 8);
+    memset(w->buf + 8, 0, 16);
+    w->len = STREAM_HEADER_SIZE;
+
+    if (!(iter = PyObject_GetIter(seq)))
+        return -1;
+    while ((item = PyIter_Next(iter))) {
+        if (stream_put_item(w, item) < 0) {
+            Py_DECREF(item);
+            Py_DECREF(iter);
+            return -1;
+        }
+        Py_DECREF(item);
+    }
+    Py_DECREF(iter);
+    if (PyErr_Occurred())
+        return -1;
+
+    if (stream_reserve(w, 1) < 0)
+        return -1;
+    w->buf[w->len++] = 0x00;
+
+    index = w->flushed + w->len;
+    if (stream_reserve(w, 8) < 0)
+        return -1;
+    stream_put_off(w->buf + w->len, w->count);
+    w->len += 8;
+    for (i = 0; i < w->count; i++) {
+        if (stream_reserve(w, 8) < 0)
+            return -1;
+        stream_put_off(w->buf + w->len, w->offsets[i]);
+        w->len += 8;
+        if (w->file && w->len >= STREAM_CHUNK && stream_flush(w) < 0)
+            return -1;
+    }
+    if (stream_flush(w) < 0)
+        return -1;
+    return (PY_LONG_LONG)index;
+}
+
+static void
+stream_writer_clear(stream_writer *w)
+{
+    PyMem_Free(w->buf);
+    PyMem_Free(w->offsets);
+}
+
+/* Return the current position of a file object, or -1 with no exception
+ * set if the file does not support tell() (a pipe, for example).
+ */
+
+static PY_LONG_LONG
+stream_tell(PyObject *file)
+{
+    PyObject *temp;
+    PY_LONG_LONG result;
+
+    /* seek() does not move the write position of a file opened for
+     * appending, so treat it as unseekable. */
+    if ((temp = PyObject_GetAttrString(file, "mode"))) {
+        PyObject *a = Py2or3String_FromString("a");
+        int append = 0;
+
+        if (a && PyStrOrUnicode_Check(temp))
+            append = PySequence_Contains(temp, a) == 1;
+        Py_XDECREF(a);
+        Py_DECREF(temp);
+        if (append)
+            return -1;
+    }
+    PyErr_Clear();
+
+    if (!(temp = PyObject_CallMethod(file, "tell", NULL))) {
+        PyErr_Clear();
+        return -1;
+    }
+    result = PyLong_AsLongLong(temp);
+    Py_DECREF(temp);
+    if (result == -1)
+        PyErr_Clear();
+    return result;
+}
+
+static int
+stream_seek(PyObject *file, stream_off_t pos)
+{
+    PyObject *temp;
+
+    if (!(temp = PyObject_CallMethod(file, "seek", "L", (PY_LONG_LONG)pos)))
+        return -1;
+    Py_DECREF(temp);
+    return 0;
+}
+
+PyDoc_STRVAR(doc_pack_many,
+"pack_many(iterable) -> bytes\n"
+"Return a byte sequence containing every mpz, xmpz, mpq, mpfr, or mpc\n"
+"in iterable. Each value is stored as a length-prefixed record using\n"
+"the to_binary() encoding and the records are followed by an index.\n"
+"The result can be decoded by unpack_many() or load_many().");
+
+static PyObject *
+GMPy_MPANY_Pack_Many(PyObject *self, PyObject *other)
+{
+    stream_writer w = { NULL, 0, 0, NULL, 0, NULL, 0, 0 };
+    PY_LONG_LONG index;
+    PyObject *result;
+
+    if ((index = stream_write_all(&w, other)) < 0) {
+        stream_writer_clear(&w);
+        return NULL;
+    }
+    stream_put_off(w.buf + 8, w.count);
+    stream_put_off(w.buf + 16, index);
+    result = PyBytes_FromStringAndSize((char*)w.buf, w.len);
+    stream_writer_clear(&w);
+    return result;
+}
+
+PyDoc_STRVAR(doc_dump_many,
+"dump_many(iterable, file) -> None\n"
+"Write every mpz, xmpz, mpq, mpfr, or mpc in iterable to the binary\n"
+"file object file using the format of pack_many(). Records are written\n"
+"in chunks as they are encoded so the complete payload is never held\n"
+"in memory. If file supports tell() and seek(), the header is updated\n"
+"with the location of the index so load_many() can seek to a record.");
+
+static PyObject *
+GMPy_MPANY_Dump_Many(PyObject *self, PyObject *args)
+{
+    stream_writer w = { NULL, 0, 0, NULL, 0, NULL, 0, 0 };
+    PY_LONG_LONG base, index, end;
+    unsigned char header[16];
+    PyObject *seq;
+
+    if (!PyArg_ParseTuple(args, "OO", &seq, &(w.file)))
+        return NULL;
+
+    base = stream_tell(w.file);
+    if ((index = stream_write_all(&w, seq)) < 0) {
+        stream_writer_clear(&w);
+        return NULL;
+    }
+
+    if (base >= 0 && (end = stream_tell(w.file)) >= 0) {
+        stream_put_off(header, w.count);
+        stream_put_off(header + 8, index);
+        if (stream_seek(w.file, base + 8) < 0 ||
+            stream_write_file(w.file, header, 16) < 0 ||
+            stream_seek(w.file, end) < 0) {
+            stream_writer_clear(&w);
+            return NULL;
+        }
+    }
+    stream_writer_clear(&w);
+    Py_RETURN_NONE;
+}
+
+/* Make sure at least n unread bytes are available. When reading from a
+ * file, unread bytes are moved to the front of the buffer and more data
+ * is requested with file.read().
+ */
+
+static int
+stream_need(stream_reader *r, Py_ssize_t n)
+{
+    PyObject *data;
+    Py_ssize_t size;
+
+    if (r->end - r->pos >= n)
+        return 0;
+    if (!r->file) {
+        VALUE_ERROR("invalid record stream (truncated)");
+        return -1;
+    }
+
+    if (r->pos > 0) {
+        memmove(r->buf, r->buf + r->pos, r->end - r->pos);
+        r->end -= r->pos;
+        r->consumed += r->pos;
+        r->pos = 0;
+    }
+    if (r->alloc < n || r->alloc < STREAM_CHUNK) {
+        unsigned char *temp;
+        Py_ssize_t newalloc = (n > STREAM_CHUNK) ? n : STREAM_CHUNK;
+
+        if (!(temp = PyMem_Realloc(r->buf, newalloc))) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        r->buf = temp;
+        r->alloc = newalloc;
+    }
+
+    while (r->end < n) {
+        if (!(data = PyObject_CallMethod(r->file, "read", "n",
+                                         r->alloc - r->end)))
+            return -1;
+        if (!PyBytes_Check(data)) {
+            TYPE_ERROR("load_many() requires a file opened in binary mode");
+            Py_DECREF(data);
+            return -1;
+        }
+        size = PyBytes_GET_SIZE(data);
+        if (size == 0 || size > r->alloc - r->end) {
+            Py_DECREF(data);
+            VALUE_ERROR("invalid record stream (truncated)");
+            return -1;
+        }
+        memcpy(r->buf + r->end, PyBytes_AS_STRING(data), size);
+        r->end += size;
+        Py_DECREF(data);
+    }
+    return 0;
+}
+
+static int
+stream_get_length(stream_reader *r, Py_ssize_t *len)
+{
+    stream_off_t v = 0;
+    unsigned char c;
+    int shift = 0;
+
+    do {
+        if (stream_need(r, 1) < 0)
+            return -1;
+        c = r->buf[r->pos++];
+        if (shift > 56) {
+            VALUE_ERROR("invalid record stream (bad record length)");
+            return -1;
+        }
+        v |= (stream_off_t)(c & 0x7f) << shift;
+        shift += 7;
+    } while (c & 0x80);
+    if (v > (stream_off_t)PY_SSIZE_T_MAX) {
+        VALUE_ERROR("invalid record stream (bad record length)");
+        return -1;
+    }
+    *len = (Py_ssize_t)v;
+    return 0;
+}
+
+/* Skip over n bytes of input. */
+
+static int
+stream_skip_bytes(stream_reader *r, stream_off_t n)
+{
+    while (n > 0) {
+        Py_ssize_t step = (n < STREAM_CHUNK) ? (Py_ssize_t)n : STREAM_CHUNK;
+
+        if (stream_need(r, step) < 0)
+            return -1;
+        r->pos += step;
+        n -= step;
+    }
+    return 0;
+}
+
+/* Skip at most n records, stopping in front of the end marker. */
+
+static int
+stream_skip(stream_reader *r, Py_ssize_t n)
+{
+    Py_ssize_t i, len;
+
+    for (i = 0; i < n; i++) {
+        if (stream_get_length(r, &len) < 0)
+            return -1;
+        if (len == 0) {
+            r->pos--;
+            return 0;
+        }
+        if (stream_skip_bytes(r, len) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+/* Return the offset, relative to the header, of the entry just past entry i
+ * of the index, or 0 if base plus that offset does not fit in a file offset.
+ * index and i come from the stream header and must not be trusted.
+ */
+
+static stream_off_t
+stream_index_entry(stream_off_t index, stream_off_t i, PY_LONG_LONG base)
+{
+    stream_off_t limit = (stream_off_t)PY_LLONG_MAX;
+
+    if (base > 0)
+        limit -= (stream_off_t)base;
+    if (index == 0 || index > limit || i >= (limit - index) / 8)
+        return 0;
+    return index + 8 * (i + 1);
+}
+
+/* Position the reader on the record start, using the index if the header
+ * records it and the stream is seekable; otherwise skip records one at a
+ * time. base is the file offset of the header or -1 if tell() failed.
+ */
+
+static int
+stream_skip_to(stream_reader *r, Py_ssize_t start, stream_off_t count,
+               stream_off_t index, PY_LONG_LONG base)
+{
+    stream_off_t off, entry;
+
+    if (index != 0 && (stream_off_t)start < count) {
+        if (!(entry = stream_index_entry(index, start, base)))
+            goto truncated;
+        if (!r->file) {
+            if (entry > (stream_off_t)r->end ||
+                (stream_off_t)r->end - entry < 8)
+                goto truncated;
+            off = stream_get_off(r->buf + entry);
+            if (off < STREAM_HEADER_SIZE || off >= (stream_off_t)r->end)
+                goto truncated;
+            r->pos = (Py_ssize_t)off;
+            return 0;
+        }
+        if (base >= 0) {
+            if (stream_seek(r->file, base + entry) < 0)
+                return -1;
+            r->pos = r->end = 0;
+            if (stream_need(r, 8) < 0)
+                return -1;
+            off = stream_get_off(r->buf);
+            if (off < STREAM_HEADER_SIZE ||
+                off > (stream_off_t)PY_LLONG_MAX - (stream_off_t)base)
+                goto truncated;
+            if (stream_seek(r->file, base + off) < 0)
+                return -1;
+            r->pos = r->end = 0;
+            r->consumed = off;
+            return 0;
+        }
+    }
+
+    return stream_skip(r, start);
+
+  truncated:
+    VALUE_ERROR("invalid record stream (bad index)");
+    return -1;
+}
+
+/* Leave the file positioned just past the end of the index so several
+ * record streams can be stored back to back.
+ */
+
+static int
+stream_finish(stream_reader *r, stream_off_t count, stream_off_t index,
+              PY_LONG_LONG base)
+{
+    Py_ssize_t len;
+    stream_off_t entry;
+
+    if (base >= 0 && index != 0) {
+        if (!(entry = stream_index_entry(index, count, base))) {
+            VALUE_ERROR("invalid record stream (bad index)");
+            return -1;
+        }
+        return stream_seek(r->file, base + entry);
+    }
+
+    if (stream_skip(r, PY_SSIZE_T_MAX) < 0 ||
+        stream_get_length(r, &len) < 0 ||
+        stream_need(r, 8) < 0)
+        return -1;
+    count = stream_get_off(r->buf + r->pos);
+    r->pos += 8;
+    if (count > (stream_off_t)PY_SSIZE_T_MAX / 8) {
+        VALUE_ERROR("invalid record stream (bad index)");
+        return -1;
+    }
+    if (base >= 0)
+        return stream_seek(r->file, base + r->consumed + r->pos + 8 * count);
+    return stream_skip_bytes(r, 8 * count);
+}
+
+static PyObject *
+stream_read_all(stream_reader *r, Py_ssize_t start, Py_ssize_t stop,
+                CTXT_Object *context)
+{
+    PyObject *result, *item;
+    PY_LONG_LONG base = -1;
+    stream_off_t count, index;
+    Py_ssize_t i, len;
+
+    if (start < 0 || (stop >= 0 && stop < start)) {
+        VALUE_ERROR("start and stop must satisfy 0 <= start <= stop");
+        return NULL;
+    }
+
+    if (r->file)
+        base = stream_tell(r->file);
+    if (stream_need(r, STREAM_HEADER_SIZE) < 0)
+        return NULL;
+    if (memcmp(r->buf + r->pos, STREAM_MAGIC, 8)) {
+        VALUE_ERROR("invalid record stream (bad header)");
+        return NULL;
+    }
+    count = stream_get_off(r->buf + r->pos + 8);
+    index = stream_get_off(r->buf + r->pos + 16);
+    r->pos += STREAM_HEADER_SIZE;
+
+    if (start > 0 && stream_skip_to(r, start, count, index, base) < 0)
+        return NULL;
+
+    if (!(result = PyList_New(0)))
+        return NULL;
+
+    for (i = start; stop < 0 || i < stop; i++) {
+        if (stream_get_length(r, &len) < 0)
+            goto error;
+        if (len == 0) {
+            r->pos--;
+            break;
+        }
+        if (stream_need(r, len) < 0)
+            goto error;
+        if (!(item = GMPy_MPANY_From_CBinary(r->buf + r->pos, len, context)))
+            goto error;
+        r->pos += len;
+        if (PyList_Append(result, item) < 0) {
+            Py_DECREF(item);
+            goto error;
+        }
+        Py_DECREF(item);
+    }
+
+    if (r->file && stream_finish(r, count, index, base) < 0)
+        goto error;
+    return result;
+
+  error:
+    Py_DECREF(result);
+    return NULL;
+}
+
+static int
+stream_parse_stop(PyObject *arg, Py_ssize_t *stop)
+{
+    if (arg == Py_None) {
+        *stop = -1;
+        return 0;
+    }
+    *stop = PyIntOrLong_AsSsize_t(arg);
+    if (*stop == -1 && PyErr_Occurred())
+        return -1;
+    if (*stop < 0) {
+        VALUE_ERROR("start and stop must satisfy 0 <= start <= stop");
+        return -1;
+    }
+    return 0;
+}
+
+PyDoc_STRVAR(doc_unpack_many,
+"unpack_many(data, start=0, stop=None) -> list\n"
+"Return a list of the values stored in data by pack_many() or\n"
+"dump_many(). data may be any object supporting the buffer protocol.\n"
+"If start or stop are given, only the records start <= i < stop are\n"
+"decoded; the index is used to locate record start directly.");
+
+static PyObject *
+GMPy_MPANY_Unpack_Many(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    stream_reader r = { NULL, 0, 0, 0, NULL, 0 };
+    Py_ssize_t start = 0, stop;
+    PyObject *data, *stop_obj = Py_None, *result;
+    Py_buffer view;
+    CTXT_Object *context = NULL;
+    static char *kwlist[] = {"data", "start", "stop", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "O|nO", kwlist,
+                                     &data, &start, &stop_obj))
+        return NULL;
+    if (stream_parse_stop(stop_obj, &stop) < 0)
+        return NULL;
+
+    CHECK_CONTEXT(context);
+
+    if (PyObject_GetBuffer(data, &view, PyBUF_SIMPLE) < 0)
+        return NULL;
+    r.buf = (unsigned char*)view.buf;
+    r.end = r.alloc = view.len;
+    result = stream_read_all(&r, start, stop, context);
+    PyBuffer_Release(&view);
+    return result;
+}
+
+PyDoc_STRVAR(doc_load_many,
+"load_many(file, start=0, stop=None) -> list\n"
+"Return a list of the values written to the binary file object file\n"
+"by dump_many() or pack_many(). If start or stop are given, only the\n"
+"records start <= i < stop are decoded. When file supports seek(), the\n"
+"index is used to seek to record start. The file is left positioned\n"
+"just past the end of the stream.");
+
+static PyObject *
+GMPy_MPANY_Load_Many(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    stream_reader r = { NULL, 0, 0, 0, NULL, 0 };
+    Py_ssize_t start = 0, stop;
+    PyObject *stop_obj = Py_None, *result;
+    CTXT_Object *context = NULL;
+    static char *kwlist[] = {"file", "start", "stop", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "O|nO", kwlist,
+                                     &(r.file), &start, &stop_obj))
+        return NULL;
+    if (stream_parse_stop(stop_obj, &stop) < 0)
+        return NULL;
+
+    CHECK_CONTEXT(context);
+
+    result = stream_read_all(&r, start, stop, context);
+    PyMem_Free(r.buf);
+    return result;
+}
+
+/* Support for pickle protocol 5.
+ *
+ * For protocol 5 and values with at least GMPY_PICKLE_BUFFER_MIN bytes of
+ * limb data, __reduce_ex__() returns the limbs as PickleBuffer objects so
+ * the pickler can transmit them out-of-band (or, in-band, copy them once
+ * directly into the pickle stream). The reconstructor is _from_buffer():
+ *
+ *   _from_buffer(code, limb_bytes, endian, payload)
+ *
+ * code is the to_binary() type byte (1 = mpz, 3 = mpq, 4 = mpfr, 5 = mpc),
+ * limb_bytes and endian (-1 little, 1 big) describe the limbs of the
+ * writer so a pickle can still be loaded on a different platform.
+ *
+ *   mpz:  payload = (sign, limbs)
+ *   mpq:  payload = (sign, numerator limbs, denominator limbs)
+ *   mpfr: payload = (rc, part)
+ *   mpc:  payload = (rc, real part, imag part)
+ *
+ * An mpfr part is (precision, kind, signbit, exponent, limbs) where kind
+ * is 0 for regular numbers, 1 for zero, 2 for NaN, and 3 for infinity;
+ * limbs is None unless kind is 0. Smaller values, earlier protocols, and
+ * xmpz (which is mutable) keep using from_binary()/to_binary().
+ */
+
+#define GMPY_PICKLE_BUFFER_MIN 1024
+
+static int
+limb_endian(void)
+{
+    mp_limb_t one = 1;
+
+    return (*(unsigned char*)&one) ? -1 : 1;
+}
+
+#if PY_VERSION_HEX >= 0x03080000
+
+/* A read-only buffer over the limbs of an immutable gmpy2 object. The
+ * object is kept alive for as long as the buffer exists.
+ */
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *owner;
+    void *ptr;
+    Py_ssize_t len;
+} GMPy_LimbView_Object;
+
+static int
+GMPy_LimbView_GetBuffer(GMPy_LimbView_Object *self, Py_buffer *view, int flags)
+{
+    return PyBuffer_FillInfo(view, (PyObject*)self, self->ptr, self->len, 1, flags);
+}
+
+static void
+GMPy_LimbView_Dealloc(GMPy_LimbView_Object *self)
+{
+    Py_XDECREF(self->owner);
+    PyObject_Del(self);
+}
+
+static PyBufferProcs GMPy_LimbView_as_buffer = {
+    (getbufferproc)GMPy_LimbView_GetBuffer,
+    NULL
+};
+
+static PyTypeObject GMPy_LimbView_Type =
+{
+    PyVarObject_HEAD_INIT(0, 0)
+    "gmpy2 limb view",                      /* tp_name          */
+    sizeof(GMPy_LimbView_Object),           /* tp_basicsize     */
+        0,                                  /* tp_itemsize      */
+    (destructor) GMPy_LimbView_Dealloc,     /* tp_dealloc       */
+        0,                                  /* tp_print         */
+        0,                                  /* tp_getattr       */
+        0,                                  /* tp_setattr       */
+        0,                                  /* tp_reserved      */
+        0,                                  /* tp_repr          */
+        0,                                  /* tp_as_number     */
+        0,                                  /* tp_as_sequence   */
+        0,                                  /* tp_as_mapping    */
+        0,                                  /* tp_hash          */
+        0,                                  /* tp_call          */
+        0,                                  /* tp_str           */
+        0,                                  /* tp_getattro      */
+        0,                                  /* tp_setattro      */
+    &GMPy_LimbView_as_buffer,               /* tp_as_buffer     */
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags         */
+    "Read-only view of the limbs of a gmpy2 object",
+};
+
+static PyObject *
+pickle_limbs(PyObject *owner, mp_limb_t *d, Py_ssize_t n)
+{
+    GMPy_LimbView_Object *view;
+    PyObject *result;
+
+    if (!(view = PyObject_New(GMPy_LimbView_Object, &GMPy_LimbView_Type)))
+        return NULL;
+    Py_INCREF(owner);
+    view->owner = owner;
+    view->ptr = d;
+    view->len = n * (Py_ssize_t)sizeof(mp_limb_t);
+    result = PyPickleBuffer_FromObject((PyObject*)view);
+    Py_DECREF((PyObject*)view);
+    return result;
+}
+
+static PyObject *
+pickle_mpfr_part(PyObject *owner, mpfr_ptr f)
+{
+    PyObject *limbs;
+    int kind;
+
+    if (mpfr_regular_p(f)) {
+        if (!(limbs = pickle_limbs(owner, f->_mpfr_d,
+                    (mpfr_get_prec(f) + mp_bits_per_limb - 1) / mp_bits_per_limb)))
+            return NULL;
+        return Py_BuildValue("(niilN)", (Py_ssize_t)mpfr_get_prec(f), 0,
+                             mpfr_signbit(f) ? 1 : 0, (long)f->_mpfr_exp, limbs);
+    }
+    if (mpfr_zero_p(f))
+        kind = 1;
+    else if (mpfr_nan_p(f))
+        kind = 2;
+    else
+        kind = 3;
+    return Py_BuildValue("(niiiO)", (Py_ssize_t)mpfr_get_prec(f), kind,
+                         mpfr_signbit(f) ? 1 : 0, 0, Py_None);
+}
+
+#endif
+
+static size_t
+mpfr_limb_bytes(mpfr_srcptr f)
+{
+    if (!mpfr_regular_p(f))
+        return 0;
+    return ((mpfr_get_prec(f) + mp_bits_per_limb - 1) / mp_bits_per_limb) *
+           sizeof(mp_limb_t);
+}
+
+/* Return gmpy2.<name>, looked up once. */
+
+static PyObject *
+binary_module_function(PyObject **cache, const char *name)
+{
+    PyObject *module;
+
+    if (!*cache) {
+        if (!(module = PyImport_ImportModule("gmpy2")))
+            return NULL;
+        *cache = PyObject_GetAttrString(module, name);
+        Py_DECREF(module);
+    }
+    return *cache;
+}
+
+static PyObject *from_binary_function = NULL;
+static PyObject *from_buffer_function = NULL;
+
+PyDoc_STRVAR(GMPy_doc_method_reduce,
+"x.__reduce__() -> tuple\n\n"
+"Support for pickle and copy. The value is stored in the format used by\n"
+"to_binary().");
+
+/* __reduce__() for the mutable types xmpq, xmpfr, and xmpc. The state of
+ * an xmpq is restored by xmpq.__setstate__().
+ */
+
+static PyObject *
+GMPy_MPANY_Method_Reduce(PyObject *self, PyObject *other)
+{
+    PyObject *func, *temp;
+
+    if (!(func = binary_module_function(&from_binary_function, "from_binary")))
+        return NULL;
+
+    if (!(temp = GMPy_MPANY_To_Binary(NULL, self)))
+        return NULL;
+
+    if (XMPQ_Check(self))
+        return Py_BuildValue("(O(N)(ik))", func, temp,
+                             ((XMPQ_Object*)self)->lazy,
+                             (unsigned long)((XMPQ_Object*)self)->limit);
+    return Py_BuildValue("(O(N))", func, temp);
+}
+
+PyDoc_STRVAR(GMPy_doc_method_reduce_ex,
+"x.__reduce_ex__(protocol) -> tuple\n\n"
+"Support for pickle. With protocol 5 or later, the limbs of large values\n"
+"are exported as PickleBuffer objects that can be sent out-of-band.");
+
+static PyObject *
+GMPy_MPANY_Method_ReduceEx(PyObject *self, PyObject *args)
+{
+    PyObject *func, *temp;
+    int protocol = 0;
+    size_t size = 0;
+
+    if (!PyArg_ParseTuple(args, "|i", &protocol))
+        return NULL;
+
+    if (MPZ_Check(self))
+        size = mpz_size(MPZ(self)) * sizeof(mp_limb_t);
+    else if (MPQ_Check(self))
+        size = (mpz_size(mpq_numref(MPQ(self))) +
+                mpz_size(mpq_denref(MPQ(self)))) * sizeof(mp_limb_t);
+    else if (MPFR_Check(self))
+        size = mpfr_limb_bytes(MPFR(self));
+    else if (MPC_Check(self))
+        size = mpfr_limb_bytes(mpc_realref(MPC(self))) +
+               mpfr_limb_bytes(mpc_imagref(MPC(self)));
+
+#if PY_VERSION_HEX >= 0x03080000
+    if (protocol >= 5 && size >= GMPY_PICKLE_BUFFER_MIN) {
+        PyObject *payload = NULL;
+        int code;
+
+        if (!(func = binary_module_function(&from_buffer_function, "_from_buffer")))
+            return NULL;
+
+        if (MPZ_Check(self)) {
+            if ((temp = pickle_limbs(self, MPZ(self)->_mp_d, mpz_size(MPZ(self)))))
+                payload = Py_BuildValue("(iN)", mpz_sgn(MPZ(self)), temp);
+            code = 0x01;
+        }
+        else if (MPQ_Check(self)) {
+            mpz_ptr num = mpq_numref(MPQ(self)), den = mpq_denref(MPQ(self));
+            PyObject *numlimbs, *denlimbs = NULL;
+
+            if ((numlimbs = pickle_limbs(self, num->_mp_d, mpz_size(num))) &&
+                (denlimbs = pickle_limbs(self, den->_mp_d, mpz_size(den))))
+                payload = Py_BuildValue("(iOO)", mpz_sgn(num), numlimbs, denlimbs);
+            Py_XDECREF(numlimbs);
+            Py_XDECREF(denlimbs);
+            code = 0x03;
+        }
+        else if (MPFR_Check(self)) {
+            if ((temp = pickle_mpfr_part(self, MPFR(self))))
+                payload = Py_BuildValue("(iN)", ((MPFR_Object*)self)->rc, temp);
+            code = 0x04;
+        }
+        else {
+            PyObject *real, *imag = NULL;
+
+            if ((real = pickle_mpfr_part(self, mpc_realref(MPC(self)))) &&
+                (imag = pickle_mpfr_part(self, mpc_imagref(MPC(self)))))
+                payload = Py_BuildValue("(iOO)", ((MPC_Object*)self)->rc, real, imag);
+            Py_XDECREF(real);
+            Py_XDECREF(imag);
+            code = 0x05;
+        }
+
+        if (!payload)
+            return NULL;
+        return Py_BuildValue("(O(iiiN))", func, code, (int)sizeof(mp_limb_t),
+                             limb_endian(), payload);
+    }
+#endif
+
+    if (!(func = binary_module_function(&from_binary_function, "from_binary")) ||
+        !(temp = GMPy_MPANY_To_Binary(NULL, self)))
+        return NULL;
+    return Py_BuildValue("(O(N))", func, temp);
+}
+
+static int
+from_buffer_mpz(mpz_ptr z, PyObject *obj, int limbbytes, int endian)
+{
+    Py_buffer view;
+
+    if (PyObject_GetBuffer(obj, &view, PyBUF_SIMPLE) < 0)
+        return -1;
+    if (view.len % limbbytes) {
+        PyBuffer_Release(&view);
+        VALUE_ERROR("invalid buffer for _from_buffer()");
+        return -1;
+    }
+    mpz_import(z, view.len / limbbytes, -1, limbbytes, endian, 0, view.buf);
+    PyBuffer_Release(&view);
+    return 0;
+}
+
+/* Parse the precision of an mpfr part so the result can be allocated. */
+
+static int
+from_buffer_prec(PyObject *part, mpfr_prec_t *prec)
+{
+    Py_ssize_t temp;
+
+    if (!PyTuple_Check(part) || PyTuple_GET_SIZE(part) != 5) {
+        TYPE_ERROR("invalid mpfr state for _from_buffer()");
+        return -1;
+    }
+    temp = PyIntOrLong_AsSsize_t(PyTuple_GET_ITEM(part, 0));
+    if (temp == -1 && PyErr_Occurred())
+        return -1;
+    if (temp < MPFR_PREC_MIN || temp > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid precision for _from_buffer()");
+        return -1;
+    }
+    *prec = (mpfr_prec_t)temp;
+    return 0;
+}
+
+static int
+from_buffer_mpfr(mpfr_ptr f, PyObject *part, int limbbytes, int endian)
+{
+    Py_ssize_t prec;
+    int kind, sign;
+    long exp;
+    PyObject *limbs;
+    Py_buffer view;
+    size_t n;
+
+    if (!PyArg_ParseTuple(part, "niilO", &prec, &kind, &sign, &exp, &limbs))
+        return -1;
+
+    switch (kind) {
+        case 1:
+            mpfr_set_zero(f, sign ? -1 : 1);
+            return 0;
+        case 2:
+            mpfr_set_nan(f);
+            return 0;
+        case 3:
+            mpfr_set_inf(f, sign ? -1 : 1);
+            return 0;
+        case 0:
+            break;
+        default:
+            VALUE_ERROR("invalid mpfr state for _from_buffer()");
+            return -1;
+    }
+
+    if (exp < mpfr_get_emin_min() || exp > mpfr_get_emax_max()) {
+        VALUE_ERROR("invalid mpfr state for _from_buffer()");
+        return -1;
+    }
+    if (PyObject_GetBuffer(limbs, &view, PyBUF_SIMPLE) < 0)
+        return -1;
+
+    n = (prec + mp_bits_per_limb - 1) / mp_bits_per_limb;
+    if (limbbytes == sizeof(mp_limb_t) && endian == limb_endian() &&
+        (size_t)view.len == n * sizeof(mp_limb_t)) {
+        /* Same limb layout: copy the significand directly. */
+        mp_limb_t *d = (mp_limb_t*)view.buf, top, low;
+        int unused = (int)(n * mp_bits_per_limb - prec);
+
+        memcpy(&top, d + n - 1, sizeof(mp_limb_t));
+        memcpy(&low, d, sizeof(mp_limb_t));
+        if (!(top >> (mp_bits_per_limb - 1)) ||
+            (unused && (low & (((mp_limb_t)1 << unused) - 1)))) {
+            PyBuffer_Release(&view);
+            VALUE_ERROR("invalid mpfr state for _from_buffer()");
+            return -1;
+        }
+        mpfr_set_ui(f, 1, MPFR_RNDN);
+        memcpy(f->_mpfr_d, view.buf, view.len);
+        f->_mpfr_exp = exp;
+    }
+    else {
+        /* Different limb layout: the significand read as an integer m
+         * gives the value m * 2**(exp - bits(m)). */
+        mpz_t m;
+
+        if (limbbytes <= 0 || view.len == 0 || view.len % limbbytes) {
+            PyBuffer_Release(&view);
+            VALUE_ERROR("invalid mpfr state for _from_buffer()");
+            return -1;
+        }
+        mpz_init(m);
+        mpz_import(m, view.len / limbbytes, -1, limbbytes, endian, 0, view.buf);
+        if (mpz_sizeinbase(m, 2) != (size_t)view.len * 8) {
+            mpz_clear(m);
+            PyBuffer_Release(&view);
+            VALUE_ERROR("invalid mpfr state for _from_buffer()");
+            return -1;
+        }
+        mpfr_set_z_2exp(f, m, exp - (long)view.len * 8, MPFR_RNDN);
+        mpz_clear(m);
+    }
+    PyBuffer_Release(&view);
+    if (sign)
+        mpfr_neg(f, f, MPFR_RNDN);
+    return 0;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_from_buffer,
+"_from_buffer(code, limb_bytes, endian, payload) -> gmpy2 object\n\n"
+"Reconstruct an mpz, mpq, mpfr, or mpc from the state returned by\n"
+"__reduce_ex__() for pickle protocol 5. For internal use by pickle.");
+
+static PyObject *
+GMPy_MPANY_From_Buffer(PyObject *self, PyObject *args)
+{
+    int code, limbbytes, endian, sign, rc;
+    PyObject *payload, *a, *b;
+    CTXT_Object *context = NULL;
+
+    if (!PyArg_ParseTuple(args, "iiiO!", &code, &limbbytes, &endian,
+                          &PyTuple_Type, &payload))
+        return NULL;
+
+    if (limbbytes <= 0 || (endian != -1 && endian != 1)) {
+        VALUE_ERROR("invalid limb format for _from_buffer()");
+        return NULL;
+    }
+
+    CHECK_CONTEXT(context);
+
+    switch (code) {
+        case 0x01: {
+            MPZ_Object *result;
+
+            if (!PyArg_ParseTuple(payload, "iO", &sign, &a))
+                return NULL;
+            if (!(result = GMPy_MPZ_New(context)))
+                return NULL;
+            if (from_buffer_mpz(result->z, a, limbbytes, endian) < 0) {
+                Py_DECREF((PyObject*)result);
+                return NULL;
+            }
+            if (sign < 0)
+                mpz_neg(result->z, result->z);
+            return (PyObject*)result;
+        }
+        case 0x03: {
+            MPQ_Object *result;
+
+            if (!PyArg_ParseTuple(payload, "iOO", &sign, &a, &b))
+                return NULL;
+            if (!(result = GMPy_MPQ_New(context)))
+                return NULL;
+            if (from_buffer_mpz(mpq_numref(result->q), a, limbbytes, endian) < 0 ||
+                from_buffer_mpz(mpq_denref(result->q), b, limbbytes, endian) < 0) {
+                Py_DECREF((PyObject*)result);
+                return NULL;
+            }
+            if (mpz_sgn(mpq_denref(result->q)) == 0) {
+                Py_DECREF((PyObject*)result);
+                ZERO_ERROR("invalid denominator for _from_buffer()");
+                return NULL;
+            }
+            /* The state comes from a canonical mpq; pickles are trusted
+             * data, so avoid a gcd on potentially huge values. */
+            if (sign < 0)
+                mpq_neg(result->q, result->q);
+            return (PyObject*)result;
+        }
+        case 0x04: {
+            MPFR_Object *result;
+            mpfr_prec_t prec;
+
+            if (!PyArg_ParseTuple(payload, "iO", &rc, &a) ||
+                from_buffer_prec(a, &prec) < 0)
+                return NULL;
+            if (!(result = GMPy_MPFR_New(prec, context)))
+                return NULL;
+            if (from_buffer_mpfr(result->f, a, limbbytes, endian) < 0) {
+                Py_DECREF((PyObject*)result);
+                return NULL;
+            }
+            result->rc = rc;
+            return (PyObject*)result;
+        }
+        case 0x05: {
+            MPC_Object *result;
+            mpfr_prec_t rprec, iprec;
+
+            if (!PyArg_ParseTuple(payload, "iOO", &rc, &a, &b) ||
+                from_buffer_prec(a, &rprec) < 0 ||
+                from_buffer_prec(b, &iprec) < 0)
+                return NULL;
+            if (!(result = GMPy_MPC_New(rprec, iprec, context)))
+                return NULL;
+            if (from_buffer_mpfr(mpc_realref(result->c), a, limbbytes, endian) < 0 ||
+                from_buffer_mpfr(mpc_imagref(result->c), b, limbbytes, endian) < 0) {
+                Py_DECREF((PyObject*)result);
+                return NULL;
+            }
+            result->rc = rc;
+            return (PyObject*)result;
+        }
+        default:
+            VALUE_ERROR("invalid type code for _from_buffer()");
+            return NULL;
+    }
+}
@@ -44,6 +44,17 @@ static PyObject * GMPy_MPFR_From_Old_Binary(PyObject *self, PyObject *other);
 
 static PyObject * GMPy_MPANY_From_Binary(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPANY_To_Binary(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPANY_From_CBinary(unsigned char *buffer, Py_ssize_t len,
+                                          CTXT_Object *context);
+
+static PyObject * GMPy_MPANY_Pack_Many(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPANY_Unpack_Many(PyObject *self, PyObject *args, PyObject *keywds);
+static PyObject * GMPy_MPANY_Dump_Many(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPANY_Load_Many(PyObject *self, PyObject *args, PyObject *keywds);
+
+static PyObject * GMPy_MPANY_Method_ReduceEx(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPANY_Method_Reduce(PyObject *self, PyObject *other);
+static PyObject * GMPy_MPANY_From_Buffer(PyObject *self, PyObject *args);
 
 static PyObject * GMPy_MPZ_To_Binary(MPZ_Object *self);
 static PyObject * GMPy_XMPZ_To_Binary(XMPZ_Object *self);
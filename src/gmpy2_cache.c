@@ -52,6 +52,87 @@ set_gmpympzcache(void)
     global.gmpympzcache = realloc(global.gmpympzcache, sizeof(MPZ_Object)*global.cache_size);
 }
 
+/* Interned small mpz values. The table holds the only permanent reference
+ * to each object so they are never deallocated. init_gmpympzintern returns
+ * -1 if an object could not be created.
+ */
+
+#if MPZ_INTERN_MAX >= MPZ_INTERN_MIN
+static MPZ_Object *gmpympzintern[MPZ_INTERN_MAX - MPZ_INTERN_MIN + 1];
+#endif
+
+static int
+init_gmpympzintern(void)
+{
+#if MPZ_INTERN_MAX >= MPZ_INTERN_MIN
+    long i;
+    MPZ_Object *temp;
+
+    for (i = MPZ_INTERN_MIN; i <= MPZ_INTERN_MAX; i++) {
+        if (!(temp = PyObject_New(MPZ_Object, &MPZ_Type))) {
+            /* LCOV_EXCL_START */
+            return -1;
+            /* LCOV_EXCL_STOP */
+        }
+        mpz_init_set_si(temp->z, i);
+        temp->hash_cache = -1;
+        gmpympzintern[i - MPZ_INTERN_MIN] = temp;
+    }
+#endif
+    return 0;
+}
+
+/* GMPy_MPZ_GetSmall returns 1 and stores the value of z in *v if z is a
+ * valid operand for computing an interned result with C longs (see
+ * MPZ_INTERN_OPERAND_MAX). Otherwise it returns 0. It always returns 0 when
+ * interning is disabled.
+ */
+
+static int
+GMPy_MPZ_GetSmall(mpz_srcptr z, long *v)
+{
+#if MPZ_INTERN_MAX >= MPZ_INTERN_MIN
+    switch (z->_mp_size) {
+    case 0:
+        *v = 0;
+        return 1;
+    case 1:
+        if (z->_mp_d[0] <= (mp_limb_t)MPZ_INTERN_OPERAND_MAX) {
+            *v = (long)z->_mp_d[0];
+            return 1;
+        }
+        break;
+    case -1:
+        if (z->_mp_d[0] <= (mp_limb_t)MPZ_INTERN_OPERAND_MAX) {
+            *v = -(long)z->_mp_d[0];
+            return 1;
+        }
+        break;
+    }
+#endif
+    return 0;
+}
+
+/* GMPy_MPZ_Intern returns a new reference to the interned mpz with value v.
+ * The caller must check MPZ_IS_INTERNED(v) first.
+ */
+
+static PyObject *
+GMPy_MPZ_Intern(long v)
+{
+#if MPZ_INTERN_MAX >= MPZ_INTERN_MIN
+    PyObject *result = (PyObject*)gmpympzintern[v - MPZ_INTERN_MIN];
+
+    Py_INCREF(result);
+    return result;
+#else
+    /* LCOV_EXCL_START */
+    SYSTEM_ERROR("mpz interning is disabled");
+    return NULL;
+    /* LCOV_EXCL_STOP */
+#endif
+}
+
 /* GMPy_MPZ_New returns a reference to a new MPZ_Object. Its value
  * is initialized to 0.
  */
@@ -104,6 +185,8 @@ GMPy_MPZ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
     argc = PyTuple_GET_SIZE(args);
 
     if (argc == 0) {
+        if (MPZ_IS_INTERNED(0))
+            return GMPy_MPZ_Intern(0);
         return (PyObject*)GMPy_MPZ_New(context);
     }
 
@@ -116,14 +199,16 @@ GMPy_MPZ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
         }
 
         if (PyIntOrLong_Check(n)) {
+            if (IS_SMALL_PYINT(n) && MPZ_IS_INTERNED(SMALL_PYINT_AS_LONG(n)))
+                return GMPy_MPZ_Intern(SMALL_PYINT_AS_LONG(n));
             return (PyObject*)GMPy_MPZ_From_PyIntOrLong(n, context);
         }
 
-        if (MPQ_Check(n)) {
+        if (MPQ_Check(n) || XMPQ_Check(n)) {
             return (PyObject*)GMPy_MPZ_From_MPQ((MPQ_Object*)n, context);
         }
 
-        if (MPFR_Check(n)) {
+        if (CHECK_MPFRANY(n)) {
             return (PyObject*)GMPy_MPZ_From_MPFR((MPFR_Object*)n, context);
         }
 
@@ -282,11 +367,11 @@ GMPy_XMPZ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
             return (PyObject*)GMPy_XMPZ_From_PyIntOrLong(n, context);
         }
 
-        if (MPQ_Check(n)) {
+        if (MPQ_Check(n) || XMPQ_Check(n)) {
             return (PyObject*)GMPy_XMPZ_From_MPQ((MPQ_Object*)n, context);
         }
 
-        if (MPFR_Check(n)) {
+        if (CHECK_MPFRANY(n)) {
             return (PyObject*)GMPy_XMPZ_From_MPFR((MPFR_Object*)n, context);
         }
 
@@ -520,6 +605,93 @@ GMPy_MPQ_Dealloc(MPQ_Object *self)
     }
 }
 
+static XMPQ_Object *
+GMPy_XMPQ_New(CTXT_Object *context)
+{
+    XMPQ_Object *result = NULL;
+
+    if (!(result = PyObject_New(XMPQ_Object, &XMPQ_Type))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpq_init(result->q);
+    result->hash_cache = -1;
+    result->lazy = 0;
+    result->canonical = 1;
+    result->limit = GMPY_XMPQ_LIMIT;
+    return result;
+}
+
+/* xmpq() accepts the same arguments as mpq() plus the keyword arguments
+ * 'lazy' and 'limit'. The remaining arguments are passed to mpq().
+ */
+
+static PyObject *
+GMPy_XMPQ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    XMPQ_Object *result = NULL;
+    PyObject *temp = NULL, *kw = NULL, *arg;
+    CTXT_Object *context = NULL;
+    int lazy = 0;
+    long limit = GMPY_XMPQ_LIMIT;
+
+    if (type != &XMPQ_Type) {
+        TYPE_ERROR("xmpq.__new__() requires xmpq type");
+        return NULL;
+    }
+
+    if (keywds && PyDict_Size(keywds)) {
+        if (!(kw = PyDict_Copy(keywds))) {
+            return NULL;
+        }
+        if ((arg = PyDict_GetItemString(kw, "lazy"))) {
+            if ((lazy = PyObject_IsTrue(arg)) < 0) {
+                goto error;
+            }
+            PyDict_DelItemString(kw, "lazy");
+        }
+        if ((arg = PyDict_GetItemString(kw, "limit"))) {
+            limit = PyIntOrLong_AsLong(arg);
+            if (limit == -1 && PyErr_Occurred()) {
+                goto error;
+            }
+            if (limit < 1) {
+                VALUE_ERROR("limit for xmpq() must be > 0");
+                goto error;
+            }
+            PyDict_DelItemString(kw, "limit");
+        }
+    }
+
+    if (!(temp = GMPy_MPQ_NewInit(&MPQ_Type, args, kw))) {
+        goto error;
+    }
+
+    if (!MPQ_Check(temp)) {
+        TYPE_ERROR("xmpq() requires numeric or string argument");
+        goto error;
+    }
+
+    if ((result = GMPy_XMPQ_New(context))) {
+        mpq_set(result->q, MPQ(temp));
+        result->lazy = lazy;
+        result->limit = (mp_bitcnt_t)limit;
+    }
+
+  error:
+    Py_XDECREF(kw);
+    Py_XDECREF(temp);
+    return (PyObject*)result;
+}
+
+static void
+GMPy_XMPQ_Dealloc(XMPQ_Object *self)
+{
+    mpq_clear(self->q);
+    PyObject_Del(self);
+}
+
 /* Caching logic for Pympfr. */
 
 static void
@@ -702,6 +874,103 @@ GMPy_MPFR_Dealloc(MPFR_Object *self)
     }
 }
 
+/* xmpfr instances are meant to be long-lived accumulators so they are not
+ * recycled through the mpfr cache.
+ */
+
+static XMPFR_Object *
+GMPy_XMPFR_New(mpfr_prec_t bits, CTXT_Object *context)
+{
+    XMPFR_Object *result;
+
+    if (bits < 2) {
+        CHECK_CONTEXT(context);
+        bits = GET_MPFR_PREC(context);
+    }
+
+    if (bits < MPFR_PREC_MIN || bits > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for precision");
+        return NULL;
+    }
+
+    if (!(result = PyObject_New(XMPFR_Object, &XMPFR_Type))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpfr_init2(result->f, bits);
+    result->hash_cache = -1;
+    result->rc = 0;
+    return result;
+}
+
+static PyObject *
+GMPy_XMPFR_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    XMPFR_Object *result = NULL;
+    MPFR_Object *temp = NULL;
+    CTXT_Object *context = NULL;
+    PyObject *n = NULL;
+    mpfr_prec_t prec = 0;
+    static char *kwlist[] = {"n", "precision", NULL};
+
+    if (type != &XMPFR_Type) {
+        TYPE_ERROR("xmpfr.__new__() requires xmpfr type");
+        return NULL;
+    }
+
+    CHECK_CONTEXT(context);
+
+    if (!(PyArg_ParseTupleAndKeywords(args, keywds, "|Ol", kwlist, &n, &prec))) {
+        return NULL;
+    }
+
+    if (prec < 0) {
+        VALUE_ERROR("precision for xmpfr() must be >= 0");
+        return NULL;
+    }
+
+    if (!n) {
+        if ((result = GMPy_XMPFR_New(prec, context))) {
+            mpfr_set_ui(result->f, 0, MPFR_RNDN);
+        }
+        return (PyObject*)result;
+    }
+
+    if (PyStrOrUnicode_Check(n)) {
+        temp = GMPy_MPFR_From_PyStr(n, 0, prec, context);
+    }
+    else if (IS_REAL(n)) {
+        temp = GMPy_MPFR_From_Real(n, prec, context);
+    }
+    else {
+        TYPE_ERROR("xmpfr() requires numeric or string argument");
+        return NULL;
+    }
+
+    if (!temp) {
+        return NULL;
+    }
+
+    /* The temporary already has the requested precision, so the copy is
+     * exact and the rounding code of the conversion is preserved.
+     */
+
+    if ((result = GMPy_XMPFR_New(mpfr_get_prec(temp->f), context))) {
+        mpfr_set(result->f, temp->f, MPFR_RNDN);
+        result->rc = temp->rc;
+    }
+    Py_DECREF((PyObject*)temp);
+    return (PyObject*)result;
+}
+
+static void
+GMPy_XMPFR_Dealloc(XMPFR_Object *self)
+{
+    mpfr_clear(self->f);
+    PyObject_Del(self);
+}
+
 static void
 set_gmpympccache(void)
 {
@@ -963,6 +1232,9 @@ GMPy_MPC_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
         if (PyComplex_Check(arg0)) {
             result = GMPy_MPC_From_PyComplex(arg0, rprec, iprec, context);
         }
+        else if (XMPC_Check(arg0)) {
+            result = GMPy_MPC_From_XMPC((XMPC_Object*)arg0, rprec, iprec, context);
+        }
         else {
             result = GMPy_MPC_From_MPC((MPC_Object*)arg0, rprec, iprec, context);
         }
@@ -1004,3 +1276,81 @@ GMPy_MPC_Dealloc(MPC_Object *self)
     }
 }
 
+/* xmpc instances are meant to be long-lived accumulators so they are not
+ * recycled through the mpc cache.
+ */
+
+static XMPC_Object *
+GMPy_XMPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context)
+{
+    XMPC_Object *result;
+
+    if (rprec < 2) {
+        CHECK_CONTEXT(context);
+        rprec = GET_REAL_PREC(context);
+    }
+
+    if (iprec < 2) {
+        CHECK_CONTEXT(context);
+        iprec = GET_IMAG_PREC(context);
+    }
+
+    if (rprec < MPFR_PREC_MIN || rprec > MPFR_PREC_MAX ||
+        iprec < MPFR_PREC_MIN || iprec > MPFR_PREC_MAX) {
+        VALUE_ERROR("invalid value for precision");
+        return NULL;
+    }
+
+    if (!(result = PyObject_New(XMPC_Object, &XMPC_Type))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpc_init3(result->c, rprec, iprec);
+    result->hash_cache = -1;
+    result->rc = 0;
+    return result;
+}
+
+/* The arguments are parsed by mpc() and the result is copied exactly. */
+
+static PyObject *
+GMPy_XMPC_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    XMPC_Object *result = NULL;
+    PyObject *temp;
+    mpfr_prec_t rprec, iprec;
+
+    if (type != &XMPC_Type) {
+        TYPE_ERROR("xmpc.__new__() requires xmpc type");
+        return NULL;
+    }
+
+    if (!(temp = GMPy_MPC_NewInit(&MPC_Type, args, keywds))) {
+        return NULL;
+    }
+
+    if (!CHECK_MPCANY(temp)) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(temp);
+        TYPE_ERROR("xmpc() requires numeric or string argument");
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    mpc_get_prec2(&rprec, &iprec, MPC(temp));
+    if ((result = GMPy_XMPC_New(rprec, iprec, NULL))) {
+        mpc_set(result->c, MPC(temp), MPC_RNDNN);
+        result->rc = ((MPC_Object*)temp)->rc;
+    }
+    Py_DECREF(temp);
+    return (PyObject*)result;
+}
+
+static void
+GMPy_XMPC_Dealloc(XMPC_Object *self)
+{
+    mpc_clear(self->c);
+    PyObject_Del(self);
+}
+
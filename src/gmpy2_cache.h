@@ -45,6 +45,9 @@ static void          set_gmpyxmpzcache(void);
 static void          set_gmpympqcache(void);
 static void          set_gmpympfrcache(void);
 static void          set_gmpympccache(void);
+static int           init_gmpympzintern(void);
+static int           GMPy_MPZ_GetSmall(mpz_srcptr z, long *v);
+static PyObject *    GMPy_MPZ_Intern(long v);
 
 /* C-API functions */
 
@@ -76,9 +79,21 @@ static GMPy_MPFR_New_RETURN     GMPy_MPFR_New     GMPy_MPFR_New_PROTO;
 static GMPy_MPFR_NewInit_RETURN GMPy_MPFR_NewInit GMPy_MPFR_NewInit_PROTO;
 static GMPy_MPFR_Dealloc_RETURN GMPy_MPFR_Dealloc GMPy_MPFR_Dealloc_PROTO;
 
+static XMPQ_Object *  GMPy_XMPQ_New(CTXT_Object *context);
+static PyObject *    GMPy_XMPQ_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void          GMPy_XMPQ_Dealloc(XMPQ_Object *self);
+
+static XMPFR_Object * GMPy_XMPFR_New(mpfr_prec_t bits, CTXT_Object *context);
+static PyObject *    GMPy_XMPFR_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void          GMPy_XMPFR_Dealloc(XMPFR_Object *self);
+
 static MPC_Object *  GMPy_MPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context);
 static void          GMPy_MPC_Dealloc(MPC_Object *self);
 
+static XMPC_Object * GMPy_XMPC_New(mpfr_prec_t rprec, mpfr_prec_t iprec, CTXT_Object *context);
+static PyObject *    GMPy_XMPC_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void          GMPy_XMPC_Dealloc(XMPC_Object *self);
+
 #ifdef __cplusplus
 }
 #endif
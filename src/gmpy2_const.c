@@ -46,7 +46,7 @@ GMPy_Function_Const_Pi(PyObject *self, PyObject *args, PyObject *keywds)
     }
 
     if ((result = GMPy_MPFR_New(bits, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_pi(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
@@ -65,7 +65,7 @@ GMPy_Context_Const_Pi(PyObject *self, PyObject *args)
     CTXT_Object *context = (CTXT_Object*)self;
 
     if ((result = GMPy_MPFR_New(0, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_pi(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
@@ -93,7 +93,7 @@ GMPy_Function_Const_Euler(PyObject *self, PyObject *args, PyObject *keywds)
     }
 
     if ((result = GMPy_MPFR_New(bits, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_euler(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
@@ -112,7 +112,7 @@ GMPy_Context_Const_Euler(PyObject *self, PyObject *args)
     CTXT_Object *context = (CTXT_Object*)self;
 
     if ((result = GMPy_MPFR_New(0, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_euler(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
@@ -140,7 +140,7 @@ GMPy_Function_Const_Log2(PyObject *self, PyObject *args, PyObject *keywds)
     }
 
     if ((result = GMPy_MPFR_New(bits, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_log2(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
@@ -159,7 +159,7 @@ GMPy_Context_Const_Log2(PyObject *self, PyObject *args)
     CTXT_Object *context = (CTXT_Object*)self;
 
     if ((result = GMPy_MPFR_New(0, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_log2(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
@@ -187,7 +187,7 @@ GMPy_Function_Const_Catalan(PyObject *self, PyObject *args, PyObject *keywds)
     }
 
     if ((result = GMPy_MPFR_New(bits, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_catalan(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
@@ -206,7 +206,7 @@ GMPy_Context_Const_Catalan(PyObject *self, PyObject *args)
     CTXT_Object *context = (CTXT_Object*)self;
 
     if ((result = GMPy_MPFR_New(0, context))) {
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         result->rc = mpfr_const_catalan(result->f, GET_MPFR_ROUND(context));
         _GMPy_MPFR_Cleanup(&result, context);
     }
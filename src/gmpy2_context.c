@@ -84,6 +84,7 @@ GMPy_CTXT_New(void)
         result->ctx.imag_round = -1;
         result->ctx.allow_complex = 0;
         result->ctx.rational_division = 0;
+        result->ctx.track_flags = 1;
 
 #ifndef WITHOUT_THREADS
         result->tstate = NULL;
@@ -107,7 +108,103 @@ PyDoc_STRVAR(GMPy_doc_set_context,
 "set_context(context)\n\n"
 "Activate a context object controlling gmpy2 arithmetic.\n");
 
-#ifdef WITHOUT_THREADS
+#if defined(CONTEXTVARS)
+
+/* Begin support for contexts stored in a contextvars.ContextVar. Each
+ * asyncio task runs in its own copy of the contextvars context so changing
+ * the gmpy2 context in one task does not affect other tasks.
+ */
+
+/* Remember the current context. The cache is valid while the thread and the
+ * version of the thread's contextvars context are unchanged. Any change to
+ * a context variable, or switching to another contextvars context, changes
+ * the version.
+ */
+static void
+cache_current_context(CTXT_Object *context)
+{
+    PyThreadState *tstate = PyThreadState_GET();
+
+    Py_INCREF((PyObject*)context);
+    Py_XDECREF((PyObject*)cached_context);
+    cached_context = context;
+    if (tstate) {
+        cached_context->tstate = tstate;
+        cached_context_ver = tstate->context_ver;
+    }
+    else {
+        /* LCOV_EXCL_START */
+        cached_context->tstate = NULL;
+        /* LCOV_EXCL_STOP */
+    }
+}
+
+/* Get the context from the context variable. */
+static CTXT_Object *
+current_context_from_var(void)
+{
+    PyObject *cv_context, *token;
+
+    if (PyContextVar_Get(current_context_var, NULL, &cv_context) < 0) {
+        return NULL;
+    }
+
+    if (!cv_context) {
+        /* Set up a new context for the current contextvars context. */
+        if (!(cv_context = GMPy_CTXT_New())) {
+            return NULL;
+        }
+
+        if (!(token = PyContextVar_Set(current_context_var, cv_context))) {
+            Py_DECREF(cv_context);
+            return NULL;
+        }
+        Py_DECREF(token);
+    }
+
+    cache_current_context((CTXT_Object*)cv_context);
+    Py_DECREF(cv_context);
+
+    /* Borrowed reference kept alive by the context variable and the cache */
+    return (CTXT_Object*)cv_context;
+}
+
+/* Return borrowed reference to the current context. */
+static CTXT_Object *
+GMPy_current_context(void)
+{
+    PyThreadState *tstate = PyThreadState_GET();
+
+    if (cached_context && cached_context->tstate == tstate &&
+        tstate->context_ver == cached_context_ver) {
+        return (CTXT_Object*)cached_context;
+    }
+
+    return current_context_from_var();
+}
+
+/* Set the context variable to a new context. */
+static PyObject *
+GMPy_CTXT_Set(PyObject *self, PyObject *other)
+{
+    PyObject *token;
+
+    if (!CTXT_Check(other)) {
+        VALUE_ERROR("set_context() requires a context argument");
+        return NULL;
+    }
+
+    if (!(token = PyContextVar_Set(current_context_var, other))) {
+        return NULL;
+    }
+    Py_DECREF(token);
+
+    cache_current_context((CTXT_Object*)other);
+
+    Py_RETURN_NONE;
+}
+
+#elif defined(WITHOUT_THREADS)
 
 static PyObject *
 GMPy_CTXT_Set(PyObject *self, PyObject *other)
@@ -355,7 +452,7 @@ GMPy_CTXT_Repr_Slot(CTXT_Object *self)
     PyObject *result = NULL;
     int i = 0;
 
-    tuple = PyTuple_New(23);
+    tuple = PyTuple_New(24);
     if (!tuple)
         return NULL;
 
@@ -371,7 +468,8 @@ GMPy_CTXT_Repr_Slot(CTXT_Object *self)
             "        trap_erange=%s, erange=%s,\n"
             "        trap_divzero=%s, divzero=%s,\n"
             "        allow_complex=%s,\n"
-            "        rational_division=%s)"
+            "        rational_division=%s,\n"
+            "        track_flags=%s)"
             );
     if (!format) {
         Py_DECREF(tuple);
@@ -407,6 +505,7 @@ GMPy_CTXT_Repr_Slot(CTXT_Object *self)
     PyTuple_SET_ITEM(tuple, i++, PyBool_FromLong(self->ctx.divzero));
     PyTuple_SET_ITEM(tuple, i++, PyBool_FromLong(self->ctx.allow_complex));
     PyTuple_SET_ITEM(tuple, i++, PyBool_FromLong(self->ctx.rational_division));
+    PyTuple_SET_ITEM(tuple, i++, PyBool_FromLong(self->ctx.track_flags));
 
     if (!PyErr_Occurred())
         result = Py2or3String_Format(format, tuple);
@@ -468,7 +567,7 @@ _parse_context_args(CTXT_Object *ctxt, PyObject *kwargs)
         "real_round", "imag_round", "emax", "emin", "subnormalize",
         "trap_underflow", "trap_overflow", "trap_inexact",
         "trap_invalid", "trap_erange", "trap_divzero", "allow_complex",
-        "rational_division", NULL };
+        "rational_division", "track_flags", NULL };
 
     /* Create an empty dummy tuple to use for args. */
 
@@ -487,7 +586,7 @@ _parse_context_args(CTXT_Object *ctxt, PyObject *kwargs)
     x_trap_divzero = ctxt->ctx.traps & TRAP_DIVZERO;
 
     if (!(PyArg_ParseTupleAndKeywords(args, kwargs,
-            "|llliiilliiiiiiiii", kwlist,
+            "|llliiilliiiiiiiiii", kwlist,
             &ctxt->ctx.mpfr_prec,
             &ctxt->ctx.real_prec,
             &ctxt->ctx.imag_prec,
@@ -504,7 +603,8 @@ _parse_context_args(CTXT_Object *ctxt, PyObject *kwargs)
             &x_trap_erange,
             &x_trap_divzero,
             &ctxt->ctx.allow_complex,
-            &ctxt->ctx.rational_division))) {
+            &ctxt->ctx.rational_division,
+            &ctxt->ctx.track_flags))) {
         VALUE_ERROR("invalid keyword arguments for context");
         Py_DECREF(args);
         return 0;
@@ -633,14 +733,29 @@ GMPy_CTXT_Local(PyObject *self, PyObject *args, PyObject *kwargs)
         Py_INCREF((PyObject*)(result->new_context));
     }
     else {
+#ifdef CONTEXTVARS
+        /* The current context may be shared with other asyncio tasks so the
+         * changes are made to a copy and the original is restored on exit.
+         */
+        result->new_context = (CTXT_Object*)GMPy_CTXT_Copy((PyObject*)context, NULL);
+        if (!(result->new_context)) {
+            Py_DECREF((PyObject*)result);
+            return NULL;
+        }
+        result->old_context = context;
+        Py_INCREF((PyObject*)(result->old_context));
+#else
         result->new_context = context;
         Py_INCREF((PyObject*)(result->new_context));
+#endif
     }
 
-    result->old_context = (CTXT_Object*)GMPy_CTXT_Copy((PyObject*)context, NULL);
     if (!(result->old_context)) {
-        Py_DECREF((PyObject*)result);
-        return NULL;
+        result->old_context = (CTXT_Object*)GMPy_CTXT_Copy((PyObject*)context, NULL);
+        if (!(result->old_context)) {
+            Py_DECREF((PyObject*)result);
+            return NULL;
+        }
     }
 
     if (!_parse_context_args(result->new_context, kwargs)) {
@@ -688,7 +803,9 @@ PyDoc_STRVAR(GMPy_doc_context,
 "    allow_complex:     if True, allow mpfr functions to return mpc\n"
 "                       if False, mpfr functions cannot return an mpc\n"
 "    rational_division: if True, mpz/mpz returns an mpq\n"
-"                       if False, mpz/mpz follows default behavior\n");
+"                       if False, mpz/mpz follows default behavior\n"
+"    track_flags:       if True, update the exception flags\n"
+"                       if False, do not update the exception flags\n");
 #if 0
 "\nMethods\n"
 "    abs(x)          return absolute value of x\n"
@@ -949,6 +1066,7 @@ GETSET_BOOLEAN_BIT(trap_erange, TRAP_ERANGE);
 GETSET_BOOLEAN_BIT(trap_divzero, TRAP_DIVZERO);
 GETSET_BOOLEAN(allow_complex)
 GETSET_BOOLEAN(rational_division)
+GETSET_BOOLEAN(track_flags)
 
 static PyObject *
 GMPy_CTXT_Get_precision(CTXT_Object *self, void *closure)
@@ -1191,6 +1309,118 @@ GMPy_CTXT_Set_emax(CTXT_Object *self, PyObject *value, void *closure)
     return 0;
 }
 
+/* Support for the optional precision= and round= keyword arguments accepted
+ * by some functions. If no keywords are given, context is returned without
+ * being copied. Otherwise a copy of context is made in the caller provided
+ * *local, the keywords are applied to the copy using the same rules as the
+ * context attributes, and local is returned. The copy is never visible to
+ * Python code so it can be allocated on the stack. Returns NULL if an error
+ * occurred.
+ *
+ * The keywords apply to both mpfr and mpc results, so precision= also
+ * resets real_prec and imag_prec, and round= resets real_round and
+ * imag_round.
+ */
+
+static int
+_GMPy_CTXT_Set_Keyword(CTXT_Object *local, PyObject *prec, PyObject *round)
+{
+    if (prec) {
+        if (GMPy_CTXT_Set_precision(local, prec, NULL) < 0) {
+            return -1;
+        }
+        local->ctx.real_prec = GMPY_DEFAULT;
+        local->ctx.imag_prec = GMPY_DEFAULT;
+    }
+
+    if (round) {
+        if (GMPy_CTXT_Set_round(local, round, NULL) < 0) {
+            return -1;
+        }
+        local->ctx.real_round = GMPY_DEFAULT;
+        local->ctx.imag_round = GMPY_DEFAULT;
+    }
+    return 0;
+}
+
+#if PY_VERSION_HEX >= 0x03070000
+static CTXT_Object *
+GMPy_CTXT_From_Keywords(CTXT_Object *context, PyObject *const *values,
+                        PyObject *kwnames, CTXT_Object *local)
+{
+    PyObject *prec = NULL, *round = NULL, *name;
+    Py_ssize_t i, count;
+
+    if (!kwnames || !(count = PyTuple_GET_SIZE(kwnames))) {
+        return context;
+    }
+
+    for (i = 0; i < count; i++) {
+        name = PyTuple_GET_ITEM(kwnames, i);
+        if (!prec && !PyUnicode_CompareWithASCIIString(name, "precision")) {
+            prec = values[i];
+        }
+        else if (!round && !PyUnicode_CompareWithASCIIString(name, "round")) {
+            round = values[i];
+        }
+        else {
+            TYPE_ERROR("only precision and round are allowed as keyword arguments");
+            return NULL;
+        }
+    }
+
+    *local = *context;
+
+    if (_GMPy_CTXT_Set_Keyword(local, prec, round) < 0) {
+        return NULL;
+    }
+    return local;
+}
+#else
+static CTXT_Object *
+GMPy_CTXT_From_Keywords(CTXT_Object *context, PyObject *kwargs, CTXT_Object *local)
+{
+    PyObject *prec, *round;
+    Py_ssize_t count;
+
+    if (!kwargs || !(count = PyDict_Size(kwargs))) {
+        return context;
+    }
+
+    prec = PyDict_GetItemString(kwargs, "precision");
+    round = PyDict_GetItemString(kwargs, "round");
+
+    if (count != (prec != NULL) + (round != NULL)) {
+        TYPE_ERROR("only precision and round are allowed as keyword arguments");
+        return NULL;
+    }
+
+    *local = *context;
+
+    if (_GMPy_CTXT_Set_Keyword(local, prec, round) < 0) {
+        return NULL;
+    }
+    return local;
+}
+#endif
+
+/* Copy the exception flags raised while using a context returned by
+ * GMPy_CTXT_From_Keywords() back to the original context.
+ */
+
+static void
+GMPy_CTXT_Merge_Flags(CTXT_Object *context, CTXT_Object *local)
+{
+    if (context != local) {
+        context->ctx.underflow = local->ctx.underflow;
+        context->ctx.overflow = local->ctx.overflow;
+        context->ctx.inexact = local->ctx.inexact;
+        context->ctx.invalid = local->ctx.invalid;
+        context->ctx.erange = local->ctx.erange;
+        context->ctx.divzero = local->ctx.divzero;
+    }
+}
+
 #define ADD_GETSET(NAME) \
     {#NAME, \
         (getter)GMPy_CTXT_Get_##NAME, \
@@ -1220,21 +1450,22 @@ static PyGetSetDef GMPyContext_getseters[] = {
     ADD_GETSET(trap_divzero),
     ADD_GETSET(allow_complex),
     ADD_GETSET(rational_division),
+    ADD_GETSET(track_flags),
     {NULL}
 };
 
 static PyMethodDef GMPyContext_methods[] =
 {
     { "abs", GMPy_Context_Abs, METH_O, GMPy_doc_context_abs },
-    { "acos", GMPy_Context_Acos, METH_O, GMPy_doc_context_acos },
-    { "acosh", GMPy_Context_Acosh, METH_O, GMPy_doc_context_acosh },
-    { "add", GMPy_Context_Add, METH_VARARGS, GMPy_doc_context_add },
+    { "acos", (PyCFunction)GMPy_Context_Acos, GMPY_METH_KWARGS, GMPy_doc_context_acos },
+    { "acosh", (PyCFunction)GMPy_Context_Acosh, GMPY_METH_KWARGS, GMPy_doc_context_acosh },
+    { "add", (PyCFunction)GMPy_Context_Add, GMPY_METH_KWARGS, GMPy_doc_context_add },
     { "agm", GMPy_Context_AGM, METH_VARARGS, GMPy_doc_context_agm },
     { "ai", GMPy_Context_Ai, METH_O, GMPy_doc_context_ai },
-    { "asin", GMPy_Context_Asin, METH_O, GMPy_doc_context_asin },
-    { "asinh", GMPy_Context_Asinh, METH_O, GMPy_doc_context_asinh },
-    { "atan", GMPy_Context_Atan, METH_O, GMPy_doc_context_atan },
-    { "atanh", GMPy_Context_Atanh, METH_O, GMPy_doc_context_atanh },
+    { "asin", (PyCFunction)GMPy_Context_Asin, GMPY_METH_KWARGS, GMPy_doc_context_asin },
+    { "asinh", (PyCFunction)GMPy_Context_Asinh, GMPY_METH_KWARGS, GMPy_doc_context_asinh },
+    { "atan", (PyCFunction)GMPy_Context_Atan, GMPY_METH_KWARGS, GMPy_doc_context_atan },
+    { "atanh", (PyCFunction)GMPy_Context_Atanh, GMPY_METH_KWARGS, GMPy_doc_context_atanh },
     { "atan2", GMPy_Context_Atan2, METH_VARARGS, GMPy_doc_context_atan2 },
     { "clear_flags", GMPy_CTXT_Clear_Flags, METH_NOARGS, GMPy_doc_context_clear_flags },
     { "cbrt", GMPy_Context_Cbrt, METH_O, GMPy_doc_context_cbrt },
@@ -1244,8 +1475,8 @@ static PyMethodDef GMPyContext_methods[] =
     { "const_euler", GMPy_Context_Const_Euler, METH_NOARGS, GMPy_doc_context_const_euler },
     { "const_log2", GMPy_Context_Const_Log2, METH_NOARGS, GMPy_doc_context_const_log2 },
     { "const_pi", GMPy_Context_Const_Pi, METH_NOARGS, GMPy_doc_context_const_pi },
-    { "cos", GMPy_Context_Cos, METH_O, GMPy_doc_context_cos },
-    { "cosh", GMPy_Context_Cosh, METH_O, GMPy_doc_context_cosh },
+    { "cos", (PyCFunction)GMPy_Context_Cos, GMPY_METH_KWARGS, GMPy_doc_context_cos },
+    { "cosh", (PyCFunction)GMPy_Context_Cosh, GMPY_METH_KWARGS, GMPy_doc_context_cosh },
     { "cot", GMPy_Context_Cot, METH_O, GMPy_doc_context_cot },
     { "coth", GMPy_Context_Coth, METH_O, GMPy_doc_context_coth },
     { "copy", GMPy_CTXT_Copy, METH_NOARGS, GMPy_doc_context_copy },
@@ -1253,13 +1484,13 @@ static PyMethodDef GMPyContext_methods[] =
     { "csch", GMPy_Context_Csch, METH_O, GMPy_doc_context_csch },
     { "degrees", GMPy_Context_Degrees, METH_O, GMPy_doc_context_degrees },
     { "digamma", GMPy_Context_Digamma, METH_O, GMPy_doc_context_digamma },
-    { "div", GMPy_Context_TrueDiv, METH_VARARGS, GMPy_doc_context_truediv },
+    { "div", (PyCFunction)GMPy_Context_TrueDiv, GMPY_METH_KWARGS, GMPy_doc_context_truediv },
     { "divmod", GMPy_Context_DivMod, METH_VARARGS, GMPy_doc_context_divmod },
     { "div_2exp", GMPy_Context_Div_2exp, METH_VARARGS, GMPy_doc_context_div_2exp },
     { "eint", GMPy_Context_Eint, METH_O, GMPy_doc_context_eint },
     { "erf", GMPy_Context_Erf, METH_O, GMPy_doc_context_erf },
     { "erfc", GMPy_Context_Erfc, METH_O, GMPy_doc_context_erfc },
-    { "exp", GMPy_Context_Exp, METH_O, GMPy_doc_context_exp },
+    { "exp", (PyCFunction)GMPy_Context_Exp, GMPY_METH_KWARGS, GMPy_doc_context_exp },
     { "expm1", GMPy_Context_Expm1, METH_O, GMPy_doc_context_expm1 },
     { "exp10", GMPy_Context_Exp10, METH_O, GMPy_doc_context_exp10 },
     { "exp2", GMPy_Context_Exp2, METH_O, GMPy_doc_context_exp2 },
@@ -1269,6 +1500,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "fmod", GMPy_Context_Fmod, METH_VARARGS, GMPy_doc_context_fmod },
     { "fms", GMPy_Context_FMS, METH_VARARGS, GMPy_doc_context_fms },
     { "factorial", GMPy_Context_Factorial, METH_O, GMPy_doc_context_factorial },
+    { "fdot", GMPy_Context_Fdot, METH_VARARGS, GMPy_doc_context_fdot },
     { "frac", GMPy_Context_Frac, METH_O, GMPy_doc_context_frac },
     { "frexp", GMPy_Context_Frexp, METH_O, GMPy_doc_context_frexp },
     { "fsum", GMPy_Context_Fsum, METH_O, GMPy_doc_context_fsum },
@@ -1287,8 +1519,8 @@ static PyMethodDef GMPyContext_methods[] =
     { "li2", GMPy_Context_Li2, METH_O, GMPy_doc_context_li2 },
     { "lgamma", GMPy_Context_Lgamma, METH_O, GMPy_doc_context_lgamma },
     { "lngamma", GMPy_Context_Lngamma, METH_O, GMPy_doc_context_lngamma },
-    { "log", GMPy_Context_Log, METH_O, GMPy_doc_context_log },
-    { "log10", GMPy_Context_Log10, METH_O, GMPy_doc_context_log10 },
+    { "log", (PyCFunction)GMPy_Context_Log, GMPY_METH_KWARGS, GMPy_doc_context_log },
+    { "log10", (PyCFunction)GMPy_Context_Log10, GMPY_METH_KWARGS, GMPy_doc_context_log10 },
     { "log1p", GMPy_Context_Log1p, METH_O, GMPy_doc_context_log1p },
     { "log2", GMPy_Context_Log2, METH_O, GMPy_doc_context_log2 },
     { "maxnum", GMPy_Context_Maxnum, METH_VARARGS, GMPy_doc_context_maxnum },
@@ -1296,7 +1528,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "minus", GMPy_Context_Minus, METH_VARARGS, GMPy_doc_context_minus },
     { "mod", GMPy_Context_Mod, METH_VARARGS, GMPy_doc_context_mod },
     { "modf", GMPy_Context_Modf, METH_O, GMPy_doc_context_modf },
-    { "mul", GMPy_Context_Mul, METH_VARARGS, GMPy_doc_context_mul },
+    { "mul", (PyCFunction)GMPy_Context_Mul, GMPY_METH_KWARGS, GMPy_doc_context_mul },
     { "mul_2exp", GMPy_Context_Mul_2exp, METH_VARARGS, GMPy_doc_context_mul_2exp },
     { "next_above", GMPy_Context_NextAbove, METH_O, GMPy_doc_context_next_above },
     { "next_below", GMPy_Context_NextBelow, METH_O, GMPy_doc_context_next_below },
@@ -1305,6 +1537,7 @@ static PyMethodDef GMPyContext_methods[] =
     { "phase", GMPy_Context_Phase, METH_O, GMPy_doc_context_phase },
     { "plus", GMPy_Context_Plus, METH_VARARGS, GMPy_doc_context_plus },
     { "polar", GMPy_Context_Polar, METH_O, GMPy_doc_context_polar },
+    { "polyval", GMPy_Context_Polyval, METH_VARARGS, GMPy_doc_context_polyval },
     { "proj", GMPy_Context_Proj, METH_O, GMPy_doc_context_proj },
     { "pow", GMPy_Context_Pow, METH_VARARGS, GMPy_doc_context_pow },
     { "radians", GMPy_Context_Radians, METH_O, GMPy_doc_context_radians },
@@ -1323,15 +1556,15 @@ static PyMethodDef GMPyContext_methods[] =
     { "round_away", GMPy_Context_RoundAway, METH_O, GMPy_doc_context_round_away },
     { "sec", GMPy_Context_Sec, METH_O, GMPy_doc_context_sec },
     { "sech", GMPy_Context_Sech, METH_O, GMPy_doc_context_sech },
-    { "sin", GMPy_Context_Sin, METH_O, GMPy_doc_context_sin },
-    { "sin_cos", GMPy_Context_Sin_Cos, METH_O, GMPy_doc_context_sin_cos },
-    { "sinh", GMPy_Context_Sinh, METH_O, GMPy_doc_context_sinh },
+    { "sin", (PyCFunction)GMPy_Context_Sin, GMPY_METH_KWARGS, GMPy_doc_context_sin },
+    { "sin_cos", (PyCFunction)GMPy_Context_Sin_Cos, GMPY_METH_KWARGS, GMPy_doc_context_sin_cos },
+    { "sinh", (PyCFunction)GMPy_Context_Sinh, GMPY_METH_KWARGS, GMPy_doc_context_sinh },
     { "sinh_cosh", GMPy_Context_Sinh_Cosh, METH_O, GMPy_doc_context_sinh_cosh },
-    { "sqrt", GMPy_Context_Sqrt, METH_O, GMPy_doc_context_sqrt },
+    { "sqrt", (PyCFunction)GMPy_Context_Sqrt, GMPY_METH_KWARGS, GMPy_doc_context_sqrt },
     { "square", GMPy_Context_Square, METH_O, GMPy_doc_context_square },
-    { "sub", GMPy_Context_Sub, METH_VARARGS, GMPy_doc_context_sub },
-    { "tan", GMPy_Context_Tan, METH_O, GMPy_doc_context_tan },
-    { "tanh", GMPy_Context_Tanh, METH_O, GMPy_doc_context_tanh },
+    { "sub", (PyCFunction)GMPy_Context_Sub, GMPY_METH_KWARGS, GMPy_doc_context_sub },
+    { "tan", (PyCFunction)GMPy_Context_Tan, GMPY_METH_KWARGS, GMPy_doc_context_tan },
+    { "tanh", (PyCFunction)GMPy_Context_Tanh, GMPY_METH_KWARGS, GMPy_doc_context_tanh },
     { "trunc", GMPy_Context_Trunc, METH_O, GMPy_doc_context_trunc },
 #ifdef VECTOR
     { "vector", GMPy_Context_Vector, METH_O, GMPy_doc_context_vector },
@@ -88,6 +88,32 @@ static PyObject *    GMPy_CTXT_ieee(PyObject *self, PyObject *args, PyObject *kw
 static PyObject *    GMPy_CTXT_Enter(PyObject *self, PyObject *args);
 static PyObject *    GMPy_CTXT_Exit(PyObject *self, PyObject *args);
 
+/* Functions that accept the optional precision= and round= keywords use the
+ * vectorcall convention when it is available so a call without keywords is
+ * as cheap as a METH_O call. GMPY_KWARGS_PARAMS declares the parameters,
+ * GMPY_KWARGS_NARGS and GMPY_KWARGS_ARG(i) access the positional arguments,
+ * and GMPY_KWARGS_CONTEXT(context, local) applies the keywords.
+ */
+
+#if PY_VERSION_HEX >= 0x03070000
+#define GMPY_METH_KWARGS (METH_FASTCALL | METH_KEYWORDS)
+#define GMPY_KWARGS_PARAMS PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames
+#define GMPY_KWARGS_NARGS nargs
+#define GMPY_KWARGS_ARG(i) (args[i])
+#define GMPY_KWARGS_CONTEXT(context, local) \
+    GMPy_CTXT_From_Keywords(context, args + nargs, kwnames, local)
+static CTXT_Object * GMPy_CTXT_From_Keywords(CTXT_Object *context, PyObject *const *values, PyObject *kwnames, CTXT_Object *local);
+#else
+#define GMPY_METH_KWARGS (METH_VARARGS | METH_KEYWORDS)
+#define GMPY_KWARGS_PARAMS PyObject *args, PyObject *kwargs
+#define GMPY_KWARGS_NARGS PyTuple_GET_SIZE(args)
+#define GMPY_KWARGS_ARG(i) PyTuple_GET_ITEM(args, i)
+#define GMPY_KWARGS_CONTEXT(context, local) \
+    GMPy_CTXT_From_Keywords(context, kwargs, local)
+static CTXT_Object * GMPy_CTXT_From_Keywords(CTXT_Object *context, PyObject *kwargs, CTXT_Object *local);
+#endif
+static void          GMPy_CTXT_Merge_Flags(CTXT_Object *context, CTXT_Object *local);
+
 #ifndef WITHOUT_THREADS
 static CTXT_Object * GMPy_current_context(void);
 #endif
@@ -82,7 +82,8 @@ static int
 mpz_set_PyStr(mpz_ptr z, PyObject *s, int base)
 {
     char *cp;
-    Py_ssize_t len, i;
+    Py_ssize_t len;
+    int res;
     PyObject *ascii_str = NULL;
 
     if (PyBytes_Check(s)) {
@@ -103,11 +104,24 @@ mpz_set_PyStr(mpz_ptr z, PyObject *s, int base)
         return -1;
     }
 
+    res = mpz_set_CStr(z, cp, len, base);
+    Py_XDECREF(ascii_str);
+    return res;
+}
+
+/* mpz_set_CStr converts a NULL terminated C string of length len into a mpz_t
+ * structure. Returns -1 on error, 1 if successful.
+ */
+
+static int
+mpz_set_CStr(mpz_ptr z, char *cp, Py_ssize_t len, int base)
+{
+    Py_ssize_t i;
+
     /* Don't allow NULL characters */
     for (i = 0; i < len; i++) {
         if (cp[i] == '\0') {
             VALUE_ERROR("string contains NULL characters");
-            Py_XDECREF(ascii_str);
             return -1;
         }
     }
@@ -134,12 +148,10 @@ mpz_set_PyStr(mpz_ptr z, PyObject *s, int base)
     }
 
     /* delegate rest to GMP's _set_str function */
-    if (-1 == mpz_set_str(z, cp, base)) {
+    if (-1 == GMPy_mpz_set_str(z, cp, base)) {
         VALUE_ERROR("invalid digits");
-        Py_XDECREF(ascii_str);
         return -1;
     }
-    Py_XDECREF(ascii_str);
     return 1;
 }
 
@@ -238,7 +250,7 @@ mpz_ascii(mpz_t z, int base, int option, int which)
     }
 
     /* Call GMP. */
-    mpz_get_str(p, base, z);
+    GMPy_mpz_get_str(p, base, z);
     p = buffer + strlen(buffer);
 
     if (option & 1)
@@ -45,15 +45,31 @@ extern "C" {
 
 #define IS_FRACTION(x) (!strcmp(Py_TYPE(x)->tp_name, "Fraction"))
 
-#define IS_RATIONAL_ONLY(x) (MPQ_Check(x) || IS_FRACTION(x))
+#define IS_RATIONAL_ONLY(x) (MPQ_Check(x) || IS_FRACTION(x) || XMPQ_Check(x))
 #define IS_RATIONAL(x) (IS_INTEGER(x) || IS_RATIONAL_ONLY(x))
 
-#define IS_REAL_ONLY(x) (MPFR_Check(x) || PyFloat_Check(x))
+#define IS_REAL_ONLY(x) (MPFR_Check(x) || PyFloat_Check(x) || XMPFR_Check(x))
 #define IS_REAL(x) (IS_RATIONAL(x) || IS_REAL_ONLY(x))
 
-#define IS_COMPLEX_ONLY(x) (MPC_Check(x) || PyComplex_Check(x))
+#define IS_COMPLEX_ONLY(x) (MPC_Check(x) || PyComplex_Check(x) || XMPC_Check(x))
 #define IS_COMPLEX(x) (IS_REAL(x) || IS_COMPLEX_ONLY(x))
 
+/* IS_SMALL_PYINT(x) is true for an exact Python integer whose value is
+ * returned as a long by SMALL_PYINT_AS_LONG(x) and can be negated without
+ * overflow: a PyInt other than LONG_MIN, or a PyLong with at most one digit.
+ * The mpz slots use them to handle operands such as x + 1 or x < 0 without
+ * the general conversion.
+ */
+
+#ifdef PY2
+#define IS_SMALL_PYINT(x) (PyInt_CheckExact(x) && PyInt_AS_LONG(x) != LONG_MIN)
+#define SMALL_PYINT_AS_LONG(x) PyInt_AS_LONG(x)
+#else
+#define IS_SMALL_PYINT(x) (PyLong_CheckExact(x) && (size_t)(Py_SIZE(x) + 1) <= 2)
+#define SMALL_PYINT_AS_LONG(x) \
+    (Py_SIZE(x) ? (long)Py_SIZE(x) * (long)((PyLongObject*)(x))->ob_digit[0] : 0L)
+#endif
+
 /* Since the macros are used in gmpy2's codebase, these functions are skipped
  * until they are needed for the C API in the future.
  */
@@ -77,6 +93,7 @@ static int GMPy_isComplex(PyObject *obj);
 
 /* ======== C helper routines ======== */
 static int             mpz_set_PyStr(mpz_ptr z, PyObject *s, int base);
+static int             mpz_set_CStr(mpz_ptr z, char *cp, Py_ssize_t len, int base);
 static PyObject *      mpz_ascii(mpz_t z, int base, int option, int which);
 
 #ifdef __cplusplus
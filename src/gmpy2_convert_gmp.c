@@ -539,16 +539,8 @@ GMPy_MPQ_From_PyStr(PyObject *s, int base, CTXT_Object *context)
 {
     MPQ_Object *result;
     char *cp;
-    char exp_char = 'E';
-    Py_ssize_t len, i;
+    Py_ssize_t len;
     PyObject *ascii_str = NULL;
-    long expt = 0;
-
-    if (!(result = GMPy_MPQ_New(context))) {
-        /* LCOV_EXCL_START */
-        return NULL;
-        /* LCOV_EXCL_STOP */
-    }
 
     if (PyBytes_Check(s)) {
         len = PyBytes_Size(s);
@@ -558,14 +550,38 @@ GMPy_MPQ_From_PyStr(PyObject *s, int base, CTXT_Object *context)
         ascii_str = PyUnicode_AsASCIIString(s);
         if (!ascii_str) {
             VALUE_ERROR("string contains non-ASCII characters");
-            goto error;
+            return NULL;
         }
         len = PyBytes_Size(ascii_str);
         cp = PyBytes_AsString(ascii_str);
     }
     else {
         TYPE_ERROR("object is not string or Unicode");
-        goto error;
+        return NULL;
+    }
+
+    result = GMPy_MPQ_From_CStr(cp, len, base, context);
+    Py_XDECREF(ascii_str);
+    return result;
+}
+
+/* GMPy_MPQ_From_CStr() converts a NULL terminated C string of length len.
+ * The string is modified while it is parsed but is restored before
+ * returning.
+ */
+
+static MPQ_Object *
+GMPy_MPQ_From_CStr(char *cp, Py_ssize_t len, int base, CTXT_Object *context)
+{
+    MPQ_Object *result;
+    char exp_char = 'E';
+    Py_ssize_t i;
+    long expt = 0;
+
+    if (!(result = GMPy_MPQ_New(context))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
     }
 
     /* Don't allow NULL characters */
@@ -703,12 +719,10 @@ GMPy_MPQ_From_PyStr(PyObject *s, int base, CTXT_Object *context)
     }
 
   finish:
-    Py_XDECREF(ascii_str);
     return result;
 
   error:
     Py_DECREF((PyObject*)result);
-    Py_XDECREF(ascii_str);
     return NULL;
 }
 
@@ -769,7 +783,7 @@ GMPy_MPZ_From_MPQ(MPQ_Object *obj, CTXT_Object *context)
 {
     MPZ_Object *result;
 
-    assert(MPQ_Check(obj));
+    assert(MPQ_Check(obj) || XMPQ_Check(obj));
 
     if ((result = GMPy_MPZ_New(context)))
         mpz_set_q(result->z, obj->q);
@@ -782,7 +796,7 @@ GMPy_XMPZ_From_MPQ(MPQ_Object *obj, CTXT_Object *context)
 {
     XMPZ_Object *result;
 
-    assert(MPQ_Check(obj));
+    assert(MPQ_Check(obj) || XMPQ_Check(obj));
 
     if ((result = GMPy_XMPZ_New(context)))
 
@@ -797,7 +811,7 @@ GMPy_PyLong_From_MPQ(MPQ_Object *obj, CTXT_Object *context)
     PyObject *result;
     MPZ_Object *temp;
 
-    assert(MPQ_Check(obj));
+    assert(MPQ_Check(obj) || XMPQ_Check(obj));
 
     temp = GMPy_MPZ_From_MPQ(obj, context);
 
@@ -826,7 +840,7 @@ GMPy_PyIntOrLong_From_MPQ(MPQ_Object *obj, CTXT_Object *context)
     PyObject *result;
     MPZ_Object *temp;
 
-    assert(MPQ_Check(obj));
+    assert(MPQ_Check(obj) || XMPQ_Check(obj));
 
     temp = GMPy_MPZ_From_MPQ(obj, context);
 
@@ -849,6 +863,7 @@ GMPy_MPQ_Int_Slot(MPQ_Object *self)
 }
 
 static char* _qtag = "mpq(";
+static char* _xqtag = "xmpq(";
 
 static PyObject *
 GMPy_PyStr_From_MPQ(MPQ_Object *obj, int base, int option, CTXT_Object *context)
@@ -880,7 +895,7 @@ GMPy_PyStr_From_MPQ(MPQ_Object *obj, int base, int option, CTXT_Object *context)
     /* Build the format string. */
     p = buffer;
     if (option & 1) {
-        strcpy(p, _qtag);
+        strcpy(p, XMPQ_Check(obj) ? _xqtag : _qtag);
         p += strlen(p);
     }
 
@@ -922,7 +937,7 @@ GMPy_PyFloat_From_MPQ(MPQ_Object *obj, CTXT_Object *context)
 {
     double res;
 
-    assert(MPQ_Check(obj));
+    assert(MPQ_Check(obj) || XMPQ_Check(obj));
 
     res = mpq_get_d(obj->q);
 
@@ -969,6 +984,24 @@ GMPy_MPQ_From_Fraction(PyObject* obj, CTXT_Object *context)
     return result;
 }
 
+/* An xmpq may be modified in-place and may not be in canonical form so a
+ * new, canonical mpq instance is always returned.
+ */
+
+static MPQ_Object *
+GMPy_MPQ_From_XMPQ(XMPQ_Object *obj, CTXT_Object *context)
+{
+    MPQ_Object *result;
+
+    assert(XMPQ_Check(obj));
+
+    GMPy_XMPQ_Canonicalize((PyObject*)obj);
+    if ((result = GMPy_MPQ_New(context)))
+        mpq_set(result->q, obj->q);
+
+    return result;
+}
+
 static MPQ_Object*
 GMPy_MPQ_From_Number(PyObject *obj, CTXT_Object *context)
 {
@@ -980,7 +1013,7 @@ GMPy_MPQ_From_Number(PyObject *obj, CTXT_Object *context)
     if (MPZ_Check(obj))
         return GMPy_MPQ_From_MPZ((MPZ_Object*)obj, context);
 
-    if (MPFR_Check(obj))
+    if (CHECK_MPFRANY(obj))
         return GMPy_MPQ_From_MPFR((MPFR_Object*)obj, context);
 
     if (PyFloat_Check(obj))
@@ -992,6 +1025,9 @@ GMPy_MPQ_From_Number(PyObject *obj, CTXT_Object *context)
     if (XMPZ_Check(obj))
         return GMPy_MPQ_From_XMPZ((XMPZ_Object*)obj, context);
 
+    if (XMPQ_Check(obj))
+        return GMPy_MPQ_From_XMPQ((XMPQ_Object*)obj, context);
+
     if (IS_FRACTION(obj))
         return GMPy_MPQ_From_Fraction(obj, context);
 
@@ -1016,6 +1052,9 @@ GMPy_MPQ_From_Rational(PyObject *obj, CTXT_Object *context)
     if (XMPZ_Check(obj))
         return GMPy_MPQ_From_XMPZ((XMPZ_Object*)obj, context);
 
+    if (XMPQ_Check(obj))
+        return GMPy_MPQ_From_XMPQ((XMPQ_Object*)obj, context);
+
     if (IS_FRACTION(obj))
         return GMPy_MPQ_From_Fraction(obj, context);
 
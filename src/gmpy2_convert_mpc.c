@@ -85,6 +85,46 @@ GMPy_MPC_From_MPC(MPC_Object *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
     return result;
 }
 
+/* An xmpc may be modified in-place so a new mpc instance is always
+ * returned. If rprec == 1 and iprec == 1, the value is copied exactly.
+ */
+
+static MPC_Object *
+GMPy_MPC_From_XMPC(XMPC_Object *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
+                   CTXT_Object *context)
+{
+    MPC_Object *result = NULL;
+
+    assert(XMPC_Check(obj));
+
+    CHECK_CONTEXT(context);
+
+    if (rprec == 1 && iprec == 1) {
+        mpc_get_prec2(&rprec, &iprec, obj->c);
+        if ((result = GMPy_MPC_New(rprec, iprec, context))) {
+            mpc_set(result->c, obj->c, MPC_RNDNN);
+            result->rc = obj->rc;
+        }
+        return result;
+    }
+
+    if (rprec == 0)
+        rprec = GET_REAL_PREC(context);
+    else if (rprec == 1)
+        rprec = mpfr_get_prec(mpc_realref(obj->c));
+
+    if (iprec == 0)
+        iprec = GET_IMAG_PREC(context);
+    else if (iprec == 1)
+        iprec = mpfr_get_prec(mpc_imagref(obj->c));
+
+    if ((result = GMPy_MPC_New(rprec, iprec, context))) {
+        result->rc = mpc_set(result->c, obj->c, GET_MPC_ROUND(context));
+        _GMPy_MPC_Cleanup(&result, context);
+    }
+    return result;
+}
+
 static MPC_Object *
 GMPy_MPC_From_PyComplex(PyObject *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
                         CTXT_Object *context)
@@ -123,7 +163,7 @@ GMPy_MPC_From_MPFR(MPFR_Object *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
 {
     MPC_Object *result;
 
-    assert(MPFR_Check(obj));
+    assert(CHECK_MPFRANY(obj));
 
     CHECK_CONTEXT(context);
 
@@ -215,7 +255,7 @@ GMPy_MPC_From_MPQ(MPQ_Object *obj, mpfr_prec_t rprec, mpfr_prec_t iprec,
 {
     MPC_Object *result = NULL;
 
-    assert(MPQ_Check(obj));
+    assert(MPQ_Check(obj) || XMPQ_Check(obj));
 
     CHECK_CONTEXT(context);
 
@@ -416,7 +456,10 @@ GMPy_MPC_From_Complex(PyObject* obj, mp_prec_t rprec, mp_prec_t iprec,
     if (MPC_Check(obj))
         return GMPy_MPC_From_MPC((MPC_Object*)obj, rprec, iprec, context);
 
-    if (MPFR_Check(obj))
+    if (XMPC_Check(obj))
+        return GMPy_MPC_From_XMPC((XMPC_Object*)obj, rprec, iprec, context);
+
+    if (CHECK_MPFRANY(obj))
         return GMPy_MPC_From_MPFR((MPFR_Object*)obj, rprec, iprec, context);
 
     if (PyFloat_Check(obj))
@@ -428,6 +471,11 @@ GMPy_MPC_From_Complex(PyObject* obj, mp_prec_t rprec, mp_prec_t iprec,
     if (MPQ_Check(obj))
         return GMPy_MPC_From_MPQ((MPQ_Object*)obj, rprec, iprec, context);
 
+    if (XMPQ_Check(obj)) {
+        GMPy_XMPQ_Canonicalize(obj);
+        return GMPy_MPC_From_MPQ((MPQ_Object*)obj, rprec, iprec, context);
+    }
+
     if (MPZ_Check(obj) || XMPZ_Check(obj))
         return GMPy_MPC_From_MPZ((MPZ_Object*)obj, rprec, iprec, context);
 
@@ -572,10 +620,11 @@ GMPy_MPC_Repr_Slot(MPC_Object *self)
     iprec = (long)(log10(2) * (double)ibits) + 2;
 
     if (rbits != DBL_MANT_DIG || ibits !=DBL_MANT_DIG)
-        sprintf(fmtstr, "mpc('{0:.%ld.%ldg}',(%ld,%ld))",
-                rprec, iprec, rbits, ibits);
+        sprintf(fmtstr, "%s('{0:.%ld.%ldg}',(%ld,%ld))",
+                Py_TYPE(self)->tp_name, rprec, iprec, rbits, ibits);
     else
-        sprintf(fmtstr, "mpc('{0:.%ld.%ldg}')", rprec, iprec);
+        sprintf(fmtstr, "%s('{0:.%ld.%ldg}')", Py_TYPE(self)->tp_name,
+                rprec, iprec);
 
     temp = Py_BuildValue("s", fmtstr);
     if (!temp)
@@ -120,6 +120,39 @@ GMPy_MPFR_From_MPFR(MPFR_Object *obj, mpfr_prec_t prec, CTXT_Object *context)
     return result;
 }
 
+/* An xmpfr may be modified in-place so a new mpfr instance is always
+ * returned. If prec == 1, the value is copied exactly and the exponent is
+ * not checked.
+ */
+
+static MPFR_Object *
+GMPy_MPFR_From_XMPFR(XMPFR_Object *obj, mpfr_prec_t prec, CTXT_Object *context)
+{
+    MPFR_Object *result = NULL;
+
+    assert(XMPFR_Check(obj));
+
+    CHECK_CONTEXT(context);
+
+    if (prec == 1) {
+        if ((result = GMPy_MPFR_New(mpfr_get_prec(obj->f), context))) {
+            mpfr_set(result->f, obj->f, MPFR_RNDN);
+            result->rc = obj->rc;
+        }
+        return result;
+    }
+
+    if (prec == 0)
+        prec = GET_MPFR_PREC(context);
+
+    if ((result = GMPy_MPFR_New(prec, context))) {
+        mpfr_clear_flags();
+        result->rc = mpfr_set(result->f, obj->f, GET_MPFR_ROUND(context));
+        _GMPy_MPFR_Cleanup(&result, context);
+    }
+    return result;
+}
+
 static MPFR_Object *
 GMPy_MPFR_From_PyIntOrLong(PyObject *obj, mpfr_prec_t prec, CTXT_Object *context)
 {
@@ -258,7 +291,7 @@ GMPy_MPFR_From_MPQ(MPQ_Object *obj, mpfr_prec_t prec, CTXT_Object *context)
 {
     MPFR_Object *result;
 
-    assert(MPQ_Check(obj));
+    assert(MPQ_Check(obj) || XMPQ_Check(obj));
 
     CHECK_CONTEXT(context);
 
@@ -303,16 +336,10 @@ static MPFR_Object *
 GMPy_MPFR_From_PyStr(PyObject *s, int base, mpfr_prec_t prec, CTXT_Object *context)
 {
     MPFR_Object *result;
-    MPQ_Object *tempq;
-    char *cp, *endptr;
+    char *cp;
     Py_ssize_t len;
     PyObject *ascii_str = NULL;
 
-    CHECK_CONTEXT(context);
-
-    if (prec < 2)
-        prec = GET_MPFR_PREC(context);
-
     if (PyBytes_Check(s)) {
         len = PyBytes_Size(s);
         cp = PyBytes_AsString(s);
@@ -331,6 +358,26 @@ GMPy_MPFR_From_PyStr(PyObject *s, int base, mpfr_prec_t prec, CTXT_Object *conte
         return NULL;
     }
 
+    result = GMPy_MPFR_From_CStr(cp, len, base, prec, context);
+    Py_XDECREF(ascii_str);
+    return result;
+}
+
+/* GMPy_MPFR_From_CStr() converts a NULL terminated C string of length len. */
+
+static MPFR_Object *
+GMPy_MPFR_From_CStr(char *cp, Py_ssize_t len, int base, mpfr_prec_t prec, CTXT_Object *context)
+{
+    MPFR_Object *result;
+    MPQ_Object *tempq;
+    PyObject *s;
+    char *endptr;
+
+    CHECK_CONTEXT(context);
+
+    if (prec < 2)
+        prec = GET_MPFR_PREC(context);
+
     /* Check for leading base indicators. */
     if (base == 0) {
         if (len > 2 && cp[0] == '0') {
@@ -352,14 +399,12 @@ GMPy_MPFR_From_PyStr(PyObject *s, int base, mpfr_prec_t prec, CTXT_Object *conte
 
 
     if (!(result = GMPy_MPFR_New(prec, context))) {
-        Py_XDECREF(ascii_str);
         return NULL;
     }
 
     /* delegate the rest to MPFR */
     mpfr_clear_flags();
     result->rc = mpfr_strtofr(result->f, cp, &endptr, base, GET_MPFR_ROUND(context));
-    Py_XDECREF(ascii_str);
 
     if (len != (Py_ssize_t)(endptr - cp)) {
         VALUE_ERROR("invalid digits");
@@ -383,7 +428,13 @@ GMPy_MPFR_From_PyStr(PyObject *s, int base, mpfr_prec_t prec, CTXT_Object *conte
         result->f->_mpfr_exp <= context->ctx.emin + mpfr_get_prec(result->f) - 1)
         {
 
-        if (!(tempq = GMPy_MPQ_From_PyStr(s, base, context))) {
+        if (!(s = PyBytes_FromStringAndSize(cp, len))) {
+            Py_DECREF((PyObject*)result);
+            return NULL;
+        }
+        tempq = GMPy_MPQ_From_PyStr(s, base, context);
+        Py_DECREF(s);
+        if (!tempq) {
             Py_DECREF((PyObject*)result);
             return NULL;
         }
@@ -425,9 +476,17 @@ GMPy_MPFR_From_Real(PyObject *obj, mp_prec_t prec, CTXT_Object *context)
     if (PyFloat_Check(obj))
         return GMPy_MPFR_From_PyFloat(obj, prec, context);
 
+    if (XMPFR_Check(obj))
+        return GMPy_MPFR_From_XMPFR((XMPFR_Object*)obj, prec, context);
+
     if (MPQ_Check(obj))
         return GMPy_MPFR_From_MPQ((MPQ_Object*)obj, prec, context);
 
+    if (XMPQ_Check(obj)) {
+        GMPy_XMPQ_Canonicalize(obj);
+        return GMPy_MPFR_From_MPQ((MPQ_Object*)obj, prec, context);
+    }
+
     if (MPZ_Check(obj) || XMPZ_Check(obj))
         return GMPy_MPFR_From_MPZ((MPZ_Object*)obj, prec, context);
 
@@ -446,7 +505,7 @@ GMPy_MPZ_From_MPFR(MPFR_Object *obj, CTXT_Object *context)
 {
     MPZ_Object *result;
 
-    assert(MPFR_Check(obj));
+    assert(CHECK_MPFRANY(obj));
 
     CHECK_CONTEXT(context);
 
@@ -739,7 +798,7 @@ GMPy_PyStr_From_MPFR(MPFR_Object *self, int base, int digits, CTXT_Object *conte
     CHECK_CONTEXT(context);
 
     /* check arguments are valid */
-    assert(MPFR_Check((PyObject*)self));
+    assert(CHECK_MPFRANY((PyObject*)self));
     if (!((base >= 2) && (base <= 62))) {
         VALUE_ERROR("base must be in the interval [2,62]");
         return NULL;
@@ -833,9 +892,9 @@ GMPy_MPFR_Repr_Slot(MPFR_Object *self)
     precision = (long)(log10(2) * (double)bits) + 2;
 
     if (mpfr_number_p(MPFR(self)) && bits != DBL_MANT_DIG)
-        sprintf(fmtstr, "mpfr('{0:.%ldg}',%ld)", precision, bits);
+        sprintf(fmtstr, "%s('{0:.%ldg}',%ld)", Py_TYPE(self)->tp_name, precision, bits);
     else
-        sprintf(fmtstr, "mpfr('{0:.%ldg}')", precision);
+        sprintf(fmtstr, "%s('{0:.%ldg}')", Py_TYPE(self)->tp_name, precision);
 
     temp = Py_BuildValue("s", fmtstr);
     if (!temp)
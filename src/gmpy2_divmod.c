@@ -265,7 +265,7 @@ GMPy_Real_DivMod(PyObject *x, PyObject *y, CTXT_Object *context)
             /* LCOV_EXCL_STOP */
         }
         if (mpfr_zero_p(tempy->f)) {
-            context->ctx.divzero = 1;
+            GMPY_SET_FLAG(context, divzero);
             if (context->ctx.traps & TRAP_DIVZERO) {
                 GMPY_DIVZERO("divmod() division by zero");
                 goto error;
@@ -276,7 +276,7 @@ GMPy_Real_DivMod(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (mpfr_nan_p(tempx->f) || mpfr_nan_p(tempy->f) || mpfr_inf_p(tempx->f)) {
-            context->ctx.invalid = 1;
+            GMPY_SET_FLAG(context, invalid);
             if (context->ctx.traps & TRAP_INVALID) {
                 GMPY_INVALID("divmod() invalid operation");
                 goto error;
@@ -287,7 +287,7 @@ GMPy_Real_DivMod(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (mpfr_inf_p(tempy->f)) {
-            context->ctx.invalid = 1;
+            GMPY_SET_FLAG(context, invalid);
             if (context->ctx.traps & TRAP_INVALID) {
                 GMPY_INVALID("divmod() invalid operation");
                 goto error;
@@ -146,22 +146,82 @@ GMPy_Integer_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
  * function. If no appropriate function can be found, return NotImplemented.
  */
 
+/* Floor division of two C longs. b must not be 0 and a / b must not
+ * overflow.
+ */
+
+static long
+_GMPy_FloorDiv_si(long a, long b)
+{
+    long q = a / b;
+
+    if ((a % b) != 0 && ((a < 0) != (b < 0)))
+        q -= 1;
+    return q;
+}
+
 static PyObject *
 GMPy_MPZ_FloorDiv_Slot(PyObject *x, PyObject *y)
 {
-    if (CHECK_MPZANY(x) && CHECK_MPZANY(y)) {
-        MPZ_Object *result;
+    MPZ_Object *result;
+    long temp, small;
 
+    if (CHECK_MPZANY(x) && CHECK_MPZANY(y)) {
         if (mpz_sgn(MPZ(y)) == 0) {
             ZERO_ERROR("division or modulo by zero");
             return NULL;
         }
+        if (GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            GMPy_MPZ_GetSmall(MPZ(y), &temp) &&
+            MPZ_IS_INTERNED(_GMPy_FloorDiv_si(small, temp))) {
+            return GMPy_MPZ_Intern(_GMPy_FloorDiv_si(small, temp));
+        }
         if ((result = GMPy_MPZ_New(NULL))) {
             mpz_fdiv_q(result->z, MPZ(x), MPZ(y));
         }
         return (PyObject*)result;
     }
 
+    /* Fast paths for an mpz and a small Python integer. */
+    if (MPZ_Check(x) && IS_SMALL_PYINT(y)) {
+        temp = SMALL_PYINT_AS_LONG(y);
+        if (temp == 0) {
+            ZERO_ERROR("division or modulo by zero");
+            return NULL;
+        }
+        if (GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            MPZ_IS_INTERNED(_GMPy_FloorDiv_si(small, temp))) {
+            return GMPy_MPZ_Intern(_GMPy_FloorDiv_si(small, temp));
+        }
+        if ((result = GMPy_MPZ_New(NULL))) {
+            if (temp > 0) {
+                mpz_fdiv_q_ui(result->z, MPZ(x), temp);
+            }
+            else {
+                mpz_cdiv_q_ui(result->z, MPZ(x), -temp);
+                mpz_neg(result->z, result->z);
+            }
+        }
+        return (PyObject*)result;
+    }
+
+    if (IS_SMALL_PYINT(x) && MPZ_Check(y)) {
+        if (mpz_sgn(MPZ(y)) == 0) {
+            ZERO_ERROR("division or modulo by zero");
+            return NULL;
+        }
+        temp = SMALL_PYINT_AS_LONG(x);
+        if (GMPy_MPZ_GetSmall(MPZ(y), &small) &&
+            MPZ_IS_INTERNED(_GMPy_FloorDiv_si(temp, small))) {
+            return GMPy_MPZ_Intern(_GMPy_FloorDiv_si(temp, small));
+        }
+        if ((result = GMPy_MPZ_New(NULL))) {
+            mpz_set_si(result->z, temp);
+            mpz_fdiv_q(result->z, result->z, MPZ(y));
+        }
+        return (PyObject*)result;
+    }
+
     if (IS_INTEGER(x) && IS_INTEGER(y))
         return GMPy_Integer_FloorDiv(x, y, NULL);
 
@@ -270,9 +330,9 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPFR_Check(x)) {
-        if (MPFR_Check(y)) {
-            mpfr_clear_flags();
+    if (CHECK_MPFRANY(x)) {
+        if (CHECK_MPFRANY(y)) {
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
             result->rc = mpfr_floor(result->f, result->f);
@@ -284,7 +344,7 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
             long tempi = GMPy_Integer_AsLongAndError(y, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_div_si(result->f, MPFR(x), tempi, GET_MPFR_ROUND(context));
                 result->rc = mpfr_floor(result->f, result->f);
@@ -292,7 +352,7 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, y);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_div_z(result->f, MPFR(x), global.tempz, GET_MPFR_ROUND(context));
                 result->rc = mpfr_floor(result->f, result->f);
@@ -301,7 +361,7 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div_z(result->f, MPFR(x), MPZ(y), GET_MPFR_ROUND(context));
             result->rc = mpfr_floor(result->f, result->f);
@@ -315,7 +375,7 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
                 Py_DECREF((PyObject*)result);
                 return NULL;
             }
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div_q(result->f, MPFR(x), tempy->q, GET_MPFR_ROUND(context));
             result->rc = mpfr_floor(result->f, result->f);
@@ -324,7 +384,7 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div_d(result->f, MPFR(x), PyFloat_AS_DOUBLE(y), GET_MPFR_ROUND(context));
             result->rc = mpfr_floor(result->f, result->f);
@@ -332,12 +392,12 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         }
     }
 
-    if (MPFR_Check(y)) {
+    if (CHECK_MPFRANY(y)) {
         if (PyIntOrLong_Check(x)) {
             int error;
             long tempi = GMPy_Integer_AsLongAndError(x, &error);
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_si_div(result->f, tempi, MPFR(y), GET_MPFR_ROUND(context));
                 result->rc = mpfr_floor(result->f, result->f);
@@ -349,7 +409,7 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
          * end by converting x to an mpfr. Ditto for rational.*/
 
         if (PyFloat_Check(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_d_div(result->f, PyFloat_AS_DOUBLE(x), MPFR(y), GET_MPFR_ROUND(context));
             result->rc = mpfr_floor(result->f, result->f);
@@ -371,7 +431,7 @@ GMPy_Real_FloorDiv(PyObject *x, PyObject *y, CTXT_Object *context)
             Py_DECREF((PyObject*)result);
             return NULL;
         }
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_div(result->f, MPFR(tempx), MPFR(tempy), GET_MPFR_ROUND(context));
         result->rc = mpfr_floor(result->f, result->f);
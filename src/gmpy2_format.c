@@ -209,7 +209,7 @@ GMPy_MPFR_Format(PyObject *self, PyObject *args)
     int seensign = 0, seenalign = 0, seendecimal = 0, seendigits = 0;
     int seenround = 0, seenconv = 0;
 
-    if (!MPFR_Check(self)) {
+    if (!CHECK_MPFRANY(self)) {
         TYPE_ERROR("requires mpfr type");
         return NULL;
     }
@@ -388,7 +388,7 @@ GMPy_MPC_Format(PyObject *self, PyObject *args)
     int seensign = 0, seenalign = 0, seendecimal = 0, seendigits = 0;
     int seenround = 0, seenconv = 0, seenstyle = 0, mpcstyle = 0;
 
-    if (!MPC_Check(self)) {
+    if (!CHECK_MPCANY(self)) {
         TYPE_ERROR("requires 'mpc' object");
         return NULL;
     }
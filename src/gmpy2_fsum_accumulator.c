@@ -0,0 +1,522 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_fsum_accumulator.c                                                *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* fsum_accumulator keeps an exact running sum so a stream of values can be
+ * summed with a single correctly rounded result without first storing all
+ * the values, as fsum() does.
+ *
+ * Each finite value is decomposed as m * 2**e, where m is an integer, and
+ * added to a fixed-point block sum * 2**exp. A block is shifted left
+ * whenever a value with a smaller exponent is added, so its size is bounded
+ * by the spread between the exponents of the values it holds.
+ *
+ * A value is only added to a block if the gap between their bits is at most
+ * FSUM_GAP_MAX bits. Otherwise it starts a new block, so values with widely
+ * separated exponents (possible with mpfr values and a large exponent
+ * range) do not create a huge integer. The blocks are kept sorted and
+ * separated by more than FSUM_GAP_MAX bits. Sums of floats always fit in a
+ * single block. value() rounds a single block directly and adds several
+ * blocks exactly with mpfr_sum().
+ *
+ * Integers, floats, mpfr values, and rationals with a power of two
+ * denominator are added exactly. Other rationals are first rounded to the
+ * precision of the context, as in fsum().
+ */
+
+PyDoc_STRVAR(GMPy_doc_fsum_accumulator,
+"fsum_accumulator([context]) -> fsum_accumulator\n\n"
+"Return an object that maintains an exact sum of the real values added\n"
+"with add() or extend(). value() returns the sum correctly rounded using\n"
+"context, or the current context if no context was given.");
+
+static PyObject *
+GMPy_FsumAcc_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    FsumAcc_Object *result;
+    PyObject *context = NULL;
+    static char *kwlist[] = {"context", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "|O", kwlist, &context))
+        return NULL;
+
+    if (context == Py_None) {
+        context = NULL;
+    }
+    if (context && !CTXT_Check(context)) {
+        TYPE_ERROR("fsum_accumulator() argument must be a context");
+        return NULL;
+    }
+
+    if (!(result = (FsumAcc_Object*)type->tp_alloc(type, 0))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result->blocks = NULL;
+    result->count = 0;
+    result->allocated = 0;
+    mpz_init(result->temp);
+    Py_XINCREF(context);
+    result->context = (CTXT_Object*)context;
+    result->nan = 0;
+    result->pinf = 0;
+    result->ninf = 0;
+    result->poszero = 1;
+    result->negzero = 1;
+    return (PyObject*)result;
+}
+
+static void
+GMPy_FsumAcc_Dealloc(FsumAcc_Object *self)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < self->count; i++) {
+        mpz_clear(self->blocks[i].sum);
+    }
+    PyMem_Free(self->blocks);
+    mpz_clear(self->temp);
+    Py_XDECREF((PyObject*)self->context);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyObject *
+GMPy_FsumAcc_Repr(FsumAcc_Object *self)
+{
+    return Py_BuildValue("s", "<gmpy2.fsum_accumulator>");
+}
+
+#define FSUM_GAP_MAX ((mpfr_exp_t)1 << 16)
+
+/* Return the exponent just above the most significant bit of a block. */
+
+static mpfr_exp_t
+_GMPy_FsumAcc_Top(fsum_block *b)
+{
+    return b->exp + (mpfr_exp_t)mpz_sizeinbase(b->sum, 2);
+}
+
+/* Add m * 2**e to a block that is within FSUM_GAP_MAX bits of it. The value
+ * of m is destroyed.
+ */
+
+static void
+_GMPy_FsumAcc_Block_Add(FsumAcc_Object *self, fsum_block *b, mpz_ptr m, mpfr_exp_t e)
+{
+    if (e >= b->exp) {
+        mpz_mul_2exp(self->temp, m, e - b->exp);
+        mpz_add(b->sum, b->sum, self->temp);
+    }
+    else {
+        mpz_mul_2exp(b->sum, b->sum, b->exp - e);
+        mpz_add(b->sum, b->sum, m);
+        b->exp = e;
+    }
+}
+
+static void
+_GMPy_FsumAcc_Remove(FsumAcc_Object *self, Py_ssize_t i)
+{
+    mpz_clear(self->blocks[i].sum);
+    self->count--;
+    memmove(&self->blocks[i], &self->blocks[i + 1],
+            (self->count - i) * sizeof(fsum_block));
+}
+
+/* Add m * 2**e to the accumulator. The value of m is destroyed. Returns 0
+ * if successful, otherwise sets an exception and returns -1.
+ */
+
+static int
+_GMPy_FsumAcc_Add_Z(FsumAcc_Object *self, mpz_ptr m, mpfr_exp_t e)
+{
+    mp_bitcnt_t zeros;
+    mpfr_exp_t top;
+    fsum_block *b;
+    Py_ssize_t lo, hi, mid;
+
+    if (!mpz_sgn(m)) {
+        self->negzero = 0;
+        return 0;
+    }
+    self->poszero = 0;
+    self->negzero = 0;
+
+    /* Remove trailing zero bits so a block is only shifted when the value
+     * really has a smaller exponent.
+     */
+    zeros = mpz_scan1(m, 0);
+    if (zeros) {
+        mpz_tdiv_q_2exp(m, m, zeros);
+        e += zeros;
+    }
+    top = e + (mpfr_exp_t)mpz_sizeinbase(m, 2);
+
+    /* Find the first block that ends less than FSUM_GAP_MAX bits below m. */
+    lo = 0;
+    hi = self->count;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (_GMPy_FsumAcc_Top(&self->blocks[mid]) + FSUM_GAP_MAX < e)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo < self->count && self->blocks[lo].exp <= top + FSUM_GAP_MAX) {
+        b = &self->blocks[lo];
+        _GMPy_FsumAcc_Block_Add(self, b, m, e);
+
+        /* The block may have grown to within FSUM_GAP_MAX bits of the
+         * following blocks.
+         */
+        while (lo + 1 < self->count &&
+               self->blocks[lo + 1].exp <= _GMPy_FsumAcc_Top(b) + FSUM_GAP_MAX) {
+            _GMPy_FsumAcc_Block_Add(self, b, self->blocks[lo + 1].sum,
+                                    self->blocks[lo + 1].exp);
+            _GMPy_FsumAcc_Remove(self, lo + 1);
+        }
+        if (!mpz_sgn(b->sum)) {
+            _GMPy_FsumAcc_Remove(self, lo);
+        }
+        return 0;
+    }
+
+    if (self->count == self->allocated) {
+        Py_ssize_t newalloc = self->allocated ? self->allocated * 2 : 4;
+        fsum_block *temp;
+
+        if (!(temp = PyMem_Resize(self->blocks, fsum_block, newalloc))) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        self->blocks = temp;
+        self->allocated = newalloc;
+    }
+    memmove(&self->blocks[lo + 1], &self->blocks[lo],
+            (self->count - lo) * sizeof(fsum_block));
+    self->count++;
+    b = &self->blocks[lo];
+    mpz_init(b->sum);
+    mpz_swap(b->sum, m);
+    b->exp = e;
+    return 0;
+}
+
+static int
+_GMPy_FsumAcc_Add_MPFR(FsumAcc_Object *self, mpfr_srcptr f)
+{
+    mpfr_exp_t e;
+
+    if (mpfr_regular_p(f)) {
+        e = mpfr_get_z_2exp(global.tempz, f);
+        return _GMPy_FsumAcc_Add_Z(self, global.tempz, e);
+    }
+    else if (mpfr_zero_p(f)) {
+        if (mpfr_signbit(f))
+            self->poszero = 0;
+        else
+            self->negzero = 0;
+    }
+    else {
+        self->poszero = 0;
+        self->negzero = 0;
+        if (mpfr_nan_p(f))
+            self->nan = 1;
+        else if (mpfr_signbit(f))
+            self->ninf = 1;
+        else
+            self->pinf = 1;
+    }
+    return 0;
+}
+
+/* Add a real value to the accumulator. Returns 0 if successful, otherwise
+ * sets an exception and returns -1.
+ */
+
+static int
+_GMPy_FsumAcc_Add_Value(FsumAcc_Object *self, PyObject *x)
+{
+    MPFR_Object *tempx;
+    CTXT_Object *context = self->context;
+    int e;
+
+    if (CHECK_MPFRANY(x)) {
+        return _GMPy_FsumAcc_Add_MPFR(self, MPFR(x));
+    }
+
+    if (PyFloat_Check(x)) {
+        double d = PyFloat_AS_DOUBLE(x);
+
+        if (d != 0.0 && !Py_IS_NAN(d) && !Py_IS_INFINITY(d)) {
+            /* frexp() returns a value with at most DBL_MANT_DIG bits, so
+             * scaling it by 2**DBL_MANT_DIG gives an exact integer.
+             */
+            d = frexp(d, &e);
+            mpz_set_d(global.tempz, ldexp(d, DBL_MANT_DIG));
+            return _GMPy_FsumAcc_Add_Z(self, global.tempz, (mpfr_exp_t)e - DBL_MANT_DIG);
+        }
+    }
+
+    if (PyIntOrLong_Check(x)) {
+        mpz_set_PyIntOrLong(global.tempz, x);
+        return _GMPy_FsumAcc_Add_Z(self, global.tempz, 0);
+    }
+
+    if (CHECK_MPZANY(x)) {
+        mpz_set(global.tempz, MPZ(x));
+        return _GMPy_FsumAcc_Add_Z(self, global.tempz, 0);
+    }
+
+    if (MPQ_Check(x) || XMPQ_Check(x)) {
+        mpz_srcptr den;
+
+        if (XMPQ_Check(x)) {
+            GMPy_XMPQ_Canonicalize(x);
+        }
+        den = mpq_denref(MPQ(x));
+        if (mpz_scan1(den, 0) == mpz_sizeinbase(den, 2) - 1) {
+            mpz_set(global.tempz, mpq_numref(MPQ(x)));
+            return _GMPy_FsumAcc_Add_Z(self, global.tempz, -(mpfr_exp_t)mpz_scan1(den, 0));
+        }
+    }
+
+    if (!IS_REAL(x)) {
+        TYPE_ERROR("fsum_accumulator.add() argument must be a real number");
+        return -1;
+    }
+
+    if (!context) {
+        CHECK_CONTEXT(context);
+    }
+
+    if (!(tempx = GMPy_MPFR_From_Real(x, 1, context))) {
+        return -1;
+    }
+    if (_GMPy_FsumAcc_Add_MPFR(self, tempx->f) < 0) {
+        Py_DECREF((PyObject*)tempx);
+        return -1;
+    }
+    Py_DECREF((PyObject*)tempx);
+    return 0;
+}
+
+PyDoc_STRVAR(GMPy_doc_fsum_accumulator_add,
+"add(x)\n\n"
+"Add the real value x to the sum.");
+
+static PyObject *
+GMPy_FsumAcc_Add(FsumAcc_Object *self, PyObject *other)
+{
+    if (_GMPy_FsumAcc_Add_Value(self, other) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(GMPy_doc_fsum_accumulator_extend,
+"extend(iterable)\n\n"
+"Add all the real values of an iterable to the sum. The values are\n"
+"consumed one at a time.");
+
+static PyObject *
+GMPy_FsumAcc_Extend(FsumAcc_Object *self, PyObject *other)
+{
+    PyObject *iter, *item;
+
+    if (!(iter = PyObject_GetIter(other))) {
+        return NULL;
+    }
+
+    while ((item = PyIter_Next(iter))) {
+        if (_GMPy_FsumAcc_Add_Value(self, item) < 0) {
+            Py_DECREF(item);
+            Py_DECREF(iter);
+            return NULL;
+        }
+        Py_DECREF(item);
+    }
+    Py_DECREF(iter);
+
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/* Round the exact sum of several blocks. Each block is converted to an mpfr
+ * with just enough precision to hold it exactly. Returns the ternary value,
+ * or sets an exception and returns -2 if memory could not be allocated.
+ */
+
+static int
+_GMPy_FsumAcc_Sum_Blocks(FsumAcc_Object *self, mpfr_ptr r, mpfr_rnd_t rnd)
+{
+    mpfr_t *terms;
+    mpfr_ptr *tab;
+    mpfr_prec_t prec;
+    Py_ssize_t i;
+    int rc;
+
+    if (!(terms = PyMem_New(mpfr_t, self->count)) ||
+        !(tab = PyMem_New(mpfr_ptr, self->count))) {
+        PyMem_Free(terms);
+        PyErr_NoMemory();
+        return -2;
+    }
+
+    for (i = 0; i < self->count; i++) {
+        prec = (mpfr_prec_t)mpz_sizeinbase(self->blocks[i].sum, 2);
+        mpfr_init2(terms[i], prec < MPFR_PREC_MIN ? MPFR_PREC_MIN : prec);
+        mpfr_set_z_2exp(terms[i], self->blocks[i].sum, self->blocks[i].exp, MPFR_RNDN);
+        tab[i] = terms[i];
+    }
+
+    rc = mpfr_sum(r, tab, (unsigned long)self->count, rnd);
+
+    for (i = 0; i < self->count; i++) {
+        mpfr_clear(terms[i]);
+    }
+    PyMem_Free(terms);
+    PyMem_Free(tab);
+    return rc;
+}
+
+PyDoc_STRVAR(GMPy_doc_fsum_accumulator_value,
+"value() -> mpfr\n\n"
+"Return the sum correctly rounded to the precision of the context.");
+
+static PyObject *
+GMPy_FsumAcc_Value(FsumAcc_Object *self, PyObject *other)
+{
+    MPFR_Object *result;
+    CTXT_Object *context = self->context;
+
+    if (!context) {
+        CHECK_CONTEXT(context);
+    }
+
+    if (!(result = GMPy_MPFR_New(0, context))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    GMPY_MPFR_CLEAR_FLAGS(context);
+
+    result->rc = 0;
+    if (self->nan || (self->pinf && self->ninf)) {
+        mpfr_set_nan(result->f);
+    }
+    else if (self->pinf || self->ninf) {
+        mpfr_set_inf(result->f, self->pinf ? 1 : -1);
+    }
+    else if (self->count == 1) {
+        result->rc = mpfr_set_z_2exp(result->f, self->blocks[0].sum,
+                                     self->blocks[0].exp, GET_MPFR_ROUND(context));
+    }
+    else if (self->count > 1) {
+        result->rc = _GMPy_FsumAcc_Sum_Blocks(self, result->f, GET_MPFR_ROUND(context));
+        if (result->rc == -2) {
+            Py_DECREF((PyObject*)result);
+            return NULL;
+        }
+    }
+    else if (self->poszero) {
+        mpfr_set_zero(result->f, 1);
+    }
+    else if (self->negzero) {
+        mpfr_set_zero(result->f, -1);
+    }
+    else {
+        /* As in IEEE 754, an exact zero sum of values of different signs
+         * is -0 when rounding toward -Inf and +0 otherwise.
+         */
+        mpfr_set_zero(result->f, GET_MPFR_ROUND(context) == MPFR_RNDD ? -1 : 1);
+    }
+
+    _GMPy_MPFR_Cleanup(&result, context);
+    return (PyObject*)result;
+}
+
+static PyMethodDef GMPy_FsumAcc_methods[] =
+{
+    { "add", (PyCFunction)GMPy_FsumAcc_Add, METH_O, GMPy_doc_fsum_accumulator_add },
+    { "extend", (PyCFunction)GMPy_FsumAcc_Extend, METH_O, GMPy_doc_fsum_accumulator_extend },
+    { "value", (PyCFunction)GMPy_FsumAcc_Value, METH_NOARGS, GMPy_doc_fsum_accumulator_value },
+    { NULL, NULL, 1 }
+};
+
+static PyTypeObject FsumAcc_Type =
+{
+#ifdef PY3
+    PyVarObject_HEAD_INIT(0, 0)
+#else
+    PyObject_HEAD_INIT(0)
+        0,                                  /* ob_size          */
+#endif
+    "fsum_accumulator",                     /* tp_name          */
+    sizeof(FsumAcc_Object),                 /* tp_basicsize     */
+        0,                                  /* tp_itemsize      */
+    (destructor) GMPy_FsumAcc_Dealloc,      /* tp_dealloc       */
+        0,                                  /* tp_print         */
+        0,                                  /* tp_getattr       */
+        0,                                  /* tp_setattr       */
+        0,                                  /* tp_reserved      */
+    (reprfunc) GMPy_FsumAcc_Repr,           /* tp_repr          */
+        0,                                  /* tp_as_number     */
+        0,                                  /* tp_as_sequence   */
+        0,                                  /* tp_as_mapping    */
+        0,                                  /* tp_hash          */
+        0,                                  /* tp_call          */
+        0,                                  /* tp_str           */
+        0,                                  /* tp_getattro      */
+        0,                                  /* tp_setattro      */
+        0,                                  /* tp_as_buffer     */
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags         */
+    GMPy_doc_fsum_accumulator,              /* tp_doc           */
+        0,                                  /* tp_traverse      */
+        0,                                  /* tp_clear         */
+        0,                                  /* tp_richcompare   */
+        0,                                  /* tp_weaklistoffset*/
+        0,                                  /* tp_iter          */
+        0,                                  /* tp_iternext      */
+    GMPy_FsumAcc_methods,                   /* tp_methods       */
+        0,                                  /* tp_members       */
+        0,                                  /* tp_getset        */
+        0,                                  /* tp_base          */
+        0,                                  /* tp_dict          */
+        0,                                  /* tp_descr_get     */
+        0,                                  /* tp_descr_set     */
+        0,                                  /* tp_dictoffset    */
+        0,                                  /* tp_init          */
+        0,                                  /* tp_alloc         */
+    GMPy_FsumAcc_NewInit,                   /* tp_new           */
+        0,                                  /* tp_free          */
+};
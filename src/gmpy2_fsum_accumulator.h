@@ -0,0 +1,72 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_fsum_accumulator.h                                                *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_FSUM_ACCUMULATOR_H
+#define GMPY_FSUM_ACCUMULATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* An exact running sum of real values. The finite part of the sum is kept
+ * as one or more fixed-point blocks sum * 2**exp; special values are tracked
+ * with flags so the sum is only rounded when value() is called.
+ */
+
+typedef struct {
+    mpz_t sum;                  /* never 0 */
+    mpfr_exp_t exp;
+} fsum_block;
+
+typedef struct {
+    PyObject_HEAD
+    fsum_block *blocks;         /* sorted by exponent */
+    Py_ssize_t count;
+    Py_ssize_t allocated;
+    mpz_t temp;                 /* scratch space for the shifted term */
+    CTXT_Object *context;       /* NULL if the current context is used */
+    int nan;                    /* a NaN has been added */
+    int pinf;                   /* +Inf has been added */
+    int ninf;                   /* -Inf has been added */
+    int poszero;                /* all values added so far are +0 */
+    int negzero;                /* all values added so far are -0 */
+} FsumAcc_Object;
+
+static PyTypeObject FsumAcc_Type;
+#define FsumAcc_Check(v) (((PyObject*)v)->ob_type == &FsumAcc_Type)
+
+static PyObject * GMPy_FsumAcc_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void       GMPy_FsumAcc_Dealloc(FsumAcc_Object *self);
+static PyObject * GMPy_FsumAcc_Add(FsumAcc_Object *self, PyObject *other);
+static PyObject * GMPy_FsumAcc_Extend(FsumAcc_Object *self, PyObject *other);
+static PyObject * GMPy_FsumAcc_Value(FsumAcc_Object *self, PyObject *other);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
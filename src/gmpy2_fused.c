@@ -109,7 +109,7 @@ _GMPy_MPFR_FMA(PyObject *x, PyObject *y, PyObject *z, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_fma(result->f, MPFR(x), MPFR(y), MPFR(z), GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
@@ -271,7 +271,7 @@ _GMPy_MPFR_FMS(PyObject *x, PyObject *y, PyObject *z, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_fms(result->f, MPFR(x), MPFR(y), MPFR(z), GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
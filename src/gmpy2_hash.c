@@ -62,10 +62,65 @@ GMPy_MPZ_Hash_Slot(MPZ_Object *self)
 #endif
 }
 
+#if defined(_PyHASH_MODULUS) && _PyHASH_BITS < GMP_NUMB_BITS
+/* Return the inverse of 0 < d < _PyHASH_MODULUS. The extended Euclidean
+ * coefficients are bounded by the modulus so q * x1 fits in 64 bits.
+ */
+
+static mp_limb_t
+_GMPy_Hash_Invert(mp_limb_t d)
+{
+    int64_t a = (int64_t)_PyHASH_MODULUS, b = (int64_t)d;
+    int64_t x0 = 0, x1 = 1, q, t;
+
+    while (b) {
+        q = a / b;
+        t = a - q * b;
+        a = b;
+        b = t;
+        t = x0 - q * x1;
+        x0 = x1;
+        x1 = t;
+    }
+    return (mp_limb_t)(x0 < 0 ? x0 + (int64_t)_PyHASH_MODULUS : x0);
+}
+#endif
+
 static Py_hash_t
 GMPy_MPQ_Hash_Slot(MPQ_Object *self)
 {
-#ifdef _PyHASH_MODULUS
+#if defined(_PyHASH_MODULUS) && _PyHASH_BITS < GMP_NUMB_BITS
+    Py_hash_t hash;
+    mp_limb_t num, den, prod[2];
+
+    if (self->hash_cache != -1) {
+        return self->hash_cache;
+    }
+
+    /* Same as hash(Fraction): (abs(n) mod P) * pow(d, -1, P) mod P with the
+     * sign of n, or +/-inf when P divides d. Both values fit in one limb so
+     * no temporary mpz is needed.
+     */
+    den = mpn_mod_1(mpq_denref(self->q)->_mp_d, mpz_size(mpq_denref(self->q)),
+                    _PyHASH_MODULUS);
+    if (den == 0) {
+        hash = _PyHASH_INF;
+    }
+    else {
+        num = mpn_mod_1(mpq_numref(self->q)->_mp_d, mpz_size(mpq_numref(self->q)),
+                        _PyHASH_MODULUS);
+        prod[1] = mpn_mul_1(prod, &num, 1, _GMPy_Hash_Invert(den));
+        hash = (Py_hash_t)mpn_mod_1(prod, 2, _PyHASH_MODULUS);
+    }
+
+    if (mpz_sgn(mpq_numref(self->q)) < 0) {
+        hash = -hash;
+    }
+    if (hash == -1) {
+        hash = -2;
+    }
+    return (self->hash_cache = hash);
+#elif defined(_PyHASH_MODULUS)
     Py_hash_t hash = 0;
     mpz_t temp, temp1, mask;
 
@@ -134,6 +189,7 @@ _mpfr_hash(mpfr_t f)
     Py_uhash_t hash = 0;
     Py_ssize_t exp;
     size_t msize;
+    mp_limb_t *d;
     int sign;
 
     /* Handle special cases first */
@@ -151,20 +207,39 @@ _mpfr_hash(mpfr_t f)
         }
     }
 
-    /* Calculate the number of limbs in the mantissa. */
-    msize = (f->_mpfr_prec + mp_bits_per_limb - 1) / mp_bits_per_limb;
+    if (mpfr_zero_p(f)) {
+        return 0;
+    }
+    sign = mpfr_sgn(f) > 0 ? 1 : -1;
 
-    /* Calculate the hash of the mantissa. */
-    if (mpfr_sgn(f) > 0) {
-        hash = mpn_mod_1(f->_mpfr_d, msize, _PyHASH_MODULUS);
-        sign = 1;
+    /* Calculate the number of limbs in the mantissa. Low limbs that are
+     * zero do not change the hash once the exponent is adjusted, so only
+     * the significant limbs are reduced. Integral values with a high
+     * precision, for example, usually need a single limb.
+     */
+    msize = (f->_mpfr_prec + mp_bits_per_limb - 1) / mp_bits_per_limb;
+    d = f->_mpfr_d;
+    while (*d == 0) {
+        d++;
+        msize--;
     }
-    else if (mpfr_sgn(f) < 0) {
-        hash = mpn_mod_1(f->_mpfr_d, msize, _PyHASH_MODULUS);
-        sign = -1;
+
+    /* Calculate the hash of the mantissa. Since the modulus is 2**B-1, a
+     * single limb is reduced by adding its B-bit digits.
+     */
+#if _PyHASH_BITS < GMP_NUMB_BITS
+    if (msize == 1) {
+        mp_limb_t x = d[0];
+
+        while (x > _PyHASH_MODULUS) {
+            x = (x & _PyHASH_MODULUS) + (x >> _PyHASH_BITS);
+        }
+        hash = x == _PyHASH_MODULUS ? 0 : (Py_uhash_t)x;
     }
-    else {
-        return 0;
+    else
+#endif
+    {
+        hash = mpn_mod_1(d, msize, _PyHASH_MODULUS);
     }
 
     /* Calculate the final hash. */
@@ -48,8 +48,9 @@
  *     GMPy_MPC_NAME(x, context)
  *     GMPy_Complex_NAME(x, context)
  *     GMPy_Number_NAME(x, context)
- *     GMPy_Context_NAME(self, other)
- *     - called with METH_O
+ *     GMPy_Context_NAME(self, GMPY_KWARGS_PARAMS)
+ *     - called with GMPY_METH_KWARGS
+ *     - accepts optional precision= and round= keyword arguments
  *
  * GMPY_MPFR_MPC_UNIOP_TEMPLATE(NAME, FUNC) creates the following functions:
  *     GMPy_Number_NAME(x, context)
@@ -57,6 +58,14 @@
  *     GMPy_Context_NAME(self, other)
  *     - called with METH_O
  *
+ * GMPY_MPFR_MPC_UNIOP_TEMPLATE_EX(NAME, FUNC) creates the following functions:
+ *     GMPy_Number_NAME(x, context)
+ *     - assumes _GMPy_MPFR_NAME, GMPy_Real_NAME, _GMPy_MPC_NAME &
+ *       GMPy_Complex_NAME exist
+ *     GMPy_Context_NAME(self, GMPY_KWARGS_PARAMS)
+ *     - called with GMPY_METH_KWARGS
+ *     - accepts optional precision= and round= keyword arguments
+ *
  * GMPY_MPFR_MPC_TRIOP_EX(NAME, FUNC) creates the following functions:
  *     GMPy_Real_NAME(x, y, Z, context)
  *     GMPy_Complex_NAME(x, y, Z, context)
@@ -104,7 +113,7 @@ GMPy_Real_##NAME(PyObject *x, CTXT_Object *context) \
         Py_XDECREF((PyObject*)tempx); \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, tempx->f, GET_MPFR_ROUND(context)); \
     Py_DECREF((PyObject*)tempx); \
     _GMPy_MPFR_Cleanup(&result, context); \
@@ -120,7 +129,7 @@ _GMPy_MPFR_##NAME(PyObject *x, CTXT_Object *context) \
     if (!(result = GMPy_MPFR_New(0, context))) { \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, MPFR(x), GET_MPFR_ROUND(context)); \
     _GMPy_MPFR_Cleanup(&result, context); \
     return (PyObject*)result; \
@@ -178,16 +187,26 @@ GMPy_Number_##NAME(PyObject *x, CTXT_Object *context) \
     return NULL; \
 } \
 static PyObject * \
-GMPy_Context_##NAME(PyObject *self, PyObject *other) \
+GMPy_Context_##NAME(PyObject *self, GMPY_KWARGS_PARAMS) \
 { \
-    CTXT_Object *context = NULL; \
+    CTXT_Object *context = NULL, *local, temp_context; \
+    PyObject *result; \
+    if (GMPY_KWARGS_NARGS != 1) { \
+        TYPE_ERROR(#FUNC"() requires 1 argument"); \
+        return NULL; \
+    } \
     if (self && CTXT_Check(self)) { \
         context = (CTXT_Object*)self; \
     } \
     else { \
         CHECK_CONTEXT(context); \
     } \
-    return GMPy_Number_##NAME(other, context); \
+    if (!(local = GMPY_KWARGS_CONTEXT(context, &temp_context))) { \
+        return NULL; \
+    } \
+    result = GMPy_Number_##NAME(GMPY_KWARGS_ARG(0), local); \
+    GMPy_CTXT_Merge_Flags(context, local); \
+    return result; \
 }
 
 #define GMPY_MPFR_MPC_UNIOP_TEMPLATE(NAME, FUNC) \
@@ -230,16 +249,26 @@ GMPy_Number_##NAME(PyObject *x, CTXT_Object *context) \
     return NULL; \
 } \
 static PyObject * \
-GMPy_Context_##NAME(PyObject *self, PyObject *other) \
+GMPy_Context_##NAME(PyObject *self, GMPY_KWARGS_PARAMS) \
 { \
-    CTXT_Object *context = NULL; \
+    CTXT_Object *context = NULL, *local, temp_context; \
+    PyObject *result; \
+    if (GMPY_KWARGS_NARGS != 1) { \
+        TYPE_ERROR(#FUNC"() requires 1 argument"); \
+        return NULL; \
+    } \
     if (self && CTXT_Check(self)) { \
         context = (CTXT_Object*)self; \
     } \
     else { \
         CHECK_CONTEXT(context); \
     } \
-    return GMPy_Number_##NAME(other, context); \
+    if (!(local = GMPY_KWARGS_CONTEXT(context, &temp_context))) { \
+        return NULL; \
+    } \
+    result = GMPy_Number_##NAME(GMPY_KWARGS_ARG(0), local); \
+    GMPy_CTXT_Merge_Flags(context, local); \
+    return result; \
 }
 
 #define GMPY_MPFR_MPC_TRIOP_TEMPLATE(NAME, FUNC) \
@@ -296,7 +325,7 @@ GMPy_Real_##NAME(PyObject *x, CTXT_Object *context) \
         Py_XDECREF((PyObject*)tempx); \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, tempx->f, GET_MPFR_ROUND(context)); \
     Py_DECREF((PyObject*)tempx); \
     _GMPy_MPFR_Cleanup(&result, context); \
@@ -336,7 +365,7 @@ GMPy_Real_##NAME(PyObject *x, CTXT_Object *context) \
         Py_XDECREF((PyObject*)tempx); \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, tempx->f); \
     Py_DECREF((PyObject*)tempx); \
     _GMPy_MPFR_Cleanup(&result, context); \
@@ -383,7 +412,7 @@ GMPy_Real_##NAME(PyObject *x, CTXT_Object *context) \
         Py_XDECREF((PyObject*)tempx); \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, tempx->f); \
     Py_DECREF((PyObject*)tempx); \
     _GMPy_MPFR_Cleanup(&result, context); \
@@ -419,7 +448,7 @@ _GMPy_MPFR_##NAME(PyObject *x, CTXT_Object *context) \
     if (!(result = GMPy_MPFR_New(0, context))) { \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, MPFR(x), GET_MPFR_ROUND(context)); \
     _GMPy_MPFR_Cleanup(&result, context); \
     return (PyObject*)result; \
@@ -520,7 +549,7 @@ GMPy_Real_##NAME(PyObject *x, PyObject *y, CTXT_Object *context) \
         Py_XDECREF((PyObject*)result); \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, tempx->f, tempy->f, GET_MPFR_ROUND(context)); \
     Py_DECREF((PyObject*)tempx); \
     Py_DECREF((PyObject*)tempy); \
@@ -571,7 +600,7 @@ GMPy_Real_##NAME(PyObject *x, PyObject *y, CTXT_Object *context) \
         Py_XDECREF((PyObject*)result); \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, tempx->f, n, GET_MPFR_ROUND(context)); \
     Py_DECREF((PyObject*)tempx); \
     _GMPy_MPFR_Cleanup(&result, context); \
@@ -622,7 +651,7 @@ GMPy_Real_##NAME(PyObject *x, PyObject *y, CTXT_Object *context) \
         Py_XDECREF((PyObject*)result); \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, n, tempx->f, GET_MPFR_ROUND(context)); \
     Py_DECREF((PyObject*)tempx); \
     _GMPy_MPFR_Cleanup(&result, context); \
@@ -688,7 +717,7 @@ _GMPy_MPFR_##NAME(PyObject *x, PyObject *y, CTXT_Object *context) \
     if (!(result = GMPy_MPFR_New(0, context))) { \
         return NULL; \
     } \
-    mpfr_clear_flags(); \
+    GMPY_MPFR_CLEAR_FLAGS(context); \
     result->rc = mpfr_##FUNC(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context)); \
     _GMPy_MPFR_Cleanup(&result, context); \
     return (PyObject*)result; \
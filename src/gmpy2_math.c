@@ -499,7 +499,7 @@ _GMPy_MPFR_Acos(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_acos(result->f, MPFR(x), GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
@@ -582,7 +582,7 @@ _GMPy_MPFR_Asin(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_asin(result->f, MPFR(x), GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
@@ -665,7 +665,7 @@ _GMPy_MPFR_Atanh(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_atanh(result->f, MPFR(x), GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
@@ -761,7 +761,7 @@ _GMPy_MPFR_Sin_Cos(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     code = mpfr_sin_cos(s->f, c->f, MPFR(x), GET_MPFR_ROUND(context));
 
@@ -885,7 +885,7 @@ _GMPy_MPFR_Sinh_Cosh(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     code = mpfr_sinh_cosh(s->f, c->f, MPFR(x), GET_MPFR_ROUND(context));
 
@@ -971,7 +971,7 @@ GMPy_Context_Degrees(PyObject *self, PyObject *other)
     mpfr_const_pi(temp->f, MPFR_RNDN);
     mpfr_ui_div(temp->f, 180, temp->f, MPFR_RNDN);
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     mpfr_mul(result->f, temp->f, tempx->f, MPFR_RNDN);
 
@@ -1017,7 +1017,7 @@ GMPy_Context_Radians(PyObject *self, PyObject *other)
     mpfr_const_pi(temp->f, MPFR_RNDN);
     mpfr_div_ui(temp->f, temp->f, 180, MPFR_RNDN);
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     mpfr_mul(result->f, MPFR(self), temp->f, MPFR_RNDN);
 
@@ -1080,7 +1080,7 @@ _GMPy_MPFR_Sqrt(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_sqrt(result->f, MPFR(x), GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
@@ -1264,7 +1264,7 @@ GMPy_Real_Round2(PyObject *x, PyObject *y, CTXT_Object *context)
     mpfr_set(result->f, tempx->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_prec_round(result->f, n, GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
@@ -1333,7 +1333,7 @@ GMPy_Real_RelDiff(PyObject *x, PyObject *y, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     mpfr_reldiff(result->f, tempx->f, tempy->f, GET_MPFR_ROUND(context));
     result->rc = 0;
@@ -1433,7 +1433,7 @@ GMPy_Real_Modf(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     code = mpfr_modf(s->f, c->f, tempx->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -1489,7 +1489,7 @@ GMPy_Real_Lgamma(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     value->rc = mpfr_lgamma(value->f, &signp, tempx->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -1539,7 +1539,7 @@ GMPy_Real_RemQuo(PyObject *x, PyObject *y, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     value->rc = mpfr_remquo(value->f, &quobits, tempx->f, tempy->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -1580,7 +1580,7 @@ GMPy_Real_Frexp(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     value->rc = mpfr_frexp(&exp, value->f, tempx->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -1638,7 +1638,7 @@ GMPy_Context_NextToward(PyObject *self, PyObject *args)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     mpfr_set(result->f, tempx->f, GET_MPFR_ROUND(context));
     mpfr_nexttoward(result->f, tempy->f);
@@ -1688,7 +1688,7 @@ GMPy_Context_NextAbove(PyObject *self, PyObject *other)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     mpfr_set(result->f, tempx->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -1733,7 +1733,7 @@ GMPy_Context_NextBelow(PyObject *self, PyObject *other)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     mpfr_set(result->f, tempx->f, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -1785,7 +1785,7 @@ GMPy_Context_Factorial(PyObject *self, PyObject *other)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     mpfr_fac_ui(result->f, n, GET_MPFR_ROUND(context));
 
@@ -1867,7 +1867,7 @@ GMPy_Context_Fsum(PyObject *self, PyObject *other)
         tab[i] = temp->f;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     /* The cast is safe since we have compared seq_length to LONG_MAX. */
     result->rc = mpfr_sum(result->f, tab, (unsigned long)seq_length, GET_MPFR_ROUND(context));
@@ -1877,3 +1877,210 @@ GMPy_Context_Fsum(PyObject *self, PyObject *other)
     _GMPy_MPFR_Cleanup(&result, context);
     return (PyObject*)result;
 }
+
+/* Return a new list containing the values of an iterable converted exactly
+ * to mpfr. Returns NULL and sets an exception if an error occurs.
+ */
+
+static PyObject *
+_GMPy_MPFR_List_From_Iterable(PyObject *iterable, const char *name, CTXT_Object *context)
+{
+    PyObject *list;
+    MPFR_Object *temp;
+    Py_ssize_t i;
+
+    if (!(list = PySequence_List(iterable))) {
+        PyErr_Format(PyExc_TypeError, "%s() argument must be an iterable", name);
+        return NULL;
+    }
+
+    for (i = 0; i < PyList_GET_SIZE(list); i++) {
+        if (!(temp = GMPy_MPFR_From_Real(PyList_GET_ITEM(list, i), 1, context))) {
+            Py_DECREF(list);
+            PyErr_Format(PyExc_TypeError, "all items in %s() arguments must be real numbers", name);
+            return NULL;
+        }
+        if (PyList_SetItem(list, i, (PyObject*)temp) < 0) {
+            /* LCOV_EXCL_START */
+            Py_DECREF(list);
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+    }
+    return list;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_fdot,
+"fdot(x, y) -> mpfr\n\n"
+"Return the correctly rounded dot product of the real values in the\n"
+"iterables x and y, i.e. x[0]*y[0] + x[1]*y[1] + ... + x[n-1]*y[n-1].");
+
+PyDoc_STRVAR(GMPy_doc_context_fdot,
+"context.fdot(x, y) -> mpfr\n\n"
+"Return the correctly rounded dot product of the real values in the\n"
+"iterables x and y, i.e. x[0]*y[0] + x[1]*y[1] + ... + x[n-1]*y[n-1].");
+
+/* Each product is computed exactly, using a precision equal to the sum of
+ * the precisions of the operands, and the products are added with a
+ * single correctly rounded mpfr_sum().
+ */
+
+static PyObject *
+GMPy_Context_Fdot(PyObject *self, PyObject *args)
+{
+    MPFR_Object *result;
+    PyObject *xlist = NULL, *ylist = NULL;
+    mpfr_t *prods = NULL;
+    mpfr_ptr *tab = NULL;
+    mpfr_prec_t prec;
+    Py_ssize_t i, n;
+    CTXT_Object *context = NULL;
+
+    if (PyTuple_GET_SIZE(args) != 2) {
+        TYPE_ERROR("fdot() requires 2 arguments");
+        return NULL;
+    }
+
+    if (self && CTXT_Check(self)) {
+        context = (CTXT_Object*)self;
+    }
+    else {
+        CHECK_CONTEXT(context);
+    }
+
+    if (!(xlist = _GMPy_MPFR_List_From_Iterable(PyTuple_GET_ITEM(args, 0), "fdot", context)) ||
+        !(ylist = _GMPy_MPFR_List_From_Iterable(PyTuple_GET_ITEM(args, 1), "fdot", context))) {
+        Py_XDECREF(xlist);
+        return NULL;
+    }
+
+    n = PyList_GET_SIZE(xlist);
+    if (n != PyList_GET_SIZE(ylist)) {
+        VALUE_ERROR("fdot() arguments must have the same length");
+        goto error;
+    }
+    if (n > LONG_MAX) {
+        OVERFLOW_ERROR("temporary array is too large");
+        goto error;
+    }
+
+    if (!(result = GMPy_MPFR_New(0, context))) {
+        goto error;
+    }
+
+    if (n > 0 &&
+        (!(prods = (mpfr_t*)malloc(sizeof(mpfr_t) * n)) ||
+         !(tab = (mpfr_ptr*)malloc(sizeof(mpfr_ptr) * n)))) {
+        free(prods);
+        Py_DECREF((PyObject*)result);
+        Py_DECREF(xlist);
+        Py_DECREF(ylist);
+        return PyErr_NoMemory();
+    }
+
+    GMPY_MPFR_CLEAR_FLAGS(context);
+
+    for (i = 0; i < n; i++) {
+        mpfr_srcptr x = MPFR(PyList_GET_ITEM(xlist, i));
+        mpfr_srcptr y = MPFR(PyList_GET_ITEM(ylist, i));
+
+        prec = mpfr_get_prec(x) + mpfr_get_prec(y);
+        if (prec > MPFR_PREC_MAX) {
+            prec = MPFR_PREC_MAX;
+        }
+        mpfr_init2(prods[i], prec);
+        mpfr_mul(prods[i], x, y, MPFR_RNDN);
+        tab[i] = prods[i];
+    }
+
+    /* The cast is safe since we have compared n to LONG_MAX. */
+    result->rc = mpfr_sum(result->f, tab, (unsigned long)n, GET_MPFR_ROUND(context));
+
+    for (i = 0; i < n; i++) {
+        mpfr_clear(prods[i]);
+    }
+    free(prods);
+    free(tab);
+    Py_DECREF(xlist);
+    Py_DECREF(ylist);
+
+    _GMPy_MPFR_Cleanup(&result, context);
+    return (PyObject*)result;
+
+  error:
+    Py_DECREF(xlist);
+    Py_DECREF(ylist);
+    return NULL;
+}
+
+PyDoc_STRVAR(GMPy_doc_function_polyval,
+"polyval(coeffs, x) -> mpfr\n\n"
+"Return the value of the polynomial with the real coefficients coeffs at\n"
+"x, i.e. coeffs[0]*x**(n-1) + coeffs[1]*x**(n-2) + ... + coeffs[n-1].\n"
+"The polynomial is evaluated using Horner's method with a rounded fma()\n"
+"at each step.");
+
+PyDoc_STRVAR(GMPy_doc_context_polyval,
+"context.polyval(coeffs, x) -> mpfr\n\n"
+"Return the value of the polynomial with the real coefficients coeffs at\n"
+"x, i.e. coeffs[0]*x**(n-1) + coeffs[1]*x**(n-2) + ... + coeffs[n-1].\n"
+"The polynomial is evaluated using Horner's method with a rounded fma()\n"
+"at each step.");
+
+static PyObject *
+GMPy_Context_Polyval(PyObject *self, PyObject *args)
+{
+    MPFR_Object *result, *tempx;
+    PyObject *coeffs;
+    Py_ssize_t i, n;
+    CTXT_Object *context = NULL;
+
+    if (PyTuple_GET_SIZE(args) != 2) {
+        TYPE_ERROR("polyval() requires 2 arguments");
+        return NULL;
+    }
+
+    if (self && CTXT_Check(self)) {
+        context = (CTXT_Object*)self;
+    }
+    else {
+        CHECK_CONTEXT(context);
+    }
+
+    if (!(tempx = GMPy_MPFR_From_Real(PyTuple_GET_ITEM(args, 1), 1, context))) {
+        TYPE_ERROR("polyval() argument x must be a real number");
+        return NULL;
+    }
+
+    if (!(coeffs = _GMPy_MPFR_List_From_Iterable(PyTuple_GET_ITEM(args, 0), "polyval", context))) {
+        Py_DECREF((PyObject*)tempx);
+        return NULL;
+    }
+
+    if (!(result = GMPy_MPFR_New(0, context))) {
+        Py_DECREF((PyObject*)tempx);
+        Py_DECREF(coeffs);
+        return NULL;
+    }
+
+    GMPY_MPFR_CLEAR_FLAGS(context);
+
+    n = PyList_GET_SIZE(coeffs);
+    if (n == 0) {
+        mpfr_set_zero(result->f, 1);
+        result->rc = 0;
+    }
+    else {
+        result->rc = mpfr_set(result->f, MPFR(PyList_GET_ITEM(coeffs, 0)), GET_MPFR_ROUND(context));
+        for (i = 1; i < n; i++) {
+            result->rc = mpfr_fma(result->f, result->f, tempx->f,
+                                  MPFR(PyList_GET_ITEM(coeffs, i)), GET_MPFR_ROUND(context));
+        }
+    }
+
+    Py_DECREF((PyObject*)tempx);
+    Py_DECREF(coeffs);
+
+    _GMPy_MPFR_Cleanup(&result, context);
+    return (PyObject*)result;
+}
@@ -36,47 +36,47 @@ extern "C" {
 static PyObject * GMPy_Real_Sin(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Sin(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Sin(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Sin(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Sin(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Cos(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Cos(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Cos(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Cos(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Cos(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Tan(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Tan(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Tan(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Tan(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Tan(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Atan(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Atan(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Atan(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Atan(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Atan(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Sinh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Sinh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Sinh(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Sinh(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Sinh(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Cosh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Cosh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Cosh(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Cosh(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Cosh(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Tanh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Tanh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Tanh(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Tanh(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Tanh(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Asinh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Asinh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Asinh(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Asinh(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Asinh(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Acosh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Acosh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Acosh(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Acosh(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Acosh(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Sec(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Sec(PyObject *x, CTXT_Object *context);
@@ -105,22 +105,22 @@ static PyObject * GMPy_Context_Coth(PyObject *self, PyObject *other);
 static PyObject * GMPy_Real_Acos(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Acos(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Acos(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Acos(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Acos(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Asin(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Asin(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Asin(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Asin(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Asin(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Atanh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Atanh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Atanh(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Atanh(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Atanh(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Sin_Cos(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Sin_Cos(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Sin_Cos(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Sin_Cos(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Sin_Cos(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Sinh_Cosh(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Sinh_Cosh(PyObject *x, CTXT_Object *context);
@@ -140,22 +140,22 @@ static PyObject * GMPy_Context_Radians(PyObject *self, PyObject *other);
 static PyObject * GMPy_Real_Log(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Log(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Log(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Log(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Log(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Log10(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Log10(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Log10(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Log10(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Log10(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Exp(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Exp(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Exp(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Exp(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Exp(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_Sqrt(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Complex_Sqrt(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_Sqrt(PyObject *x, CTXT_Object *context);
-static PyObject * GMPy_Context_Sqrt(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Sqrt(PyObject *self, GMPY_KWARGS_PARAMS);
 
 static PyObject * GMPy_Real_RecSqrt(PyObject *x, CTXT_Object *context);
 static PyObject * GMPy_Number_RecSqrt(PyObject *x, CTXT_Object *context);
@@ -349,6 +349,8 @@ static PyObject * GMPy_Context_NextBelow(PyObject *self, PyObject *other);
 static PyObject * GMPy_Context_Factorial(PyObject *self, PyObject *other);
 
 static PyObject * GMPy_Context_Fsum(PyObject *self, PyObject *other);
+static PyObject * GMPy_Context_Fdot(PyObject *self, PyObject *args);
+static PyObject * GMPy_Context_Polyval(PyObject *self, PyObject *args);
 
 #ifdef __cplusplus
 }
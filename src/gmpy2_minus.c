@@ -131,7 +131,7 @@ _GMPy_MPFR_Minus(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_neg(result->f, MPFR(x), GET_MPFR_ROUND(context));
     _GMPy_MPFR_Cleanup(&result, context);
@@ -174,7 +174,7 @@ GMPy_printf(PyObject *self, PyObject *args)
         }
         return result;
     }
-    else if(MPFR_Check(x)) {
+    else if(CHECK_MPFRANY(x)) {
         generic = MPFR(x);
         buflen = mpfr_asprintf(&buffer, fmtcode, generic);
         if (buflen < 0) {
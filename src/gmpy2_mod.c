@@ -140,12 +140,30 @@ GMPy_Integer_Mod(PyObject *x, PyObject *y, CTXT_Object *context)
     Py_RETURN_NOTIMPLEMENTED;
 }
 
+/* Remainder of the floor division of two C longs. b must not be 0. */
+
+static long
+_GMPy_Mod_si(long a, long b)
+{
+    long r = a % b;
+
+    if (r != 0 && ((r < 0) != (b < 0)))
+        r += b;
+    return r;
+}
+
 static PyObject *
 GMPy_MPZ_Mod_Slot(PyObject *x, PyObject *y)
 {
-    if (MPZ_Check(x) && MPZ_Check(y)) {
-        MPZ_Object *result = NULL;
+    MPZ_Object *result = NULL;
+    long temp, small;
 
+    if (MPZ_Check(x) && MPZ_Check(y)) {
+        if (GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            GMPy_MPZ_GetSmall(MPZ(y), &temp) && temp != 0 &&
+            MPZ_IS_INTERNED(_GMPy_Mod_si(small, temp))) {
+            return GMPy_MPZ_Intern(_GMPy_Mod_si(small, temp));
+        }
         if ((result = GMPy_MPZ_New(NULL))) {
             if (mpz_sgn(MPZ(y)) == 0) {
                 ZERO_ERROR("division or modulo by zero");
@@ -157,6 +175,45 @@ GMPy_MPZ_Mod_Slot(PyObject *x, PyObject *y)
         return (PyObject*)result;
     }
 
+    /* Fast paths for an mpz and a small Python integer. */
+    if (MPZ_Check(x) && IS_SMALL_PYINT(y)) {
+        temp = SMALL_PYINT_AS_LONG(y);
+        if (temp == 0) {
+            ZERO_ERROR("division or modulo by zero");
+            return NULL;
+        }
+        if (GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            MPZ_IS_INTERNED(_GMPy_Mod_si(small, temp))) {
+            return GMPy_MPZ_Intern(_GMPy_Mod_si(small, temp));
+        }
+        if ((result = GMPy_MPZ_New(NULL))) {
+            if (temp > 0) {
+                mpz_fdiv_r_ui(result->z, MPZ(x), temp);
+            }
+            else {
+                mpz_cdiv_r_ui(result->z, MPZ(x), -temp);
+            }
+        }
+        return (PyObject*)result;
+    }
+
+    if (IS_SMALL_PYINT(x) && MPZ_Check(y)) {
+        if (mpz_sgn(MPZ(y)) == 0) {
+            ZERO_ERROR("division or modulo by zero");
+            return NULL;
+        }
+        temp = SMALL_PYINT_AS_LONG(x);
+        if (GMPy_MPZ_GetSmall(MPZ(y), &small) &&
+            MPZ_IS_INTERNED(_GMPy_Mod_si(temp, small))) {
+            return GMPy_MPZ_Intern(_GMPy_Mod_si(temp, small));
+        }
+        if ((result = GMPy_MPZ_New(NULL))) {
+            mpz_set_si(result->z, temp);
+            mpz_fdiv_r(result->z, result->z, MPZ(y));
+        }
+        return (PyObject*)result;
+    }
+
     if (IS_INTEGER(x) && IS_INTEGER(y))
         return GMPy_Integer_Mod(x, y, NULL);
 
@@ -253,18 +310,18 @@ GMPy_Real_Mod(PyObject *x, PyObject *y, CTXT_Object *context)
             goto error;
         }
         if (mpfr_zero_p(tempy->f)) {
-            context->ctx.divzero = 1;
+            GMPY_SET_FLAG(context, divzero);
             if (context->ctx.traps & TRAP_DIVZERO) {
                 GMPY_DIVZERO("mod() modulo by zero");
                 goto error;
             }
         }
 
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         if (mpfr_nan_p(tempx->f) || mpfr_nan_p(tempy->f) || mpfr_inf_p(tempx->f)) {
 
-            context->ctx.invalid = 1;
+            GMPY_SET_FLAG(context, invalid);
             if (context->ctx.traps & TRAP_INVALID) {
                 GMPY_INVALID("mod() invalid operation");
                 goto error;
@@ -272,7 +329,7 @@ GMPy_Real_Mod(PyObject *x, PyObject *y, CTXT_Object *context)
             mpfr_set_nan(result->f);
         }
         else if (mpfr_inf_p(tempy->f)) {
-            context->ctx.invalid = 1;
+            GMPY_SET_FLAG(context, invalid);
             if (context->ctx.traps & TRAP_INVALID) {
                 GMPY_INVALID("mod() invalid operation");
                 goto error;
@@ -99,22 +99,27 @@ _GMPy_MPC_Cleanup(MPC_Object **v, CTXT_Object *ctext)
         int rcr, rci;
         rcr = MPC_INEX_RE((*v)->rc);
         rci = MPC_INEX_IM((*v)->rc);
+        if (!GMPY_TRACK_FLAGS(ctext)) {
+            return;
+        }
         if (MPC_IS_NAN_P(*v)) {
-            ctext->ctx.invalid = 1;
             _invalid = 1;
         }
         if ((*v)->rc) {
-            ctext->ctx.inexact = 1;
             _inexact = 1;
         }
         if ((rcr && mpfr_zero_p(mpc_realref((*v)->c))) || (rci && mpfr_zero_p(mpc_imagref((*v)->c)))) {
-            ctext->ctx.underflow = 1;
             _underflow = 1;
         }
         if ((rcr && mpfr_inf_p(mpc_realref((*v)->c))) || (rci && mpfr_inf_p(mpc_imagref((*v)->c)))) {
-            ctext->ctx.overflow = 1;
             _overflow = 1;
         }
+        if (ctext->ctx.track_flags) {
+            ctext->ctx.invalid |= _invalid;
+            ctext->ctx.inexact |= _inexact;
+            ctext->ctx.underflow |= _underflow;
+            ctext->ctx.overflow |= _overflow;
+        }
         if (ctext->ctx.traps) {
             if ((ctext->ctx.traps & TRAP_UNDERFLOW) && _underflow) { \
                 GMPY_UNDERFLOW("underflow");
@@ -170,8 +175,9 @@ PyDoc_STRVAR(GMPy_doc_mpc,
 
 static PyMethodDef Pympc_methods[] =
 {
-    { "__complex__", GMPy_PyComplex_From_MPC, METH_O, GMPy_doc_mpc_complex },
+    { "__complex__", GMPy_PyComplex_From_MPC, METH_NOARGS, GMPy_doc_mpc_complex },
     { "__format__", GMPy_MPC_Format, METH_VARARGS, GMPy_doc_mpc_format },
+    { "__reduce_ex__", GMPy_MPANY_Method_ReduceEx, METH_VARARGS, GMPy_doc_method_reduce_ex },
     { "__sizeof__", GMPy_MPC_SizeOf_Method, METH_NOARGS, GMPy_doc_mpc_sizeof_method },
     { "conjugate", GMPy_MPC_Conjugate_Method, METH_NOARGS, GMPy_doc_mpc_conjugate_method },
     { "digits", GMPy_MPC_Digits_Method, METH_VARARGS, GMPy_doc_mpc_digits_method },
@@ -147,19 +147,19 @@ static PyTypeObject MPC_Type;
         rcr = MPC_INEX_RE(V->rc); \
         rci = MPC_INEX_IM(V->rc); \
         if (MPC_IS_NAN_P(V)) { \
-            CTX->ctx.invalid = 1; \
+            GMPY_SET_FLAG(CTX, invalid); \
             _invalid = 1; \
         } \
         if (V->rc) { \
-            CTX->ctx.inexact = 1; \
+            GMPY_SET_FLAG(CTX, inexact); \
             _inexact = 1; \
         } \
         if ((rcr && mpfr_zero_p(mpc_realref(V->c))) || (rci && mpfr_zero_p(mpc_imagref(V->c)))) { \
-            CTX->ctx.underflow = 1; \
+            GMPY_SET_FLAG(CTX, underflow); \
             _underflow = 1; \
         } \
         if ((rcr && mpfr_inf_p(mpc_realref(V->c))) || (rci && mpfr_inf_p(mpc_imagref(V->c)))) { \
-            CTX->ctx.overflow = 1; \
+            GMPY_SET_FLAG(CTX, overflow); \
             _overflow = 1; \
         } \
         if (CTX->ctx.traps) { \
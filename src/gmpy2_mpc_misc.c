@@ -109,7 +109,7 @@ GMPy_Complex_Norm(PyObject *x, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpc_norm(result->f, tempx->c, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
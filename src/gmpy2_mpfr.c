@@ -63,11 +63,13 @@ _GMPy_MPFR_Cleanup(MPFR_Object **v, CTXT_Object *ctext)
     }
 
     /* GMPY_MPFR_EXCEPTIONS(V, CTX) */
-    ctext->ctx.underflow |= mpfr_underflow_p();
-    ctext->ctx.overflow |= mpfr_overflow_p();
-    ctext->ctx.invalid |= mpfr_nanflag_p();
-    ctext->ctx.inexact |= mpfr_inexflag_p();
-    ctext->ctx.divzero |= mpfr_divby0_p();
+    if (ctext->ctx.track_flags) {
+        ctext->ctx.underflow |= mpfr_underflow_p();
+        ctext->ctx.overflow |= mpfr_overflow_p();
+        ctext->ctx.invalid |= mpfr_nanflag_p();
+        ctext->ctx.inexact |= mpfr_inexflag_p();
+        ctext->ctx.divzero |= mpfr_divby0_p();
+    }
     if (ctext->ctx.traps) {
         if ((ctext->ctx.traps & TRAP_UNDERFLOW) && mpfr_underflow_p()) {
             PyErr_SetString(GMPyExc_Underflow, "underflow");
@@ -220,6 +222,7 @@ static PyMethodDef Pympfr_methods [] =
     { "__floor__", GMPy_MPFR_Method_Floor, METH_NOARGS, GMPy_doc_mpfr_floor_method },
     { "__format__", GMPy_MPFR_Format, METH_VARARGS, GMPy_doc_mpfr_format },
     { "__round__", GMPy_MPFR_Method_Round10, METH_VARARGS, GMPy_doc_method_round10 },
+    { "__reduce_ex__", GMPy_MPANY_Method_ReduceEx, METH_VARARGS, GMPy_doc_method_reduce_ex },
     { "__sizeof__", GMPy_MPFR_SizeOf_Method, METH_NOARGS, GMPy_doc_mpfr_sizeof_method },
     { "__trunc__", GMPy_MPFR_Method_Trunc, METH_NOARGS, GMPy_doc_mpfr_trunc_method },
     { "as_integer_ratio", GMPy_MPFR_Integer_Ratio_Method, METH_NOARGS, GMPy_doc_method_integer_ratio },
@@ -138,15 +138,33 @@ static PyTypeObject MPFR_Type;
         mpfr_set_emax(_oldemax); \
     }
 
+/* The MPFR exception flags only need to be cleared and inspected if the
+ * context records them (track_flags is True) or if any trap is enabled.
+ */
+
+#define GMPY_TRACK_FLAGS(CTX) ((CTX)->ctx.track_flags || (CTX)->ctx.traps)
+
+#define GMPY_MPFR_CLEAR_FLAGS(CTX) \
+    (GMPY_TRACK_FLAGS(CTX) ? mpfr_clear_flags() : (void)0)
+
+/* Set one exception flag directly, for results that are not computed by
+ * MPFR. The flag is only recorded if track_flags is True.
+ */
+
+#define GMPY_SET_FLAG(CTX, FLAG) \
+    ((CTX)->ctx.track_flags ? (void)((CTX)->ctx.FLAG = 1) : (void)0)
+
 /* Exceptions should be checked in order of least important to most important.
  */
 
 #define GMPY_MPFR_EXCEPTIONS(V, CTX) \
-    CTX->ctx.underflow |= mpfr_underflow_p(); \
-    CTX->ctx.overflow |= mpfr_overflow_p(); \
-    CTX->ctx.invalid |= mpfr_nanflag_p(); \
-    CTX->ctx.inexact |= mpfr_inexflag_p(); \
-    CTX->ctx.divzero |= mpfr_divby0_p(); \
+    if (CTX->ctx.track_flags) { \
+        CTX->ctx.underflow |= mpfr_underflow_p(); \
+        CTX->ctx.overflow |= mpfr_overflow_p(); \
+        CTX->ctx.invalid |= mpfr_nanflag_p(); \
+        CTX->ctx.inexact |= mpfr_inexflag_p(); \
+        CTX->ctx.divzero |= mpfr_divby0_p(); \
+    } \
     if (CTX->ctx.traps) { \
         if ((CTX->ctx.traps & TRAP_UNDERFLOW) && mpfr_underflow_p()) { \
             GMPY_UNDERFLOW("underflow"); \
@@ -181,7 +199,8 @@ static PyTypeObject MPFR_Type;
     GMPY_MPFR_EXCEPTIONS(V, CTX);
 
 #define GMPY_CHECK_ERANGE(V, CTX, MSG) \
-    CTX->ctx.erange |= mpfr_erangeflag_p(); \
+    if (mpfr_erangeflag_p()) \
+        GMPY_SET_FLAG(CTX, erange); \
     if (CTX->ctx.traps) { \
         if ((CTX->ctx.traps & TRAP_ERANGE) && mpfr_erangeflag_p()) { \
             GMPY_ERANGE(MSG); \
@@ -103,12 +103,14 @@ GMPy_Context_F2Q(PyObject *self, PyObject *args)
 
 PyDoc_STRVAR(GMPy_doc_mpfr_free_cache,
 "free_cache()\n\n"
-"Free the internal cache of constants maintained by MPFR.");
+"Free the internal cache of constants maintained by MPFR and the\n"
+"tables of powers used to convert large integers to and from strings.");
 
 static PyObject *
 GMPy_MPFR_Free_Cache(PyObject *self, PyObject *args)
 {
     mpfr_free_cache();
+    GMPy_MPZ_Free_RadixCache();
     Py_RETURN_NONE;
 }
 
@@ -215,7 +217,7 @@ GMPy_MPFR_get_exp(PyObject *self, PyObject *other)
         result = PyIntOrLong_FromSsize_t(0);
     }
     else {
-        context->ctx.erange = 1;
+        GMPY_SET_FLAG(context, erange);
         if (context->ctx.traps & TRAP_ERANGE) {
             GMPY_ERANGE("Can not get exponent from NaN or Infinity.");
         }
@@ -273,7 +275,7 @@ GMPy_MPFR_set_exp(PyObject *self, PyObject *args)
     mpfr_set_emax(_oldemax);
 
     if (result->rc) {
-        context->ctx.erange = 1;
+        GMPY_SET_FLAG(context, erange);
         if (context->ctx.traps & TRAP_ERANGE) {
             GMPY_ERANGE("new exponent is out-of-bounds");
             Py_DECREF((PyObject*)result);
@@ -628,7 +630,7 @@ GMPy_MPFR_CheckRange(PyObject *x, CTXT_Object *context)
 
     if ((result = GMPy_MPFR_New(mpfr_get_prec(MPFR(x)), context))) {
         mpfr_set(result->f, MPFR(x), GET_MPFR_ROUND(context));
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
         _GMPy_MPFR_Cleanup(&result, context);
     }
     return (PyObject*)result;
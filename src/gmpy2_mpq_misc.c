@@ -365,3 +365,162 @@ GMPy_MPQ_Method_Sizeof(PyObject *self, PyObject *other)
         (mpq_denref(MPQ(self))->_mp_alloc * sizeof(mp_limb_t)));
 }
 
+
+/* Support for qsum(). Consecutive terms that are integers or that share the
+ * same denominator are added into a group without computing a gcd. Each
+ * completed group is pushed onto a stack that is reduced like a binary
+ * counter, so the partial sums are combined in a balanced tree. This keeps
+ * the operands of the expensive gcd computations in mpq_add() roughly the
+ * same size instead of adding each small term to an ever larger sum.
+ */
+
+#define GMPY_QSUM_DEPTH 64
+
+typedef struct {
+    mpz_t num;                      /* numerator of the current group */
+    mpz_t den;                      /* denominator of the current group */
+    int canonical;                  /* 0 if num/den may have a common factor */
+    int depth;                      /* number of entries on the stack */
+    int level[GMPY_QSUM_DEPTH];     /* log2 of the number of groups summed */
+    mpq_t stack[GMPY_QSUM_DEPTH];
+} qsum_state;
+
+static void
+_GMPy_QSum_Push(qsum_state *s)
+{
+    int d;
+
+    if (!mpz_sgn(s->num) && !mpz_cmp_ui(s->den, 1)) {
+        return;
+    }
+
+    d = s->depth++;
+    mpq_init(s->stack[d]);
+    mpz_swap(mpq_numref(s->stack[d]), s->num);
+    mpz_swap(mpq_denref(s->stack[d]), s->den);
+    if (!s->canonical) {
+        mpq_canonicalize(s->stack[d]);
+    }
+    s->level[d] = 0;
+    mpz_set_ui(s->num, 0);
+    mpz_set_ui(s->den, 1);
+    s->canonical = 1;
+
+    while (s->depth > 1 && s->level[s->depth - 1] == s->level[s->depth - 2]) {
+        d = --s->depth;
+        mpq_add(s->stack[d - 1], s->stack[d - 1], s->stack[d]);
+        mpq_clear(s->stack[d]);
+        s->level[d - 1]++;
+    }
+}
+
+/* Add n/d to the sum. n/d must be in canonical form; d is NULL for an
+ * integer.
+ */
+
+static void
+_GMPy_QSum_Add(qsum_state *s, mpz_srcptr n, mpz_srcptr d)
+{
+    if (!d || !mpz_cmp_ui(d, 1)) {
+        mpz_addmul(s->num, n, s->den);
+    }
+    else if (!mpz_cmp(d, s->den)) {
+        mpz_add(s->num, s->num, n);
+        s->canonical = 0;
+    }
+    else if (!mpz_cmp_ui(s->den, 1)) {
+        mpz_mul(s->num, s->num, d);
+        mpz_add(s->num, s->num, n);
+        mpz_set(s->den, d);
+    }
+    else {
+        _GMPy_QSum_Push(s);
+        mpz_set(s->num, n);
+        mpz_set(s->den, d);
+    }
+}
+
+PyDoc_STRVAR(GMPy_doc_mpq_function_qsum,
+"qsum(iterable) -> mpq\n\n"
+"Return the sum of the integers and rationals in iterable. Terms with\n"
+"equal denominators are added directly and the partial sums are combined\n"
+"in a balanced tree, which avoids most of the gcd computations that\n"
+"adding the terms one at a time requires.");
+
+static PyObject *
+GMPy_MPQ_Function_Qsum(PyObject *self, PyObject *other)
+{
+    MPQ_Object *result = NULL, *tempx;
+    PyObject *iter, *item;
+    qsum_state s;
+
+    if (!(iter = PyObject_GetIter(other))) {
+        return NULL;
+    }
+
+    mpz_init_set_ui(s.num, 0);
+    mpz_init_set_ui(s.den, 1);
+    s.canonical = 1;
+    s.depth = 0;
+
+    while ((item = PyIter_Next(iter))) {
+        if (MPQ_Check(item)) {
+            _GMPy_QSum_Add(&s, mpq_numref(MPQ(item)), mpq_denref(MPQ(item)));
+        }
+        else if (CHECK_MPZANY(item)) {
+            _GMPy_QSum_Add(&s, MPZ(item), NULL);
+        }
+        else if (PyIntOrLong_Check(item)) {
+            mpz_set_PyIntOrLong(global.tempz, item);
+            _GMPy_QSum_Add(&s, global.tempz, NULL);
+        }
+        else if (IS_RATIONAL(item)) {
+            if (!(tempx = GMPy_MPQ_From_Rational(item, NULL))) {
+                Py_DECREF(item);
+                goto done;
+            }
+            _GMPy_QSum_Add(&s, mpq_numref(tempx->q), mpq_denref(tempx->q));
+            Py_DECREF((PyObject*)tempx);
+        }
+        else {
+            Py_DECREF(item);
+            TYPE_ERROR("qsum() requires an iterable of integers or rationals");
+            goto done;
+        }
+        Py_DECREF(item);
+    }
+
+    if (PyErr_Occurred()) {
+        goto done;
+    }
+
+    if (!(result = GMPy_MPQ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        goto done;
+        /* LCOV_EXCL_STOP */
+    }
+
+    /* Combine the remaining partial sums, smallest first. */
+
+    _GMPy_QSum_Push(&s);
+    if (s.depth) {
+        while (s.depth > 1) {
+            s.depth--;
+            mpq_add(s.stack[s.depth - 1], s.stack[s.depth - 1], s.stack[s.depth]);
+            mpq_clear(s.stack[s.depth]);
+        }
+        mpq_swap(result->q, s.stack[0]);
+    }
+    else {
+        mpq_set_ui(result->q, 0, 1);
+    }
+
+  done:
+    while (s.depth > 0) {
+        mpq_clear(s.stack[--s.depth]);
+    }
+    mpz_clear(s.num);
+    mpz_clear(s.den);
+    Py_DECREF(iter);
+    return (PyObject*)result;
+}
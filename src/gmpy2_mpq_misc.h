@@ -38,6 +38,7 @@ static PyObject * GMPy_MPQ_Attrib_GetDenom(MPQ_Object *self, void *closure);
 static PyObject * GMPy_MPQ_Function_Numer(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPQ_Function_Denom(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPQ_Function_Qdiv(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPQ_Function_Qsum(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPQ_Method_Ceil(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPQ_Method_Floor(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPQ_Method_Trunc(PyObject *self, PyObject *other);
@@ -0,0 +1,422 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpz_array.c                                                       *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* mpz_array provides indexed access to a record stream written by
+ * pack_many() or dump_many() without loading the whole stream. The index
+ * stored after the records gives the offset of each record so any value
+ * can be decoded in O(1). mpz_array.open() maps a file read-only with the
+ * mmap module; processes opening the same file share the page cache.
+ *
+ * The records use the portable to_binary() encoding (little-endian bytes,
+ * no padding) so an mpz cannot alias the mapping directly; each access
+ * decodes a new object with mpz_import().
+ */
+
+PyDoc_STRVAR(GMPy_doc_mpz_array,
+"mpz_array(data) -> mpz_array\n\n"
+"Return a read-only sequence over a record stream created by\n"
+"pack_many() or dump_many(). data may be any object supporting the\n"
+"buffer protocol. Values are decoded when they are indexed. Use\n"
+"mpz_array.open(path) to map a file created by dump_many().");
+
+static int
+mpz_array_setup(MPZ_Array_Object *self)
+{
+    const unsigned char *buf = (const unsigned char*)self->view.buf;
+    Py_ssize_t len = self->view.len;
+    unsigned PY_LONG_LONG count, index;
+    stream_reader r;
+    Py_ssize_t size, alloc = 0;
+
+    if (len < STREAM_HEADER_SIZE || memcmp(buf, STREAM_MAGIC, 8)) {
+        VALUE_ERROR("invalid record stream (bad header)");
+        return -1;
+    }
+    count = stream_get_off(buf + 8);
+    index = stream_get_off(buf + 16);
+
+    if (index != 0) {
+        if (index > (unsigned PY_LONG_LONG)(len - 8) ||
+            stream_get_off(buf + index) != count ||
+            count > (unsigned PY_LONG_LONG)(len - index - 8) / 8) {
+            VALUE_ERROR("invalid record stream (bad index)");
+            return -1;
+        }
+        self->count = (Py_ssize_t)count;
+        self->index = (Py_ssize_t)index + 8;
+        return 0;
+    }
+
+    /* The stream was written to a file that could not seek, so the header
+     * does not locate the index. Build the offsets by walking the records.
+     */
+    r.buf = (unsigned char*)buf;
+    r.pos = STREAM_HEADER_SIZE;
+    r.end = r.alloc = len;
+    r.file = NULL;
+    r.consumed = 0;
+    self->count = 0;
+    while (1) {
+        Py_ssize_t start = r.pos;
+
+        if (stream_get_length(&r, &size) < 0)
+            return -1;
+        if (size == 0)
+            break;
+        if (stream_need(&r, size) < 0)
+            return -1;
+        r.pos += size;
+        if (self->count == alloc) {
+            unsigned PY_LONG_LONG *temp;
+
+            alloc = alloc ? 2 * alloc : 1024;
+            if (!(temp = PyMem_Realloc(self->offsets,
+                                       alloc * sizeof(unsigned PY_LONG_LONG)))) {
+                PyErr_NoMemory();
+                return -1;
+            }
+            self->offsets = temp;
+        }
+        self->offsets[self->count++] = start;
+    }
+    return 0;
+}
+
+static PyObject *
+GMPy_MPZ_Array_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds)
+{
+    MPZ_Array_Object *result;
+    PyObject *data;
+    static char *kwlist[] = {"data", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "O", kwlist, &data))
+        return NULL;
+
+    if (!(result = (MPZ_Array_Object*)type->tp_alloc(type, 0))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    result->view.obj = NULL;
+    result->count = 0;
+    result->offsets = NULL;
+    result->index = 0;
+    result->owner = 0;
+
+    if (PyObject_GetBuffer(data, &(result->view), PyBUF_SIMPLE) < 0) {
+        result->view.obj = NULL;
+        Py_DECREF((PyObject*)result);
+        return NULL;
+    }
+    if (mpz_array_setup(result) < 0) {
+        Py_DECREF((PyObject*)result);
+        return NULL;
+    }
+    return (PyObject*)result;
+}
+
+static void
+GMPy_MPZ_Array_Dealloc(MPZ_Array_Object *self)
+{
+    if (self->view.obj)
+        PyBuffer_Release(&(self->view));
+    PyMem_Free(self->offsets);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_array_open,
+"mpz_array.open(path) -> mpz_array\n\n"
+"Map the file at path, created by dump_many(), read-only into memory\n"
+"and return an mpz_array over it. The mapping is released by close().");
+
+static PyObject *
+GMPy_MPZ_Array_Open(PyObject *type, PyObject *args)
+{
+    PyObject *path, *io = NULL, *mmap = NULL, *file = NULL, *fileno = NULL;
+    PyObject *mapargs = NULL, *mapkw = NULL, *access = NULL, *map = NULL;
+    PyObject *mapfunc = NULL;
+    PyObject *temp, *result = NULL;
+
+    if (!PyArg_ParseTuple(args, "O", &path))
+        return NULL;
+
+    if (!(io = PyImport_ImportModule("io")) ||
+        !(mmap = PyImport_ImportModule("mmap")) ||
+        !(file = PyObject_CallMethod(io, "open", "Os", path, "rb")))
+        goto done;
+
+    /* mmap duplicates the file descriptor so the file can be closed as soon
+     * as the mapping exists. */
+    if ((fileno = PyObject_CallMethod(file, "fileno", NULL)) &&
+        (mapfunc = PyObject_GetAttrString(mmap, "mmap")) &&
+        (access = PyObject_GetAttrString(mmap, "ACCESS_READ")) &&
+        (mapargs = Py_BuildValue("(Oi)", fileno, 0)) &&
+        (mapkw = PyDict_New()) &&
+        PyDict_SetItemString(mapkw, "access", access) == 0) {
+        map = PyObject_Call(mapfunc, mapargs, mapkw);
+    }
+    if (!(temp = PyObject_CallMethod(file, "close", NULL))) {
+        Py_CLEAR(map);
+        goto done;
+    }
+    Py_DECREF(temp);
+    if (!map)
+        goto done;
+
+    if ((result = PyObject_CallFunctionObjArgs(type, map, NULL))) {
+        if (MPZ_Array_Check(result))
+            ((MPZ_Array_Object*)result)->owner = 1;
+    }
+    else {
+        PyObject *exc, *val, *tb;
+
+        PyErr_Fetch(&exc, &val, &tb);
+        temp = PyObject_CallMethod(map, "close", NULL);
+        Py_XDECREF(temp);
+        PyErr_Restore(exc, val, tb);
+    }
+
+  done:
+    Py_XDECREF(map);
+    Py_XDECREF(mapkw);
+    Py_XDECREF(mapargs);
+    Py_XDECREF(access);
+    Py_XDECREF(mapfunc);
+    Py_XDECREF(fileno);
+    Py_XDECREF(file);
+    Py_XDECREF(mmap);
+    Py_XDECREF(io);
+    return result;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpz_array_close,
+"x.close()\n\n"
+"Release the underlying buffer. If x was created by mpz_array.open(),\n"
+"the mapping is closed. Indexing a closed mpz_array raises ValueError.");
+
+static PyObject *
+GMPy_MPZ_Array_Close(MPZ_Array_Object *self, PyObject *other)
+{
+    PyObject *obj, *temp;
+
+    if (!(obj = self->view.obj))
+        Py_RETURN_NONE;
+
+    Py_INCREF(obj);
+    PyBuffer_Release(&(self->view));
+    self->view.obj = NULL;
+    self->count = 0;
+    if (self->owner) {
+        if (!(temp = PyObject_CallMethod(obj, "close", NULL))) {
+            Py_DECREF(obj);
+            return NULL;
+        }
+        Py_DECREF(temp);
+    }
+    Py_DECREF(obj);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_MPZ_Array_Enter(MPZ_Array_Object *self, PyObject *args)
+{
+    Py_INCREF((PyObject*)self);
+    return (PyObject*)self;
+}
+
+static PyObject *
+GMPy_MPZ_Array_Exit(MPZ_Array_Object *self, PyObject *args)
+{
+    return GMPy_MPZ_Array_Close(self, NULL);
+}
+
+static Py_ssize_t
+GMPy_MPZ_Array_Length(MPZ_Array_Object *self)
+{
+    return self->count;
+}
+
+static PyObject *
+GMPy_MPZ_Array_Item(MPZ_Array_Object *self, Py_ssize_t i)
+{
+    unsigned PY_LONG_LONG off;
+    stream_reader r;
+    Py_ssize_t size;
+    CTXT_Object *context = NULL;
+
+    if (!self->view.obj) {
+        VALUE_ERROR("operation on closed mpz_array");
+        return NULL;
+    }
+    if (i < 0 || i >= self->count) {
+        INDEX_ERROR("mpz_array index out of range");
+        return NULL;
+    }
+
+    if (self->offsets)
+        off = self->offsets[i];
+    else
+        off = stream_get_off((unsigned char*)self->view.buf + self->index + 8 * i);
+    if (off < STREAM_HEADER_SIZE || off >= (unsigned PY_LONG_LONG)self->view.len) {
+        VALUE_ERROR("invalid record stream (bad index)");
+        return NULL;
+    }
+
+    r.buf = (unsigned char*)self->view.buf;
+    r.pos = (Py_ssize_t)off;
+    r.end = r.alloc = self->view.len;
+    r.file = NULL;
+    r.consumed = 0;
+    if (stream_get_length(&r, &size) < 0 || stream_need(&r, size) < 0)
+        return NULL;
+
+    CHECK_CONTEXT(context);
+
+    return GMPy_MPANY_From_CBinary(r.buf + r.pos, size, context);
+}
+
+static PyObject *
+GMPy_MPZ_Array_Subscript(MPZ_Array_Object *self, PyObject *item)
+{
+    if (!self->view.obj) {
+        VALUE_ERROR("operation on closed mpz_array");
+        return NULL;
+    }
+
+    if (PyIndex_Check(item)) {
+        Py_ssize_t i;
+
+        i = PyNumber_AsSsize_t(item, PyExc_IndexError);
+        if (i == -1 && PyErr_Occurred())
+            return NULL;
+        if (i < 0)
+            i += self->count;
+        return GMPy_MPZ_Array_Item(self, i);
+    }
+    else if (PySlice_Check(item)) {
+        Py_ssize_t start, stop, step, slicelength, cur, i;
+        PyObject *result, *temp;
+
+#if PY_VERSION_HEX > 0x030200A4
+        if (PySlice_GetIndicesEx(item, self->count,
+                        &start, &stop, &step, &slicelength) < 0) {
+            return NULL;
+        }
+#else
+        if (PySlice_GetIndicesEx((PySliceObject*)item, self->count,
+                        &start, &stop, &step, &slicelength) < 0) {
+            return NULL;
+        }
+#endif
+
+        if (!(result = PyList_New(slicelength)))
+            return NULL;
+        for (cur = start, i = 0; i < slicelength; cur += step, i++) {
+            if (!(temp = GMPy_MPZ_Array_Item(self, cur))) {
+                Py_DECREF(result);
+                return NULL;
+            }
+            PyList_SET_ITEM(result, i, temp);
+        }
+        return result;
+    }
+    else {
+        TYPE_ERROR("mpz_array indices must be integers or slices");
+        return NULL;
+    }
+}
+
+static PySequenceMethods GMPy_MPZ_Array_sequence_methods = {
+    (lenfunc)GMPy_MPZ_Array_Length,
+    0,
+    0,
+    (ssizeargfunc)GMPy_MPZ_Array_Item,
+};
+
+static PyMappingMethods GMPy_MPZ_Array_mapping_methods = {
+    (lenfunc)GMPy_MPZ_Array_Length,
+    (binaryfunc)GMPy_MPZ_Array_Subscript,
+    NULL
+};
+
+static PyMethodDef GMPy_MPZ_Array_methods [] =
+{
+    { "__enter__", (PyCFunction)GMPy_MPZ_Array_Enter, METH_NOARGS, NULL },
+    { "__exit__", (PyCFunction)GMPy_MPZ_Array_Exit, METH_VARARGS, NULL },
+    { "close", (PyCFunction)GMPy_MPZ_Array_Close, METH_NOARGS, GMPy_doc_mpz_array_close },
+    { "open", GMPy_MPZ_Array_Open, METH_VARARGS | METH_CLASS, GMPy_doc_mpz_array_open },
+    { NULL, NULL, 1 }
+};
+
+static PyTypeObject MPZ_Array_Type =
+{
+#ifdef PY3
+    PyVarObject_HEAD_INIT(0, 0)
+#else
+    PyObject_HEAD_INIT(0)
+        0,                                  /* ob_size          */
+#endif
+    "mpz_array",                            /* tp_name          */
+    sizeof(MPZ_Array_Object),               /* tp_basicsize     */
+        0,                                  /* tp_itemsize      */
+    (destructor) GMPy_MPZ_Array_Dealloc,    /* tp_dealloc       */
+        0,                                  /* tp_print         */
+        0,                                  /* tp_getattr       */
+        0,                                  /* tp_setattr       */
+        0,                                  /* tp_reserved      */
+        0,                                  /* tp_repr          */
+        0,                                  /* tp_as_number     */
+    &GMPy_MPZ_Array_sequence_methods,       /* tp_as_sequence   */
+    &GMPy_MPZ_Array_mapping_methods,        /* tp_as_mapping    */
+        0,                                  /* tp_hash          */
+        0,                                  /* tp_call          */
+        0,                                  /* tp_str           */
+        0,                                  /* tp_getattro      */
+        0,                                  /* tp_setattro      */
+        0,                                  /* tp_as_buffer     */
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags         */
+    GMPy_doc_mpz_array,                     /* tp_doc           */
+        0,                                  /* tp_traverse      */
+        0,                                  /* tp_clear         */
+        0,                                  /* tp_richcompare   */
+        0,                                  /* tp_weaklistoffset*/
+        0,                                  /* tp_iter          */
+        0,                                  /* tp_iternext      */
+    GMPy_MPZ_Array_methods,                 /* tp_methods       */
+        0,                                  /* tp_members       */
+        0,                                  /* tp_getset        */
+        0,                                  /* tp_base          */
+        0,                                  /* tp_dict          */
+        0,                                  /* tp_descr_get     */
+        0,                                  /* tp_descr_set     */
+        0,                                  /* tp_dictoffset    */
+        0,                                  /* tp_init          */
+        0,                                  /* tp_alloc         */
+    GMPy_MPZ_Array_NewInit,                 /* tp_new           */
+        0,                                  /* tp_free          */
+};
@@ -0,0 +1,64 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpz_array.h                                                       *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MPZ_ARRAY_H
+#define GMPY_MPZ_ARRAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A read-only sequence over a record stream created by pack_many() or
+ * dump_many(). The stream is accessed through the buffer protocol, usually
+ * of an mmap object, and values are only decoded when they are indexed.
+ */
+
+typedef struct {
+    PyObject_HEAD
+    Py_buffer view;             /* view.obj is NULL once closed */
+    Py_ssize_t count;
+    unsigned PY_LONG_LONG *offsets; /* only used if the stream has no index */
+    Py_ssize_t index;           /* offset of the first index entry */
+    int owner;                  /* close the underlying object on close() */
+} MPZ_Array_Object;
+
+static PyTypeObject MPZ_Array_Type;
+#define MPZ_Array_Check(v) (((PyObject*)v)->ob_type == &MPZ_Array_Type)
+
+static PyObject * GMPy_MPZ_Array_NewInit(PyTypeObject *type, PyObject *args, PyObject *keywds);
+static void       GMPy_MPZ_Array_Dealloc(MPZ_Array_Object *self);
+static PyObject * GMPy_MPZ_Array_Open(PyObject *type, PyObject *args);
+static PyObject * GMPy_MPZ_Array_Close(MPZ_Array_Object *self, PyObject *other);
+static PyObject * GMPy_MPZ_Array_Item(MPZ_Array_Object *self, Py_ssize_t i);
+static PyObject * GMPy_MPZ_Array_Subscript(MPZ_Array_Object *self, PyObject *item);
+static Py_ssize_t GMPy_MPZ_Array_Length(MPZ_Array_Object *self);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
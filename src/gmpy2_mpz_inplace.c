@@ -35,6 +35,16 @@ static PyObject *
 GMPy_MPZ_IAdd_Slot(PyObject *self, PyObject *other)
 {
     MPZ_Object *result = NULL;
+    long ival, small;
+
+    if (IS_SMALL_PYINT(other)) {
+        ival = SMALL_PYINT_AS_LONG(other);
+        if (MPZ_IS_INTERN_OPERAND(ival) &&
+            GMPy_MPZ_GetSmall(MPZ(self), &small) &&
+            MPZ_IS_INTERNED(small + ival)) {
+            return GMPy_MPZ_Intern(small + ival);
+        }
+    }
 
     if (CHECK_MPZANY(other)) {
         if ((result = GMPy_MPZ_New(NULL))) {
@@ -90,6 +100,16 @@ static PyObject *
 GMPy_MPZ_ISub_Slot(PyObject *self, PyObject *other)
 {
     MPZ_Object *rz;
+    long ival, small;
+
+    if (IS_SMALL_PYINT(other)) {
+        ival = SMALL_PYINT_AS_LONG(other);
+        if (MPZ_IS_INTERN_OPERAND(ival) &&
+            GMPy_MPZ_GetSmall(MPZ(self), &small) &&
+            MPZ_IS_INTERNED(small - ival)) {
+            return GMPy_MPZ_Intern(small - ival);
+        }
+    }
 
     if (!(rz =  GMPy_MPZ_New(NULL)))
         return NULL;
@@ -1315,29 +1315,53 @@ GMPy_MPZ_Method_IsPower(PyObject *self, PyObject *other)
         Py_RETURN_FALSE;
 }
 
+/* Use the deterministic test for values that fit in one limb, otherwise
+ * mpz_probab_prime_p(). Like mpz_probab_prime_p(), the sign of x is ignored.
+ */
+
+static int
+_GMPy_MPZ_Is_Prime(mpz_srcptr x, int reps)
+{
+#ifdef GMPY_MONT_INT128
+    if (mpz_size(x) <= 1)
+        return GMPy_Mont_Is_Prime_Limb(mpz_getlimbn(x, 0));
+#endif
+    return mpz_probab_prime_p(x, reps);
+}
+
 PyDoc_STRVAR(GMPy_doc_mpz_function_is_prime,
-"is_prime(x[, n=25]) -> bool\n\n"
+"is_prime(x[, n=25][, threads=1]) -> bool\n\n"
 "Return True if x is _probably_ prime, else False if x is\n"
 "definitely composite. x is checked for small divisors and up\n"
-"to n Miller-Rabin tests are performed.");
+"to n Miller-Rabin tests are performed. The result is exact\n"
+"for abs(x) < 2**64. If threads is greater than 1, the tests\n"
+"for large x are run on up to threads threads at the same time\n"
+"without holding the GIL. Only the BPSW test pair and the n-24\n"
+"extra strong tests are split between threads, so no more than\n"
+"max(2, n-22) threads are used; with the default n=25 that is 3.");
 
 static PyObject *
-GMPy_MPZ_Function_IsPrime(PyObject *self, PyObject *args)
+GMPy_MPZ_Function_IsPrime(PyObject *self, PyObject *args, PyObject *keywds)
 {
-    int i;
+    int i, threads = 1;
     unsigned long reps = 25;
     MPZ_Object* tempx;
-    Py_ssize_t argc;
+    PyObject *x, *n = NULL;
+    static char *kwlist[] = {"x", "n", "threads", NULL};
 
-    argc = PyTuple_GET_SIZE(args);
+    /* threads may only be given as a keyword. */
+    if (PyTuple_GET_SIZE(args) > 2) {
+        TYPE_ERROR("is_prime() requires 1 or 2 integer arguments");
+        return NULL;
+    }
 
-    if (argc == 0 || argc > 2) {
-        TYPE_ERROR("is_prime() requires 'mpz'[,'int'] arguments");
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "O|Oi", kwlist,
+                                     &x, &n, &threads)) {
         return NULL;
     }
 
-    if (PyTuple_GET_SIZE(args) == 2) {
-        reps = c_ulong_From_Integer(PyTuple_GET_ITEM(args, 1));
+    if (n) {
+        reps = c_ulong_From_Integer(n);
         if (reps == (unsigned long)(-1) && PyErr_Occurred()) {
             return NULL;
         }
@@ -1347,11 +1371,23 @@ GMPy_MPZ_Function_IsPrime(PyObject *self, PyObject *args)
         }
     }
 
-    if (!(tempx = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL))) {
+    if (threads < 1) {
+        VALUE_ERROR("is_prime() requires threads be greater than 0");
+        return NULL;
+    }
+
+    if (!(tempx = GMPy_MPZ_From_Integer(x, NULL))) {
         return NULL;
     }
 
-    i = mpz_probab_prime_p(tempx->z, (int)reps);
+    if (threads > 1 && mpz_sizeinbase(tempx->z, 2) > 64) {
+        Py_BEGIN_ALLOW_THREADS
+        i = GMPy_MPZ_Is_Prime_Threaded(tempx->z, (int)reps, threads);
+        Py_END_ALLOW_THREADS
+    }
+    else {
+        i = _GMPy_MPZ_Is_Prime(tempx->z, (int)reps);
+    }
     Py_DECREF((PyObject*)tempx);
 
     if (i)
@@ -1364,7 +1400,8 @@ PyDoc_STRVAR(GMPy_doc_mpz_method_is_prime,
 "x.is_prime([n=25]) -> bool\n\n"
 "Return True if x is _probably_ prime, else False if x is\n"
 "definitely composite. x is checked for small divisors and up\n"
-"to n Miller-Rabin tests are performed.");
+"to n Miller-Rabin tests are performed. The result is exact\n"
+"for abs(x) < 2**64.");
 
 static PyObject *
 GMPy_MPZ_Method_IsPrime(PyObject *self, PyObject *args)
@@ -1391,7 +1428,7 @@ GMPy_MPZ_Method_IsPrime(PyObject *self, PyObject *args)
         }
     }
 
-    i = mpz_probab_prime_p(MPZ(self), (int)reps);
+    i = _GMPy_MPZ_Is_Prime(MPZ(self), (int)reps);
 
     if (i)
         Py_RETURN_TRUE;
@@ -1721,3 +1758,74 @@ GMPy_MPZ_Method_SizeOf(PyObject *self, PyObject *other)
         (MPZ(self)->_mp_alloc * sizeof(mp_limb_t)));
 }
 
+
+PyDoc_STRVAR(GMPy_doc_mpz_function_isum,
+"isum(iterable) -> mpz\n\n"
+"Return the sum of the integers in iterable. The sum is accumulated in\n"
+"place, without creating an intermediate result for each term.");
+
+static PyObject *
+GMPy_MPZ_Function_Isum(PyObject *self, PyObject *other)
+{
+    MPZ_Object *result, *tempx;
+    PyObject *iter, *item;
+    long temp;
+    int error;
+
+    if (!(iter = PyObject_GetIter(other))) {
+        return NULL;
+    }
+
+    if (!(result = GMPy_MPZ_New(NULL))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(iter);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+    mpz_set_ui(result->z, 0);
+
+    while ((item = PyIter_Next(iter))) {
+        if (CHECK_MPZANY(item)) {
+            mpz_add(result->z, result->z, MPZ(item));
+        }
+        else if (PyIntOrLong_Check(item)) {
+            temp = GMPy_Integer_AsLongAndError(item, &error);
+            if (error) {
+                mpz_set_PyIntOrLong(global.tempz, item);
+                mpz_add(result->z, result->z, global.tempz);
+            }
+            else if (temp >= 0) {
+                mpz_add_ui(result->z, result->z, temp);
+            }
+            else {
+                mpz_sub_ui(result->z, result->z, -(unsigned long)temp);
+            }
+        }
+        else if (IS_INTEGER(item)) {
+            if (!(tempx = GMPy_MPZ_From_Integer(item, NULL))) {
+                Py_DECREF(item);
+                goto error;
+            }
+            mpz_add(result->z, result->z, tempx->z);
+            Py_DECREF((PyObject*)tempx);
+        }
+        else {
+            Py_DECREF(item);
+            TYPE_ERROR("isum() requires an iterable of integers");
+            goto error;
+        }
+        Py_DECREF(item);
+    }
+    Py_DECREF(iter);
+
+    if (PyErr_Occurred()) {
+        Py_DECREF((PyObject*)result);
+        return NULL;
+    }
+    return (PyObject*)result;
+
+  error:
+    Py_DECREF(iter);
+    Py_DECREF((PyObject*)result);
+    return NULL;
+}
@@ -57,6 +57,7 @@ static PyObject * GMPy_MPZ_Method_IsOdd(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_NumDigits(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_Function_Iroot(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_Function_IrootRem(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_Function_Isum(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_Bincoef(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_Function_GCD(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_Function_LCM(PyObject *self, PyObject *args);
@@ -79,7 +80,7 @@ static PyObject * GMPy_MPZ_Function_IsSquare(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_IsDivisible(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_Function_IsCongruent(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_Function_IsPower(PyObject *self, PyObject *other);
-static PyObject * GMPy_MPZ_Function_IsPrime(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_Function_IsPrime(PyObject *self, PyObject *args, PyObject *keywds);
 static PyObject * GMPy_MPZ_Function_NextPrime(PyObject *self, PyObject *other);
 static PyObject * GMPy_MPZ_Function_Jacobi(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_Function_Legendre(PyObject *self, PyObject *args);
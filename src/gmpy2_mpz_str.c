@@ -0,0 +1,410 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpz_str.c                                                         *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Divide-and-conquer conversion between mpz_t and strings.
+ *
+ * A value z with at most chunk * 2**n digits is split as
+ *
+ *     z = q * base**(chunk * 2**(n-1)) + r
+ *
+ * and q and r are converted recursively; r is padded with leading zeros to
+ * exactly chunk * 2**(n-1) digits. Parsing reverses the process. The powers
+ * base**(chunk * 2**i) are cached per base and the table only grows when a
+ * larger value than any seen before is converted. Power-of-two bases are
+ * left to GMP since its conversion is already linear for those bases.
+ *
+ * Very large values are split once at the top level and the two halves are
+ * converted concurrently. The worker thread never touches a Python object
+ * and the calling thread keeps the GIL while it waits, so the operand can't
+ * be modified underneath the conversion.
+ */
+
+/* Cached powers for a single base: pow[i] = base**(chunk << i). */
+
+typedef struct {
+    size_t chunk;
+    int count;
+    mpz_t pow[RADIX_MAX_DEPTH];
+} radix_powtab;
+
+static radix_powtab *radix_cache[63];
+
+static int
+radix_base_ok(int base)
+{
+    if (base < 0)
+        base = -base;
+    return (base >= 3 && base <= 62 && (base & (base - 1)));
+}
+
+/* Return the power table for base with at least depth entries. Returns NULL
+ * if memory could not be allocated or if the requested depth is too large;
+ * the caller should then fall back to GMP.
+ */
+
+static radix_powtab *
+radix_get_powtab(int base, int depth)
+{
+    radix_powtab *tab;
+
+    if (depth > RADIX_MAX_DEPTH)
+        return NULL;
+
+    if (!(tab = radix_cache[base])) {
+        if (!(tab = malloc(sizeof(radix_powtab))))
+            return NULL;
+        tab->chunk = (size_t)((double)RADIX_LEAF_LIMBS * GMP_NUMB_BITS * log(2.0) / log((double)base));
+        tab->count = 0;
+        radix_cache[base] = tab;
+    }
+
+    while (tab->count < depth) {
+        mpz_init(tab->pow[tab->count]);
+        if (tab->count == 0)
+            mpz_ui_pow_ui(tab->pow[0], base, tab->chunk);
+        else
+            mpz_mul(tab->pow[tab->count], tab->pow[tab->count - 1], tab->pow[tab->count - 1]);
+        tab->count++;
+    }
+    return tab;
+}
+
+/* Return the smallest n such that chunk << n is at least ndigits. */
+
+static int
+radix_depth(radix_powtab *tab, size_t ndigits)
+{
+    int n = 0;
+
+    while (n <= RADIX_MAX_DEPTH && (tab->chunk << n) < ndigits)
+        n++;
+    return n;
+}
+
+static void
+GMPy_MPZ_Free_RadixCache(void)
+{
+    int base, i;
+
+    for (base = 0; base < 63; base++) {
+        if (radix_cache[base]) {
+            for (i = 0; i < radix_cache[base]->count; i++)
+                mpz_clear(radix_cache[base]->pow[i]);
+            free(radix_cache[base]);
+            radix_cache[base] = NULL;
+        }
+    }
+}
+
+/* Write the digits of 0 <= z < base**(chunk << n) to str and return a
+ * pointer just past the last digit. If pad is set, exactly chunk << n digits
+ * are written. The string is always NULL terminated.
+ */
+
+static char *
+radix_get_str_rec(char *str, int base, mpz_srcptr z, radix_powtab *tab,
+                  int n, int pad)
+{
+    size_t len;
+    mpz_t q, r;
+
+    if (n == 0) {
+        mpz_get_str(str, base, z);
+        len = strlen(str);
+        if (pad && len < tab->chunk) {
+            memmove(str + tab->chunk - len, str, len + 1);
+            memset(str, '0', tab->chunk - len);
+            len = tab->chunk;
+        }
+        return str + len;
+    }
+
+    mpz_init(q);
+    mpz_init(r);
+    mpz_tdiv_qr(q, r, z, tab->pow[n - 1]);
+    if (!pad && mpz_sgn(q) == 0) {
+        str = radix_get_str_rec(str, base, r, tab, n - 1, 0);
+    }
+    else {
+        str = radix_get_str_rec(str, base, q, tab, n - 1, pad);
+        str = radix_get_str_rec(str, base, r, tab, n - 1, 1);
+    }
+    mpz_clear(q);
+    mpz_clear(r);
+    return str;
+}
+
+/* Set z to the value of the first len digits of str, where len is at most
+ * chunk << n. buf must have room for chunk + 1 characters.
+ */
+
+static void
+radix_set_str_rec(mpz_ptr z, const char *str, size_t len, int base,
+                  radix_powtab *tab, int n, char *buf)
+{
+    size_t lolen;
+    mpz_t hi;
+
+    if (n == 0) {
+        memcpy(buf, str, len);
+        buf[len] = '\0';
+        mpz_set_str(z, buf, base);
+        return;
+    }
+
+    lolen = tab->chunk << (n - 1);
+    if (len <= lolen) {
+        radix_set_str_rec(z, str, len, base, tab, n - 1, buf);
+        return;
+    }
+
+    mpz_init(hi);
+    radix_set_str_rec(hi, str, len - lolen, base, tab, n - 1, buf);
+    radix_set_str_rec(z, str + len - lolen, lolen, base, tab, n - 1, buf);
+    mpz_addmul(z, hi, tab->pow[n - 1]);
+    mpz_clear(hi);
+}
+
+#ifndef WITHOUT_THREADS
+/* State shared with the worker thread that converts the low half. */
+
+typedef struct {
+    char *str;
+    mpz_ptr z;
+    size_t len;
+    int base;
+    radix_powtab *tab;
+    int n;
+    char *buf;
+    PyThread_type_lock done;
+} radix_job;
+
+static void
+radix_get_str_worker(void *arg)
+{
+    radix_job *job = (radix_job*)arg;
+
+    radix_get_str_rec(job->str, job->base, job->z, job->tab, job->n, 1);
+    PyThread_release_lock(job->done);
+}
+
+static void
+radix_set_str_worker(void *arg)
+{
+    radix_job *job = (radix_job*)arg;
+
+    radix_set_str_rec(job->z, job->str, job->len, job->base, job->tab, job->n, job->buf);
+    PyThread_release_lock(job->done);
+}
+
+/* Start func(job) on a new thread. Returns 0 on success and -1 if the
+ * thread could not be started, in which case the caller must do the work
+ * itself.
+ */
+
+static int
+radix_start_job(void (*func)(void *), radix_job *job)
+{
+    if (!(job->done = PyThread_allocate_lock()))
+        return -1;
+    PyThread_acquire_lock(job->done, WAIT_LOCK);
+    if ((long)PyThread_start_new_thread(func, job) == -1) {
+        PyThread_release_lock(job->done);
+        PyThread_free_lock(job->done);
+        return -1;
+    }
+    return 0;
+}
+
+static void
+radix_wait_job(radix_job *job)
+{
+    PyThread_acquire_lock(job->done, WAIT_LOCK);
+    PyThread_release_lock(job->done);
+    PyThread_free_lock(job->done);
+}
+#endif
+
+/* Drop-in replacement for mpz_get_str(). The buffer must be provided by the
+ * caller and must be large enough for the result as returned by
+ * mpz_sizeinbase() plus two.
+ */
+
+static char *
+GMPy_mpz_get_str(char *str, int base, mpz_srcptr z)
+{
+    radix_powtab *tab;
+    int n, abase = base < 0 ? -base : base;
+    char *p = str;
+    mpz_t absz;
+
+    if (mpz_size(z) < RADIX_DC_THRESHOLD || !radix_base_ok(base))
+        return mpz_get_str(str, base, z);
+
+    if (!(tab = radix_get_powtab(abase, 0)) ||
+        (n = radix_depth(tab, mpz_sizeinbase(z, abase))) < 2 ||
+        !(tab = radix_get_powtab(abase, n))) {
+        return mpz_get_str(str, base, z);
+    }
+
+    if (mpz_sgn(z) < 0)
+        *(p++) = '-';
+    mpz_init(absz);
+    mpz_abs(absz, z);
+
+#ifndef WITHOUT_THREADS
+    if (mpz_size(z) >= RADIX_THREAD_THRESHOLD) {
+        radix_job job;
+        size_t lolen = tab->chunk << (n - 1);
+        mpz_t q, r;
+
+        mpz_init(q);
+        mpz_init(r);
+        mpz_tdiv_qr(q, r, absz, tab->pow[n - 1]);
+
+        job.str = malloc(lolen + 1);
+        job.z = r;
+        job.base = base;
+        job.tab = tab;
+        job.n = n - 1;
+        if (mpz_sgn(q) && job.str && !radix_start_job(radix_get_str_worker, &job)) {
+            p = radix_get_str_rec(p, base, q, tab, n - 1, 0);
+            radix_wait_job(&job);
+            memcpy(p, job.str, lolen + 1);
+            free(job.str);
+            mpz_clear(q);
+            mpz_clear(r);
+            mpz_clear(absz);
+            return str;
+        }
+        free(job.str);
+        mpz_clear(q);
+        mpz_clear(r);
+    }
+#endif
+
+    radix_get_str_rec(p, base, absz, tab, n, 0);
+    mpz_clear(absz);
+    return str;
+}
+
+/* Return the value of the digit c in the given base or -1 if c isn't a
+ * valid digit. Follows the conventions of mpz_set_str().
+ */
+
+static int
+radix_digit(int c, int base)
+{
+    int d;
+
+    if (c >= '0' && c <= '9')
+        d = c - '0';
+    else if (c >= 'A' && c <= 'Z')
+        d = c - 'A' + 10;
+    else if (c >= 'a' && c <= 'z')
+        d = c - 'a' + (base > 36 ? 36 : 10);
+    else
+        return -1;
+    return d < base ? d : -1;
+}
+
+/* Drop-in replacement for mpz_set_str(). Anything other than an optional
+ * leading '-' followed by digits (e.g. embedded white space) is passed on to
+ * GMP unchanged.
+ */
+
+static int
+GMPy_mpz_set_str(mpz_ptr z, const char *str, int base)
+{
+    radix_powtab *tab;
+    const char *digits = str;
+    size_t len, i;
+    int n, negative = 0;
+    char *buf;
+
+    if (!radix_base_ok(base) || base < 0)
+        return mpz_set_str(z, str, base);
+
+    if (*digits == '-') {
+        negative = 1;
+        digits++;
+    }
+    len = strlen(digits);
+
+    if (!(tab = radix_get_powtab(base, 0)) ||
+        len < tab->chunk * (RADIX_DC_THRESHOLD / RADIX_LEAF_LIMBS)) {
+        return mpz_set_str(z, str, base);
+    }
+
+    for (i = 0; i < len; i++) {
+        if (radix_digit((unsigned char)digits[i], base) < 0)
+            return mpz_set_str(z, str, base);
+    }
+
+    if (!(tab = radix_get_powtab(base, n = radix_depth(tab, len))) ||
+        !(buf = malloc(tab->chunk + 1))) {
+        return mpz_set_str(z, str, base);
+    }
+
+#ifndef WITHOUT_THREADS
+    if (len >= tab->chunk * (RADIX_THREAD_THRESHOLD / RADIX_LEAF_LIMBS)) {
+        radix_job job;
+        size_t lolen = tab->chunk << (n - 1);
+        mpz_t lo;
+
+        mpz_init(lo);
+        job.z = lo;
+        job.str = (char*)digits + len - lolen;
+        job.len = lolen;
+        job.base = base;
+        job.tab = tab;
+        job.n = n - 1;
+        job.buf = malloc(tab->chunk + 1);
+        if (job.buf && !radix_start_job(radix_set_str_worker, &job)) {
+            radix_set_str_rec(z, digits, len - lolen, base, tab, n - 1, buf);
+            radix_wait_job(&job);
+            mpz_mul(z, z, tab->pow[n - 1]);
+            mpz_add(z, z, lo);
+            free(job.buf);
+            mpz_clear(lo);
+            free(buf);
+            if (negative)
+                mpz_neg(z, z);
+            return 0;
+        }
+        free(job.buf);
+        mpz_clear(lo);
+    }
+#endif
+
+    radix_set_str_rec(z, digits, len, base, tab, n, buf);
+    free(buf);
+    if (negative)
+        mpz_neg(z, z);
+    return 0;
+}
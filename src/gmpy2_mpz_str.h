@@ -0,0 +1,65 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_mpz_str.h                                                         *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MPZ_STR_H
+#define GMPY_MPZ_STR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Conversions between mpz_t and strings for very large values.
+ *
+ * GMP's mpz_get_str() and mpz_set_str() rebuild a table of powers of the
+ * base on every call. For integers above RADIX_DC_THRESHOLD limbs, the
+ * functions below split the value (or string) recursively using powers of
+ * the form base**(chunk * 2**i) that are computed once per base and then
+ * kept until free_cache() is called. Values above RADIX_THREAD_THRESHOLD
+ * limbs have their top-level halves converted concurrently.
+ */
+
+/* Number of limbs converted directly by GMP at the leaves of the tree. */
+#define RADIX_LEAF_LIMBS 2048
+
+/* Minimum size, in limbs, for divide-and-conquer conversion. */
+#define RADIX_DC_THRESHOLD 4096
+
+/* Minimum size, in limbs, for splitting the conversion across two threads. */
+#define RADIX_THREAD_THRESHOLD 32768
+
+/* Maximum number of cached squarings for a given base. */
+#define RADIX_MAX_DEPTH 48
+
+static char *          GMPy_mpz_get_str(char *str, int base, mpz_srcptr z);
+static int             GMPy_mpz_set_str(mpz_ptr z, const char *str, int base);
+static void            GMPy_MPZ_Free_RadixCache(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -47,7 +47,7 @@
  *   GMPy_Real_Mul(Real, Real, context|NULL)
  *   GMPy_Complex_Mul(Complex, Complex, context|NULL)
  *
- *   GMPy_Context_Mul(context, args)
+ *   GMPy_Context_Mul(context, GMPY_KWARGS_PARAMS)
  *
  */
 
@@ -137,15 +137,44 @@ GMPy_Integer_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
 static PyObject *
 GMPy_MPZ_Mul_Slot(PyObject *x, PyObject *y)
 {
-    if (MPZ_Check(x) && MPZ_Check(y)) {
-        MPZ_Object *result = NULL;
+    MPZ_Object *result = NULL;
+    long temp, small;
 
+    if (MPZ_Check(x) && MPZ_Check(y)) {
+        if (GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            GMPy_MPZ_GetSmall(MPZ(y), &temp) &&
+            MPZ_IS_INTERNED(small * temp)) {
+            return GMPy_MPZ_Intern(small * temp);
+        }
         if ((result = GMPy_MPZ_New(NULL))) {
             mpz_mul(result->z, MPZ(x), MPZ(y));
         }
         return (PyObject*)result;
     }
 
+    /* Fast path for an mpz and a small Python integer. */
+    if (MPZ_Check(x) && IS_SMALL_PYINT(y)) {
+        temp = SMALL_PYINT_AS_LONG(y);
+    }
+    else if (IS_SMALL_PYINT(x) && MPZ_Check(y)) {
+        temp = SMALL_PYINT_AS_LONG(x);
+        x = y;
+    }
+    else {
+        goto general;
+    }
+    if (MPZ_IS_INTERN_OPERAND(temp) &&
+        GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+        MPZ_IS_INTERNED(small * temp)) {
+        return GMPy_MPZ_Intern(small * temp);
+    }
+    if ((result = GMPy_MPZ_New(NULL))) {
+        mpz_mul_si(result->z, MPZ(x), temp);
+    }
+    return (PyObject*)result;
+
+  general:
+
     if (IS_INTEGER(x) && IS_INTEGER(y))
         return GMPy_Integer_Mul(x, y, NULL);
 
@@ -244,27 +273,27 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPFR_Check(x) && MPFR_Check(y)) {
-        mpfr_clear_flags();
+    if (CHECK_MPFRANY(x) && CHECK_MPFRANY(y)) {
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_mul(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
         goto done;
     }
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         if (PyIntOrLong_Check(y)) {
             int error;
             long temp = GMPy_Integer_AsLongAndError(y, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_mul_si(result->f, MPFR(x), temp, GET_MPFR_ROUND(context));
                 goto done;
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, y);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_mul_z(result->f, MPFR(x), global.tempz, GET_MPFR_ROUND(context));
                 goto done;
@@ -272,7 +301,7 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_mul_z(result->f, MPFR(x), MPZ(y), GET_MPFR_ROUND(context));
             goto done;
@@ -288,7 +317,7 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
                 /* LCOV_EXCL_STOP */
             }
 
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_mul_q(result->f, MPFR(x), tempy->q, GET_MPFR_ROUND(context));
             Py_DECREF((PyObject*)tempy);
@@ -296,27 +325,27 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_mul_d(result->f, MPFR(x), PyFloat_AS_DOUBLE(y), GET_MPFR_ROUND(context));
             goto done;
         }
     }
 
-    if (MPFR_Check(y)) {
+    if (CHECK_MPFRANY(y)) {
         if (PyIntOrLong_Check(x)) {
             int error;
             long temp = GMPy_Integer_AsLongAndError(x, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_mul_si(result->f, MPFR(y), temp, GET_MPFR_ROUND(context));
                 goto done;
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, x);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_mul_z(result->f, MPFR(y), global.tempz, GET_MPFR_ROUND(context));
                 goto done;
@@ -324,7 +353,7 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_mul_z(result->f, MPFR(y), MPZ(x), GET_MPFR_ROUND(context));
             goto done;
@@ -340,7 +369,7 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
                 /* LCOV_EXCL_STOP */
             }
 
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_mul_q(result->f, MPFR(y), tempx->q, GET_MPFR_ROUND(context));
             Py_DECREF((PyObject*)tempx);
@@ -348,7 +377,7 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_mul_d(result->f, MPFR(y), PyFloat_AS_DOUBLE(x), GET_MPFR_ROUND(context));
             goto done;
@@ -368,7 +397,7 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
             /* LCOV_EXCL_STOP */
         }
 
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_mul(result->f, MPFR(tempx), MPFR(tempy), GET_MPFR_ROUND(context));
         Py_DECREF((PyObject*)tempx);
@@ -395,14 +424,14 @@ GMPy_Real_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
 static PyObject *
 GMPy_MPFR_Mul_Slot(PyObject *x, PyObject *y)
 {
-    if (MPFR_Check(x) && MPFR_Check(y)) {
+    if (CHECK_MPFRANY(x) && CHECK_MPFRANY(y)) {
         MPFR_Object *result;
         CTXT_Object *context = NULL;
 
         CHECK_CONTEXT(context);
 
         if ((result = GMPy_MPFR_New(0, context))) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_mul(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
             _GMPy_MPFR_Cleanup(&result, context);
@@ -436,7 +465,7 @@ GMPy_Complex_Mul(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPC_Check(x) && MPC_Check(y)) {
+    if (CHECK_MPCANY(x) && CHECK_MPCANY(y)) {
 
         result->rc = mpc_mul(result->c, MPC(x), MPC(y), GET_MPC_ROUND(context));
 
@@ -516,11 +545,12 @@ PyDoc_STRVAR(GMPy_doc_context_mul,
 "Return x * y.");
 
 static PyObject *
-GMPy_Context_Mul(PyObject *self, PyObject *args)
+GMPy_Context_Mul(PyObject *self, GMPY_KWARGS_PARAMS)
 {
-    CTXT_Object *context = NULL;
+    CTXT_Object *context = NULL, *local, temp_context;
+    PyObject *result;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (GMPY_KWARGS_NARGS != 2) {
         TYPE_ERROR("mul() requires 2 arguments");
         return NULL;
     }
@@ -532,8 +562,14 @@ GMPy_Context_Mul(PyObject *self, PyObject *args)
         CHECK_CONTEXT(context);
     }
 
-    return GMPy_Number_Mul(PyTuple_GET_ITEM(args, 0),
-                           PyTuple_GET_ITEM(args, 1),
-                           context);
+    if (!(local = GMPY_KWARGS_CONTEXT(context, &temp_context))) {
+        return NULL;
+    }
+
+    result = GMPy_Number_Mul(GMPY_KWARGS_ARG(0),
+                             GMPY_KWARGS_ARG(1),
+                             local);
+    GMPy_CTXT_Merge_Flags(context, local);
+    return result;
 }
 
@@ -49,7 +49,7 @@ static PyObject * GMPy_MPQ_Mul_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPFR_Mul_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPC_Mul_Slot(PyObject *x, PyObject *y);
 
-static PyObject * GMPy_Context_Mul(PyObject *self, PyObject *args);
+static PyObject * GMPy_Context_Mul(PyObject *self, GMPY_KWARGS_PARAMS);
 
 #ifdef __cplusplus
 }
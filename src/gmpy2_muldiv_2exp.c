@@ -47,7 +47,7 @@ GMPy_Real_Mul_2exp(PyObject *x, PyObject *y, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_mul_2ui(result->f, tempx->f, exp, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
@@ -148,7 +148,7 @@ GMPy_Real_Div_2exp(PyObject *x, PyObject *y, CTXT_Object *context)
         return NULL;
     }
 
-    mpfr_clear_flags();
+    GMPY_MPFR_CLEAR_FLAGS(context);
 
     result->rc = mpfr_div_2ui(result->f, tempx->f, exp, GET_MPFR_ROUND(context));
     Py_DECREF((PyObject*)tempx);
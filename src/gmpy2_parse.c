@@ -0,0 +1,272 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_parse.c                                                           *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Bulk conversion of strings to gmpy2 types.
+ *
+ * parse_many() avoids the per-call overhead of mpz(), mpq(), and mpfr() when
+ * many values must be converted: arguments are parsed and the context is
+ * looked up once. When given a single buffer (bytes, bytearray, mmap, ...)
+ * the fields are located and converted directly from the buffer without
+ * creating intermediate Python strings.
+ */
+
+#define PARSE_MPZ  1
+#define PARSE_MPQ  2
+#define PARSE_MPFR 3
+
+PyDoc_STRVAR(GMPy_doc_function_parse_many,
+"parse_many(data, type='mpz', base=10, sep=b'\\n') -> list\n\n"
+"Convert many strings to 'mpz', 'mpq', or 'mpfr' values at once. 'data'\n"
+"is either an iterable of strings or a single string or buffer (bytes,\n"
+"bytearray, mmap, ...) containing values separated by 'sep'. When 'data'\n"
+"is a buffer, leading and trailing white space is removed from each\n"
+"field and empty fields are skipped. 'mpfr' values are rounded using the\n"
+"current context.");
+
+/* Convert a NULL terminated string of length len. */
+
+static PyObject *
+parse_many_field(char *cp, Py_ssize_t len, int kind, int base, CTXT_Object *context)
+{
+    MPZ_Object *tempz;
+
+    switch (kind) {
+    case PARSE_MPZ:
+        if (!(tempz = GMPy_MPZ_New(context))) {
+            /* LCOV_EXCL_START */
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+        if (mpz_set_CStr(tempz->z, cp, len, base) == -1) {
+            Py_DECREF((PyObject*)tempz);
+            return NULL;
+        }
+        return (PyObject*)tempz;
+    case PARSE_MPQ:
+        return (PyObject*)GMPy_MPQ_From_CStr(cp, len, base, context);
+    default:
+        return (PyObject*)GMPy_MPFR_From_CStr(cp, len, base, 0, context);
+    }
+}
+
+/* Return a pointer to the first occurrence of sep in [start, end) or NULL. */
+
+static const char *
+parse_many_find(const char *start, const char *end, const char *sep, Py_ssize_t seplen)
+{
+    const char *p = start;
+
+    while (end - p >= seplen) {
+        if (!(p = memchr(p, sep[0], (end - p) - seplen + 1)))
+            return NULL;
+        if (seplen == 1 || !memcmp(p, sep, seplen))
+            return p;
+        p++;
+    }
+    return NULL;
+}
+
+static PyObject *
+parse_many_buffer(const char *buf, Py_ssize_t len, int kind, int base,
+                  const char *sep, Py_ssize_t seplen, CTXT_Object *context)
+{
+    PyObject *result, *item;
+    const char *start = buf, *stop, *next, *end = buf + len;
+    char *scratch = NULL, *temp;
+    Py_ssize_t scratch_size = 0, n;
+
+    if (!(result = PyList_New(0))) {
+        /* LCOV_EXCL_START */
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    while (1) {
+        next = parse_many_find(start, end, sep, seplen);
+        stop = next ? next : end;
+
+        while (start < stop && isspace((unsigned char)*start))
+            start++;
+        while (stop > start && isspace((unsigned char)stop[-1]))
+            stop--;
+
+        if ((n = stop - start) > 0) {
+            if (n >= scratch_size) {
+                if (!(temp = realloc(scratch, n + 1))) {
+                    PyErr_NoMemory();
+                    goto error;
+                }
+                scratch = temp;
+                scratch_size = n + 1;
+            }
+            memcpy(scratch, start, n);
+            scratch[n] = '\0';
+            if (!(item = parse_many_field(scratch, n, kind, base, context)))
+                goto error;
+            if (PyList_Append(result, item) < 0) {
+                Py_DECREF(item);
+                goto error;
+            }
+            Py_DECREF(item);
+        }
+
+        if (!next)
+            break;
+        start = next + seplen;
+    }
+
+    free(scratch);
+    return result;
+
+  error:
+    free(scratch);
+    Py_DECREF(result);
+    return NULL;
+}
+
+static PyObject *
+parse_many_iterable(PyObject *data, int kind, int base, CTXT_Object *context)
+{
+    PyObject *result, *iter, *elem, *item;
+
+    if (!(iter = PyObject_GetIter(data))) {
+        TYPE_ERROR("parse_many() requires a string, buffer, or iterable of strings");
+        return NULL;
+    }
+
+    if (!(result = PyList_New(0))) {
+        /* LCOV_EXCL_START */
+        Py_DECREF(iter);
+        return NULL;
+        /* LCOV_EXCL_STOP */
+    }
+
+    while ((elem = PyIter_Next(iter))) {
+        if (!PyStrOrUnicode_Check(elem)) {
+            TYPE_ERROR("parse_many() requires an iterable of strings");
+            Py_DECREF(elem);
+            goto error;
+        }
+
+        switch (kind) {
+        case PARSE_MPZ:
+            item = (PyObject*)GMPy_MPZ_From_PyStr(elem, base, context);
+            break;
+        case PARSE_MPQ:
+            item = (PyObject*)GMPy_MPQ_From_PyStr(elem, base, context);
+            break;
+        default:
+            item = (PyObject*)GMPy_MPFR_From_PyStr(elem, base, 0, context);
+            break;
+        }
+        Py_DECREF(elem);
+
+        if (!item)
+            goto error;
+        if (PyList_Append(result, item) < 0) {
+            Py_DECREF(item);
+            goto error;
+        }
+        Py_DECREF(item);
+    }
+
+    if (PyErr_Occurred())
+        goto error;
+
+    Py_DECREF(iter);
+    return result;
+
+  error:
+    Py_DECREF(iter);
+    Py_DECREF(result);
+    return NULL;
+}
+
+static PyObject *
+GMPy_Function_ParseMany(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    PyObject *data, *ascii_str = NULL, *result;
+    char *type = "mpz", *sep = "\n";
+    Py_ssize_t seplen = 1;
+    int kind, base = 10;
+    Py_buffer view;
+    CTXT_Object *context = NULL;
+    static char *kwlist[] = {"data", "type", "base", "sep", NULL};
+
+    if (!(PyArg_ParseTupleAndKeywords(args, keywds, "O|sis#", kwlist,
+                                      &data, &type, &base, &sep, &seplen))) {
+        return NULL;
+    }
+
+    if (!strcmp(type, "mpz"))
+        kind = PARSE_MPZ;
+    else if (!strcmp(type, "mpq"))
+        kind = PARSE_MPQ;
+    else if (!strcmp(type, "mpfr"))
+        kind = PARSE_MPFR;
+    else {
+        VALUE_ERROR("type must be 'mpz', 'mpq', or 'mpfr'");
+        return NULL;
+    }
+
+    if ((base != 0) && ((base < 2) || (base > 62))) {
+        VALUE_ERROR("base for parse_many() must be 0 or in the interval [2, 62]");
+        return NULL;
+    }
+
+    if (seplen < 1) {
+        VALUE_ERROR("sep must not be empty");
+        return NULL;
+    }
+
+    CHECK_CONTEXT(context);
+
+    if (PyUnicode_Check(data)) {
+        if (!(ascii_str = PyUnicode_AsASCIIString(data))) {
+            VALUE_ERROR("string contains non-ASCII characters");
+            return NULL;
+        }
+        result = parse_many_buffer(PyBytes_AS_STRING(ascii_str),
+                                   PyBytes_GET_SIZE(ascii_str),
+                                   kind, base, sep, seplen, context);
+        Py_DECREF(ascii_str);
+        return result;
+    }
+
+    if (PyObject_CheckBuffer(data)) {
+        if (PyObject_GetBuffer(data, &view, PyBUF_SIMPLE) < 0) {
+            return NULL;
+        }
+        result = parse_many_buffer((const char*)view.buf, view.len,
+                                   kind, base, sep, seplen, context);
+        PyBuffer_Release(&view);
+        return result;
+    }
+
+    return parse_many_iterable(data, kind, base, context);
+}
@@ -332,7 +332,7 @@ GMPy_Real_Pow(PyObject *base, PyObject *exp, PyObject *mod, CTXT_Object *context
         mpc_result = (MPC_Object*)GMPy_Complex_Pow(base, exp, Py_None, context);
         if (!mpc_result || MPC_IS_NAN_P(mpc_result)) {
             Py_XDECREF((PyObject*)mpc_result);
-            context->ctx.invalid = 1;
+            GMPY_SET_FLAG(context, invalid);
             GMPY_INVALID("pow() invalid operation");
             goto err;
         }
@@ -522,7 +522,7 @@ GMPy_MPANY_Pow_Slot(PyObject *base, PyObject *exp, PyObject *mod)
 static PyObject *
 GMPy_MPFR_Pow_Slot(PyObject *base, PyObject *exp, PyObject *mod)
 {
-    if (MPFR_Check(base) && (PyIntOrLong_Check(exp)) && (mod == Py_None)) {
+    if (CHECK_MPFRANY(base) && (PyIntOrLong_Check(exp)) && (mod == Py_None)) {
         MPFR_Object *result = NULL;
         int error = 0;
         long temp_exp;
@@ -49,7 +49,7 @@ GMPy_Real_Is_NAN(PyObject *x, CTXT_Object *context)
     MPFR_Object *tempx;
     int res;
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         res = mpfr_nan_p(MPFR(x));
     }
     else {
@@ -81,7 +81,7 @@ GMPy_Complex_Is_NAN(PyObject *x, CTXT_Object *context)
     MPC_Object *tempx;
     int res;
 
-    if (MPC_Check(x)) {
+    if (CHECK_MPCANY(x)) {
         res = MPC_IS_NAN_P(x);
     }
     else {
@@ -143,7 +143,7 @@ GMPy_Real_Is_Infinite(PyObject *x, CTXT_Object *context)
     MPFR_Object *tempx;
     int res;
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         res = mpfr_inf_p(MPFR(x));
     }
     else {
@@ -175,7 +175,7 @@ GMPy_Complex_Is_Infinite(PyObject *x, CTXT_Object *context)
     MPC_Object *tempx;
     int res;
 
-    if (MPC_Check(x)) {
+    if (CHECK_MPCANY(x)) {
         res = MPC_IS_INF_P(x);
     }
     else {
@@ -224,7 +224,7 @@ GMPy_Real_Is_Finite(PyObject *x, CTXT_Object *context)
     MPFR_Object *tempx;
     int res;
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         res = mpfr_number_p(MPFR(x));
     }
     else {
@@ -256,7 +256,7 @@ GMPy_Complex_Is_Finite(PyObject *x, CTXT_Object *context)
     MPC_Object *tempx;
     int res;
 
-    if (MPC_Check(x)) {
+    if (CHECK_MPCANY(x)) {
         res = MPC_IS_FINITE_P(x);
     }
     else {
@@ -305,7 +305,7 @@ GMPy_Real_Is_Zero(PyObject *x, CTXT_Object *context)
     MPFR_Object *tempx;
     int res;
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         res = mpfr_zero_p(MPFR(x));
     }
     else {
@@ -337,7 +337,7 @@ GMPy_Complex_Is_Zero(PyObject *x, CTXT_Object *context)
     MPC_Object *tempx;
     int res;
 
-    if (MPC_Check(x)) {
+    if (CHECK_MPCANY(x)) {
         res = MPC_IS_ZERO_P(x);
     }
     else {
@@ -383,7 +383,7 @@ GMPy_Real_Is_Signed(PyObject *x, CTXT_Object *context)
     MPFR_Object *tempx;
     int res;
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         res = mpfr_signbit(MPFR(x));
     }
     else {
@@ -429,7 +429,7 @@ GMPy_Real_Is_Regular(PyObject *x, CTXT_Object *context)
     MPFR_Object *tempx;
     int res;
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         res = mpfr_regular_p(MPFR(x));
     }
     else {
@@ -475,7 +475,7 @@ GMPy_Real_Is_Integer(PyObject *x, CTXT_Object *context)
     MPFR_Object *tempx;
     int res;
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         res = mpfr_integer_p(MPFR(x));
     }
     else {
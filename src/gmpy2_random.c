@@ -26,14 +26,274 @@
  * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+/* Philox4x64-10 is a counter based generator (Salmon, Moraes, Dror, and
+ * Shaw, "Parallel random numbers: as easy as 1, 2, 3", SC11). Block i of
+ * the stream is a keyed bijection of the 256-bit counter i, so the stream
+ * can be advanced by any amount in constant time and different keys give
+ * independent streams.
+ *
+ * GMP dispatches every random function (mpz_urandomb, mpfr_urandom, ...)
+ * through a table of function pointers stored in the random state. The
+ * table is not declared in gmp.h but has the same layout in every GMP
+ * release since 4.2 and in MPIR, so a Philox state is a gmp_randstate_t
+ * like any other. The generator state is kept where GMP's own generators
+ * keep theirs, in the limbs of _mp_seed.
+ */
+
+#if GMP_NAIL_BITS == 0 && (GMP_NUMB_BITS == 64 || GMP_NUMB_BITS == 32)
+#define GMPY_PHILOX
+#endif
+
+#ifdef GMPY_PHILOX
+typedef struct {
+    void (*randseed_fn)(__gmp_randstate_struct *, mpz_srcptr);
+    void (*randget_fn)(__gmp_randstate_struct *, mp_ptr, unsigned long int);
+    void (*randclear_fn)(__gmp_randstate_struct *);
+    void (*randiset_fn)(__gmp_randstate_struct *, const __gmp_randstate_struct *);
+} gmpy_randfnptr_t;
+
+typedef struct {
+    uint64_t key[2];
+    uint64_t ctr[4];        /* counter of the block in out */
+    uint64_t out[4];
+    int used;               /* words of out already returned */
+    uint64_t spawned;       /* states created by spawn() */
+} gmpy_philox_t;
+
+#define PHILOX(s) ((gmpy_philox_t*)((s)->_mp_seed->_mp_d))
+
+#define PHILOX_M0 0xD2E7470EE14C6C93ULL
+#define PHILOX_M1 0xCA5A826395121157ULL
+#define PHILOX_W0 0x9E3779B97F4A7C15ULL
+#define PHILOX_W1 0xBB67AE8584CAA73BULL
+
+/* Key tweak used to derive the keys of spawned states. */
+#define PHILOX_S0 0x53706177e2d1c2b7ULL
+#define PHILOX_S1 0x6e67656e4f7c3a19ULL
+
+static const gmpy_randfnptr_t Philox_Funcs;
+
+static uint64_t
+_GMPy_Philox_MulHiLo(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 p = (unsigned __int128)a * b;
+
+    *hi = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    uint64_t a0 = a & 0xffffffff, a1 = a >> 32;
+    uint64_t b0 = b & 0xffffffff, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (mid << 32) | (p00 & 0xffffffff);
+#endif
+}
+
+static void
+_GMPy_Philox_Block(uint64_t *out, const uint64_t *ctr, const uint64_t *key)
+{
+    uint64_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint64_t k0 = key[0], k1 = key[1], lo0, hi0, lo1, hi1;
+    int i;
+
+    for (i = 0; i < 10; i++) {
+        if (i) {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        lo0 = _GMPy_Philox_MulHiLo(PHILOX_M0, c0, &hi0);
+        lo1 = _GMPy_Philox_MulHiLo(PHILOX_M1, c2, &hi1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+    }
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+/* Return the j-th 64-bit word of abs(z). */
+
+static uint64_t
+_GMPy_Philox_Word(mpz_srcptr z, size_t j)
+{
+#if GMP_NUMB_BITS == 64
+    return (uint64_t)mpz_getlimbn(z, j);
+#else
+    return (uint64_t)mpz_getlimbn(z, 2 * j) |
+           ((uint64_t)mpz_getlimbn(z, 2 * j + 1) << 32);
+#endif
+}
+
+/* Restart the stream at block 0. The counter is kept one block behind the
+ * next block to generate and all words of out are marked as used.
+ */
+
+static void
+_GMPy_Philox_Rewind(gmpy_philox_t *p)
+{
+    p->ctr[0] = p->ctr[1] = p->ctr[2] = p->ctr[3] = ~(uint64_t)0;
+    p->used = 4;
+    p->spawned = 0;
+}
+
+/* A seed below 2**128 is used as the key. The remaining 128-bit pieces of
+ * larger seeds are folded into the key by encrypting them.
+ */
+
+static void
+_GMPy_Philox_Seed(__gmp_randstate_struct *rstate, mpz_srcptr seed)
+{
+    gmpy_philox_t *p = PHILOX(rstate);
+    uint64_t ctr[4], out[4];
+    size_t i, pieces = (mpz_sizeinbase(seed, 2) + 127) / 128;
+
+    p->key[0] = _GMPy_Philox_Word(seed, 0);
+    p->key[1] = _GMPy_Philox_Word(seed, 1);
+    for (i = 1; i < pieces; i++) {
+        ctr[0] = _GMPy_Philox_Word(seed, 2 * i);
+        ctr[1] = _GMPy_Philox_Word(seed, 2 * i + 1);
+        ctr[2] = (uint64_t)i;
+        ctr[3] = 0;
+        _GMPy_Philox_Block(out, ctr, p->key);
+        p->key[0] = out[0];
+        p->key[1] = out[1];
+    }
+    _GMPy_Philox_Rewind(p);
+}
+
+static uint64_t
+_GMPy_Philox_Next(gmpy_philox_t *p)
+{
+    if (p->used == 4) {
+        if (!++p->ctr[0] && !++p->ctr[1] && !++p->ctr[2])
+            ++p->ctr[3];
+        _GMPy_Philox_Block(p->out, p->ctr, p->key);
+        p->used = 0;
+    }
+    return p->out[p->used++];
+}
+
+/* Return the high half of the counter of the next word, i.e. the number of
+ * jumps (mod 2**128) from block 0 to the current position.
+ */
+
+static void
+_GMPy_Philox_Jumps(const gmpy_philox_t *p, uint64_t *jumps)
+{
+    uint64_t c[4];
+
+    memcpy(c, p->ctr, sizeof(c));
+    if (p->used == 4 && !++c[0] && !++c[1] && !++c[2])
+        ++c[3];
+    jumps[0] = c[2];
+    jumps[1] = c[3];
+}
+
+static void
+_GMPy_Philox_Get(__gmp_randstate_struct *rstate, mp_ptr dest, unsigned long nbits)
+{
+    gmpy_philox_t *p = PHILOX(rstate);
+    unsigned long i, nlimbs = nbits / GMP_NUMB_BITS, rbits = nbits % GMP_NUMB_BITS;
+    unsigned long total = nlimbs + (rbits != 0);
+
+#if GMP_NUMB_BITS == 64
+    for (i = 0; i < total; i++)
+        dest[i] = (mp_limb_t)_GMPy_Philox_Next(p);
+#else
+    uint64_t w;
+
+    for (i = 0; i < total; i += 2) {
+        w = _GMPy_Philox_Next(p);
+        dest[i] = (mp_limb_t)w;
+        if (i + 1 < total)
+            dest[i + 1] = (mp_limb_t)(w >> 32);
+    }
+#endif
+    if (rbits)
+        dest[nlimbs] &= ((mp_limb_t)1 << rbits) - 1;
+}
+
+static void
+_GMPy_Philox_Clear(__gmp_randstate_struct *rstate)
+{
+    free(PHILOX(rstate));
+    rstate->_mp_seed->_mp_d = NULL;
+}
+
+/* Copy src to the uninitialized state dst. On failure PHILOX(dst) is NULL
+ * and dst must not be used.
+ */
+
+static void
+_GMPy_Philox_Iset(__gmp_randstate_struct *dst, const __gmp_randstate_struct *src)
+{
+    dst->_mp_seed->_mp_alloc = 0;
+    dst->_mp_seed->_mp_size = 0;
+    dst->_mp_seed->_mp_d = (mp_limb_t*)malloc(sizeof(gmpy_philox_t));
+    dst->_mp_alg = src->_mp_alg;
+    dst->_mp_algdata._mp_lc = src->_mp_algdata._mp_lc;
+    if (PHILOX(dst))
+        memcpy(PHILOX(dst), PHILOX(src), sizeof(gmpy_philox_t));
+}
+
+static const gmpy_randfnptr_t Philox_Funcs = {
+    _GMPy_Philox_Seed,
+    _GMPy_Philox_Get,
+    _GMPy_Philox_Clear,
+    _GMPy_Philox_Iset
+};
+
+/* Initialize a Philox state seeded with 0. Returns -1 if out of memory. */
+
+static int
+_GMPy_Philox_Init(__gmp_randstate_struct *rstate)
+{
+    rstate->_mp_seed->_mp_alloc = 0;
+    rstate->_mp_seed->_mp_size = 0;
+    if (!(rstate->_mp_seed->_mp_d = (mp_limb_t*)malloc(sizeof(gmpy_philox_t))))
+        return -1;
+    rstate->_mp_alg = GMP_RAND_ALG_DEFAULT;
+    rstate->_mp_algdata._mp_lc = (void*)&Philox_Funcs;
+    memset(PHILOX(rstate), 0, sizeof(gmpy_philox_t));
+    _GMPy_Philox_Rewind(PHILOX(rstate));
+    return 0;
+}
+
+#define IS_PHILOX(s) ((s)->_mp_algdata._mp_lc == (void*)&Philox_Funcs)
+#endif
+
+/* Create a random state using GMP's default generator or, if philox is
+ * non-zero, the Philox generator. The state is seeded with 0.
+ */
+
 static RandomState_Object *
-GMPy_RandomState_New(void)
+GMPy_RandomState_New(int philox)
 {
     RandomState_Object *result;
 
-    if ((result = PyObject_New(RandomState_Object, &RandomState_Type))) {
-        gmp_randinit_default(result->state);
+    if (!(result = PyObject_New(RandomState_Object, &RandomState_Type)))
+        return NULL;
+
+#ifdef GMPY_PHILOX
+    if (philox) {
+        if (_GMPy_Philox_Init(result->state) < 0) {
+            /* LCOV_EXCL_START */
+            PyObject_Del(result);
+            return (RandomState_Object*)PyErr_NoMemory();
+            /* LCOV_EXCL_STOP */
+        }
+        return result;
     }
+#endif
+
+    gmp_randinit_default(result->state);
+    gmp_randseed_ui(result->state, 0);
     return result;
 };
 
@@ -51,25 +311,55 @@ GMPy_RandomState_Repr(RandomState_Object *self)
 };
 
 PyDoc_STRVAR(GMPy_doc_random_state_factory,
-"random_state([seed]) -> object\n\n"
+"random_state([seed][, generator='mt']) -> object\n\n"
 "Return new object containing state information for the random number\n"
-"generator. An optional integer can be specified as the seed value.");
+"generator. An optional integer can be specified as the seed value.\n"
+"generator may be 'mt' (GMP's default Mersenne Twister generator) or\n"
+"'philox' (the counter based Philox4x64-10 generator). Only 'philox'\n"
+"states support jumped() and spawn().");
 
 static PyObject *
-GMPy_RandomState_Factory(PyObject *self, PyObject *args)
+GMPy_RandomState_Factory(PyObject *self, PyObject *args, PyObject *keywds)
 {
     RandomState_Object *result;
     MPZ_Object *temp;
+    PyObject *seed = NULL;
+    const char *generator = "mt";
+    int philox;
+    static char *kwlist[] = {"seed", "generator", NULL};
+
+    if (PyTuple_GET_SIZE(args) > 1) {
+        TYPE_ERROR("random_state() requires 0 or 1 integer arguments");
+        return NULL;
+    }
 
-    if (!(result = GMPy_RandomState_New())) {
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "|Os", kwlist,
+                                     &seed, &generator)) {
         return NULL;
     }
 
-    if (PyTuple_GET_SIZE(args) == 0) {
-        gmp_randseed_ui(result->state, 0);
+    if (!strcmp(generator, "mt")) {
+        philox = 0;
+    }
+    else if (!strcmp(generator, "philox")) {
+#ifdef GMPY_PHILOX
+        philox = 1;
+#else
+        VALUE_ERROR("random_state() generator 'philox' is not supported by this GMP");
+        return NULL;
+#endif
     }
-    else if (PyTuple_GET_SIZE(args) == 1) {
-        if (!(temp = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args,0), NULL))) {
+    else {
+        VALUE_ERROR("random_state() generator must be 'mt' or 'philox'");
+        return NULL;
+    }
+
+    if (!(result = GMPy_RandomState_New(philox))) {
+        return NULL;
+    }
+
+    if (seed) {
+        if (!(temp = GMPy_MPZ_From_Integer(seed, NULL))) {
             Py_DECREF((PyObject*)result);
             TYPE_ERROR("seed must be an integer");
             return NULL;
@@ -77,12 +367,190 @@ GMPy_RandomState_Factory(PyObject *self, PyObject *args)
         gmp_randseed(result->state, temp->z);
         Py_DECREF((PyObject*)temp);
     }
-    else {
-        Py_DECREF((PyObject*)result);
-        TYPE_ERROR("random_state() requires 0 or 1 integer arguments");
+    return (PyObject*)result;
+}
+
+#ifdef GMPY_PHILOX
+/* Return a new random state with a copy of the Philox state of self. */
+
+static RandomState_Object *
+_GMPy_RandomState_Copy(RandomState_Object *self)
+{
+    RandomState_Object *result;
+
+    if (!(result = PyObject_New(RandomState_Object, &RandomState_Type)))
         return NULL;
+
+    _GMPy_Philox_Iset(result->state, self->state);
+    if (!PHILOX(result->state)) {
+        /* LCOV_EXCL_START */
+        PyObject_Del(result);
+        return (RandomState_Object*)PyErr_NoMemory();
+        /* LCOV_EXCL_STOP */
     }
+    return result;
+}
+#endif
+
+PyDoc_STRVAR(GMPy_doc_random_state_jumped,
+"x.jumped(jumps=1) -> random_state\n\n"
+"Return a copy of the 'philox' random_state x advanced by jumps*2**128\n"
+"blocks of 256 random bits. x is not changed. States that are jumped\n"
+"by different amounts give non-overlapping streams of 2**128 blocks.");
+
+static PyObject *
+GMPy_RandomState_Jumped(RandomState_Object *self, PyObject *args)
+{
+#ifdef GMPY_PHILOX
+    RandomState_Object *result;
+    MPZ_Object *temp;
+    gmpy_philox_t *p;
+    PyObject *jumps = NULL;
+    uint64_t lo, hi;
+
+    if (!PyArg_ParseTuple(args, "|O", &jumps))
+        return NULL;
+
+    if (!IS_PHILOX(self->state)) {
+        VALUE_ERROR("jumped() requires a random_state with generator 'philox'");
+        return NULL;
+    }
+
+    if (jumps) {
+        if (!(temp = GMPy_MPZ_From_Integer(jumps, NULL))) {
+            TYPE_ERROR("jumped() requires an integer argument");
+            return NULL;
+        }
+        if (mpz_sgn(temp->z) < 0) {
+            Py_DECREF((PyObject*)temp);
+            VALUE_ERROR("jumped() requires jumps be greater than or equal to 0");
+            return NULL;
+        }
+        /* Only jumps mod 2**128 matters. */
+        lo = _GMPy_Philox_Word(temp->z, 0);
+        hi = _GMPy_Philox_Word(temp->z, 1);
+        Py_DECREF((PyObject*)temp);
+    }
+    else {
+        lo = 1;
+        hi = 0;
+    }
+
+    if (!(result = _GMPy_RandomState_Copy(self)))
+        return NULL;
+
+    /* Add jumps to the high half of the counter and regenerate any words
+     * of the current block that have not been used yet.
+     */
+    p = PHILOX(result->state);
+    p->ctr[2] += lo;
+    p->ctr[3] += hi + (p->ctr[2] < lo);
+    if (p->used < 4)
+        _GMPy_Philox_Block(p->out, p->ctr, p->key);
     return (PyObject*)result;
+#else
+    VALUE_ERROR("jumped() requires a random_state with generator 'philox'");
+    return NULL;
+#endif
+}
+
+PyDoc_STRVAR(GMPy_doc_random_state_spawn,
+"x.spawn(n) -> list\n\n"
+"Return a list of n new 'philox' random states for use by parallel\n"
+"workers. Each state has its own key derived from the key, the\n"
+"jumps, and the number of states already spawned by x, so repeated\n"
+"calls, and calls on spawned states, give new independent streams.\n"
+"The random numbers generated by x are not changed.");
+
+static PyObject *
+GMPy_RandomState_Spawn(RandomState_Object *self, PyObject *args)
+{
+#ifdef GMPY_PHILOX
+    RandomState_Object *temp;
+    PyObject *result;
+    gmpy_philox_t *p, *c;
+    uint64_t ctr[4], key[2], out[4];
+    Py_ssize_t i, n;
+
+    if (!PyArg_ParseTuple(args, "n", &n))
+        return NULL;
+
+    if (!IS_PHILOX(self->state)) {
+        VALUE_ERROR("spawn() requires a random_state with generator 'philox'");
+        return NULL;
+    }
+
+    if (n < 0) {
+        VALUE_ERROR("spawn() requires n be greater than or equal to 0");
+        return NULL;
+    }
+
+    if (!(result = PyList_New(n)))
+        return NULL;
+
+    p = PHILOX(self->state);
+    key[0] = p->key[0] ^ PHILOX_S0;
+    key[1] = p->key[1] ^ PHILOX_S1;
+    for (i = 0; i < n; i++) {
+        if (!(temp = _GMPy_RandomState_Copy(self))) {
+            /* LCOV_EXCL_START */
+            Py_DECREF(result);
+            return NULL;
+            /* LCOV_EXCL_STOP */
+        }
+        ctr[0] = p->spawned++;
+        ctr[1] = 0;
+        _GMPy_Philox_Jumps(p, ctr + 2);
+        _GMPy_Philox_Block(out, ctr, key);
+        c = PHILOX(temp->state);
+        c->key[0] = out[0];
+        c->key[1] = out[1];
+        _GMPy_Philox_Rewind(c);
+        PyList_SET_ITEM(result, i, (PyObject*)temp);
+    }
+    return result;
+#else
+    VALUE_ERROR("spawn() requires a random_state with generator 'philox'");
+    return NULL;
+#endif
+}
+
+/* Get a writable, contiguous buffer with room for n 64-bit values. The
+ * buffer may hold raw bytes or items of 8 bytes whose struct format code is
+ * one of codes. Returns 0 on success and -1 with an exception set.
+ */
+
+static int
+_GMPy_Random_Get_Buffer(PyObject *out, Py_buffer *view, Py_ssize_t n,
+                        const char *codes, const char *name)
+{
+    const char *fmt;
+
+    if (PyObject_GetBuffer(out, view, PyBUF_CONTIG | PyBUF_FORMAT) < 0) {
+        PyErr_Clear();
+        PyErr_Format(PyExc_TypeError, "%s() requires 'out' be a writable "
+                     "contiguous buffer", name);
+        return -1;
+    }
+
+    fmt = view->format ? view->format : "B";
+    if (*fmt == '@' || *fmt == '=')
+        fmt++;
+    if (!((fmt[0] == 'B' || fmt[0] == 'b' || fmt[0] == 'c') && fmt[1] == 0) &&
+        !(view->itemsize == 8 && fmt[0] && fmt[1] == 0 && strchr(codes, fmt[0]))) {
+        PyBuffer_Release(view);
+        PyErr_Format(PyExc_TypeError, "%s() requires 'out' with items of "
+                     "format '%c'", name, codes[0]);
+        return -1;
+    }
+
+    if (n > view->len / 8) {
+        PyBuffer_Release(view);
+        PyErr_Format(PyExc_ValueError, "%s() requires 'out' be large enough "
+                     "for n values", name);
+        return -1;
+    }
+    return 0;
 }
 
 PyDoc_STRVAR(GMPy_doc_mpz_urandomb_function,
@@ -119,6 +587,90 @@ GMPy_MPZ_urandomb_Function(PyObject *self, PyObject *args)
     return (PyObject*)result;
 }
 
+PyDoc_STRVAR(GMPy_doc_mpz_urandomb_many_function,
+"mpz_urandomb_many(random_state, bit_count, n, out=None) -> list\n\n"
+"Return a list of n uniformly distributed random integers between 0\n"
+"and 2**bit_count-1. The values are the same as n calls to\n"
+"mpz_urandomb(). If bit_count <= 64, out may be a writable buffer of\n"
+"uint64 items (or raw bytes) that is filled with the values instead;\n"
+"out is then returned.");
+
+static PyObject *
+GMPy_MPZ_urandomb_many_Function(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    PyObject *state, *bits, *out = Py_None, *result;
+    MPZ_Object *temp;
+    mp_bitcnt_t len;
+    Py_ssize_t i, n;
+    Py_buffer view;
+    mpz_t z;
+    uint64_t v;
+    static char *kwlist[] = {"random_state", "bit_count", "n", "out", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "OOn|O", kwlist,
+                                     &state, &bits, &n, &out)) {
+        return NULL;
+    }
+
+    if (!RandomState_Check(state)) {
+        TYPE_ERROR("mpz_urandomb_many() requires 'random_state' and 'bit_count' arguments");
+        return NULL;
+    }
+
+    len = mp_bitcnt_t_From_Integer(bits);
+    if (len == (mp_bitcnt_t)(-1) && PyErr_Occurred()) {
+        TYPE_ERROR("mpz_urandomb_many() requires 'random_state' and 'bit_count' arguments");
+        return NULL;
+    }
+
+    if (n < 0) {
+        VALUE_ERROR("mpz_urandomb_many() requires n be greater than or equal to 0");
+        return NULL;
+    }
+
+    if (out == Py_None) {
+        if (!(result = PyList_New(n)))
+            return NULL;
+        for (i = 0; i < n; i++) {
+            if (!(temp = GMPy_MPZ_New(NULL))) {
+                /* LCOV_EXCL_START */
+                Py_DECREF(result);
+                return NULL;
+                /* LCOV_EXCL_STOP */
+            }
+            mpz_urandomb(temp->z, RANDOM_STATE(state), len);
+            PyList_SET_ITEM(result, i, (PyObject*)temp);
+        }
+        return result;
+    }
+
+    if (len > 64) {
+        VALUE_ERROR("mpz_urandomb_many() requires bit_count <= 64 to fill 'out'");
+        return NULL;
+    }
+
+    if (_GMPy_Random_Get_Buffer(out, &view, n, sizeof(long) == 8 ? "QL" : "Q",
+                                "mpz_urandomb_many") < 0) {
+        return NULL;
+    }
+
+    mpz_init2(z, 64);
+    for (i = 0; i < n; i++) {
+        mpz_urandomb(z, RANDOM_STATE(state), len);
+#if GMP_NUMB_BITS >= 64
+        v = (uint64_t)mpz_getlimbn(z, 0);
+#else
+        v = 0;
+        mpz_export(&v, NULL, -1, sizeof(v), 0, 0, z);
+#endif
+        memcpy((char*)view.buf + 8 * i, &v, 8);
+    }
+    mpz_clear(z);
+    PyBuffer_Release(&view);
+    Py_INCREF(out);
+    return out;
+}
+
 PyDoc_STRVAR(GMPy_doc_mpz_rrandomb_function,
 "mpz_rrandomb(random_state, bit_count) -> mpz\n\n"
 "Return a random integer between 0 and 2**bit_count-1 with long\n"
@@ -214,6 +766,123 @@ GMPy_MPFR_random_Function(PyObject *self, PyObject *args)
     return (PyObject*)result;
 }
 
+/* Fill n values of the uniform (gauss == 0) or gaussian (gauss != 0)
+ * distribution into a list, or into a float64 buffer. The values match
+ * those returned by mpfr_random() and mpfr_grandom() for the same state.
+ */
+
+static PyObject *
+_GMPy_MPFR_Random_Many(PyObject *args, PyObject *keywds, int gauss,
+                       const char *name)
+{
+    PyObject *state, *out = Py_None, *result;
+    MPFR_Object *temp, *temp2 = NULL;
+    Py_ssize_t i, n;
+    Py_buffer view;
+    mpfr_t f, g;
+    double d;
+    CTXT_Object *context = NULL;
+    static char *kwlist[] = {"random_state", "n", "out", NULL};
+
+    CHECK_CONTEXT(context);
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "On|O", kwlist,
+                                     &state, &n, &out)) {
+        return NULL;
+    }
+
+    if (!RandomState_Check(state)) {
+        PyErr_Format(PyExc_TypeError, "%s() requires 'random_state' argument", name);
+        return NULL;
+    }
+
+    if (n < 0) {
+        PyErr_Format(PyExc_ValueError, "%s() requires n be greater than or "
+                     "equal to 0", name);
+        return NULL;
+    }
+
+    if (out == Py_None) {
+        if (!(result = PyList_New(n)))
+            return NULL;
+        for (i = 0; i < n; i++) {
+            if (gauss && (i & 1)) {
+                /* Second value of the previous pair. */
+                PyList_SET_ITEM(result, i, (PyObject*)temp2);
+                temp2 = NULL;
+                continue;
+            }
+            if (!(temp = GMPy_MPFR_New(0, context))) {
+                /* LCOV_EXCL_START */
+                Py_DECREF(result);
+                return NULL;
+                /* LCOV_EXCL_STOP */
+            }
+            if (gauss) {
+                if (!(temp2 = GMPy_MPFR_New(0, context))) {
+                    /* LCOV_EXCL_START */
+                    Py_DECREF((PyObject*)temp);
+                    Py_DECREF(result);
+                    return NULL;
+                    /* LCOV_EXCL_STOP */
+                }
+                mpfr_grandom(temp->f, temp2->f, RANDOM_STATE(state),
+                             GET_MPFR_ROUND(context));
+            }
+            else {
+                mpfr_urandom(temp->f, RANDOM_STATE(state), GET_MPFR_ROUND(context));
+            }
+            PyList_SET_ITEM(result, i, (PyObject*)temp);
+        }
+        Py_XDECREF((PyObject*)temp2);
+        return result;
+    }
+
+    if (GET_MPFR_PREC(context) > 53) {
+        PyErr_Format(PyExc_ValueError, "%s() requires precision <= 53 to "
+                     "fill 'out'", name);
+        return NULL;
+    }
+
+    if (_GMPy_Random_Get_Buffer(out, &view, n, "d", name) < 0)
+        return NULL;
+
+    /* Values with at most 53 bits are converted to double exactly. */
+    mpfr_init2(f, GET_MPFR_PREC(context));
+    mpfr_init2(g, GET_MPFR_PREC(context));
+    for (i = 0; i < n; i++) {
+        if (gauss) {
+            if (!(i & 1))
+                mpfr_grandom(f, g, RANDOM_STATE(state), GET_MPFR_ROUND(context));
+            d = mpfr_get_d((i & 1) ? g : f, MPFR_RNDN);
+        }
+        else {
+            mpfr_urandom(f, RANDOM_STATE(state), GET_MPFR_ROUND(context));
+            d = mpfr_get_d(f, MPFR_RNDN);
+        }
+        memcpy((char*)view.buf + 8 * i, &d, 8);
+    }
+    mpfr_clear(f);
+    mpfr_clear(g);
+    PyBuffer_Release(&view);
+    Py_INCREF(out);
+    return out;
+}
+
+PyDoc_STRVAR(GMPy_doc_mpfr_random_many_function,
+"mpfr_random_many(random_state, n, out=None) -> list\n\n"
+"Return a list of n uniformly distributed numbers between [0,1]. The\n"
+"values are the same as n calls to mpfr_random(). If the context\n"
+"precision is <= 53, out may be a writable buffer of float64 items\n"
+"(or raw bytes) that is filled with the values instead; out is then\n"
+"returned.");
+
+static PyObject *
+GMPy_MPFR_random_many_Function(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    return _GMPy_MPFR_Random_Many(args, keywds, 0, "mpfr_random_many");
+}
+
 PyDoc_STRVAR(GMPy_doc_mpfr_grandom_function,
 "mpfr_grandom(random_state) -> (mpfr, mpfr)\n\n"
 "Return two random numbers with gaussian distribution.");
@@ -257,6 +926,20 @@ GMPy_MPFR_grandom_Function(PyObject *self, PyObject *args)
     return result;
 }
 
+PyDoc_STRVAR(GMPy_doc_mpfr_grandom_many_function,
+"mpfr_grandom_many(random_state, n, out=None) -> list\n\n"
+"Return a list of n random numbers with gaussian distribution. The\n"
+"values are generated in pairs as by mpfr_grandom(); if n is odd the\n"
+"second value of the last pair is discarded. If the context precision\n"
+"is <= 53, out may be a writable buffer of float64 items (or raw\n"
+"bytes) that is filled with the values instead; out is then returned.");
+
+static PyObject *
+GMPy_MPFR_grandom_many_Function(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    return _GMPy_MPFR_Random_Many(args, keywds, 1, "mpfr_grandom_many");
+}
+
 PyDoc_STRVAR(GMPy_doc_mpc_random_function,
 "mpc_random(random_state) -> mpc\n\n"
 "Return uniformly distributed number in the unit square [0,1]x[0,1].");
@@ -286,6 +969,13 @@ GMPy_MPC_random_Function(PyObject *self, PyObject *args)
     return (PyObject*)result;
 }
 
+static PyMethodDef GMPy_RandomState_methods[] =
+{
+    { "jumped", (PyCFunction)GMPy_RandomState_Jumped, METH_VARARGS, GMPy_doc_random_state_jumped },
+    { "spawn", (PyCFunction)GMPy_RandomState_Spawn, METH_VARARGS, GMPy_doc_random_state_spawn },
+    { NULL, NULL, 1 }
+};
+
 static PyTypeObject RandomState_Type =
 {
 #ifdef PY3
@@ -320,7 +1010,7 @@ static PyTypeObject RandomState_Type =
         0,                                  /* tp_weaklistoffset*/
         0,                                  /* tp_iter          */
         0,                                  /* tp_iternext      */
-        0,                                  /* tp_methods       */
+    GMPy_RandomState_methods,               /* tp_methods       */
         0,                                  /* tp_members       */
         0,                                  /* tp_getset        */
 };
@@ -46,16 +46,21 @@ static PyTypeObject RandomState_Type;
 #define RANDOM_STATE(obj) (((RandomState_Object *)(obj))->state)
 #define RandomState_Check(v) (((PyObject*)v)->ob_type == &RandomState_Type)
 
-static RandomState_Object * GMPy_RandomState_New(void);
+static RandomState_Object * GMPy_RandomState_New(int philox);
 static void                 GMPy_RandomState_Dealloc(RandomState_Object *self);
 
 static PyObject * GMPy_RandomState_Repr(RandomState_Object *self);
-static PyObject * GMPy_RandomState_Factory(PyObject *self, PyObject *args);
+static PyObject * GMPy_RandomState_Factory(PyObject *self, PyObject *args, PyObject *keywds);
+static PyObject * GMPy_RandomState_Jumped(RandomState_Object *self, PyObject *args);
+static PyObject * GMPy_RandomState_Spawn(RandomState_Object *self, PyObject *args);
 static PyObject * GMPy_MPZ_urandomb_Function(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPZ_urandomb_many_Function(PyObject *self, PyObject *args, PyObject *keywds);
 static PyObject * GMPy_MPZ_rrandomb_Function(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPZ_random_Function(PyObject *self, PyObject *args);
 static PyObject * GMPy_MPFR_random_Function(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPFR_random_many_Function(PyObject *self, PyObject *args, PyObject *keywds);
 static PyObject * GMPy_MPFR_grandom_Function(PyObject *self, PyObject *args);
+static PyObject * GMPy_MPFR_grandom_many_Function(PyObject *self, PyObject *args, PyObject *keywds);
 static PyObject * GMPy_MPC_random_Function(PyObject *self, PyObject *args);
 
 #ifdef __cplusplus
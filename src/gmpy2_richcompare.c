@@ -50,6 +50,13 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
     PyObject *tempa = NULL, *tempb = NULL, *result = NULL;
     CTXT_Object *context = NULL;
 
+    /* Comparing an mpz with a small Python integer does not need the
+     * context.
+     */
+    if (MPZ_Check(a) && IS_SMALL_PYINT(b)) {
+        return _cmp_to_object(mpz_cmp_si(MPZ(a), SMALL_PYINT_AS_LONG(b)), op);
+    }
+
     CHECK_CONTEXT(context);
 
     if (CHECK_MPZANY(a)) {
@@ -113,6 +120,15 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
         }
     }
 
+    if (XMPQ_Check(a)) {
+        if (!(tempa = (PyObject*)GMPy_MPQ_From_XMPQ((XMPQ_Object*)a, context))) {
+            return NULL;
+        }
+        result = GMPy_RichCompare_Slot(tempa, b, op);
+        Py_DECREF(tempa);
+        return result;
+    }
+
     if (MPQ_Check(a)) {
         if (MPQ_Check(b)) {
             return _cmp_to_object(mpq_cmp(MPQ(a), MPQ(b)), op);
@@ -152,13 +168,13 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
         }
     }
 
-    if (MPFR_Check(a)) {
-        if (MPFR_Check(b)) {
+    if (CHECK_MPFRANY(a)) {
+        if (CHECK_MPFRANY(b)) {
             mpfr_clear_flags();
             c = mpfr_cmp(MPFR(a), MPFR(b));
             if (mpfr_erangeflag_p()) {
                 /* Set erange and check if an exception should be raised. */
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
@@ -178,7 +194,7 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
             c = mpfr_cmp_d(MPFR(a), d);
             if (mpfr_erangeflag_p()) {
                 /* Set erange and check if an exception should be raised. */
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
@@ -201,7 +217,7 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
             Py_DECREF(tempb);
             if (mpfr_erangeflag_p()) {
                 /* Set erange and check if an exception should be raised. */
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
@@ -224,7 +240,7 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
             Py_DECREF(tempb);
             if (mpfr_erangeflag_p()) {
                 /* Set erange and check if an exception should be raised. */
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
@@ -247,7 +263,7 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
             Py_DECREF(tempb);
             if (mpfr_erangeflag_p()) {
                 /* Set erange and check if an exception should be raised. */
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
@@ -262,17 +278,17 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
         }
     }
 
-    if (MPC_Check(a)) {
+    if (CHECK_MPCANY(a)) {
         if (!(op == Py_EQ || op == Py_NE)) {
             TYPE_ERROR("no ordering relation is defined for complex numbers");
             return NULL;
         }
-        if (MPC_Check(b)) {
+        if (CHECK_MPCANY(b)) {
             mpfr_clear_flags();
             c = mpc_cmp(MPC(a), MPC(b));
             if (mpfr_erangeflag_p()) {
                 /* Set erange and check if an exception should be raised. */
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
@@ -295,7 +311,7 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
             Py_DECREF(tempb);
             if (mpfr_erangeflag_p()) {
                 /* Set erange and check if an exception should be raised. */
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
@@ -312,7 +328,7 @@ GMPy_RichCompare_Slot(PyObject *a, PyObject *b, int op)
         if (!mpfr_zero_p(mpc_imagref(MPC(a)))) {
             /* if a.real is NaN, possibly raise exception */
             if (mpfr_nan_p(mpc_realref(MPC(a)))) {
-                context->ctx.erange = 1;
+                GMPY_SET_FLAG(context, erange);
                 if (context->ctx.traps & TRAP_ERANGE) {
                     GMPY_ERANGE("comparison with NaN");
                     return NULL;
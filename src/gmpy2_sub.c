@@ -47,7 +47,7 @@
  *   GMPy_Real_Sub(Real, Real, context|NULL)
  *   GMPy_Complex_Sub(Complex, Complex, context|NULL)
  *
- *   GMPy_Context_Sub(context, args)
+ *   GMPy_Context_Sub(context, GMPY_KWARGS_PARAMS)
  *
  */
 
@@ -149,15 +149,62 @@ GMPy_Integer_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
 static PyObject *
 GMPy_MPZ_Sub_Slot(PyObject *x, PyObject *y)
 {
-    if (MPZ_Check(x) && MPZ_Check(y)) {
-        MPZ_Object *result = NULL;
+    MPZ_Object *result = NULL;
+    long temp, small;
 
+    if (MPZ_Check(x) && MPZ_Check(y)) {
+        if (x == y && MPZ_IS_INTERNED(0)) {
+            return GMPy_MPZ_Intern(0);
+        }
+        if (GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            GMPy_MPZ_GetSmall(MPZ(y), &temp) &&
+            MPZ_IS_INTERNED(small - temp)) {
+            return GMPy_MPZ_Intern(small - temp);
+        }
         if ((result = GMPy_MPZ_New(NULL))) {
             mpz_sub(result->z, MPZ(x), MPZ(y));
         }
         return (PyObject*)result;
     }
 
+    /* Fast paths for an mpz and a small Python integer. */
+    if (MPZ_Check(x) && IS_SMALL_PYINT(y)) {
+        temp = SMALL_PYINT_AS_LONG(y);
+        if (MPZ_IS_INTERN_OPERAND(temp) &&
+            GMPy_MPZ_GetSmall(MPZ(x), &small) &&
+            MPZ_IS_INTERNED(small - temp)) {
+            return GMPy_MPZ_Intern(small - temp);
+        }
+        if ((result = GMPy_MPZ_New(NULL))) {
+            if (temp >= 0) {
+                mpz_sub_ui(result->z, MPZ(x), temp);
+            }
+            else {
+                mpz_add_ui(result->z, MPZ(x), -temp);
+            }
+        }
+        return (PyObject*)result;
+    }
+
+    if (IS_SMALL_PYINT(x) && MPZ_Check(y)) {
+        temp = SMALL_PYINT_AS_LONG(x);
+        if (MPZ_IS_INTERN_OPERAND(temp) &&
+            GMPy_MPZ_GetSmall(MPZ(y), &small) &&
+            MPZ_IS_INTERNED(temp - small)) {
+            return GMPy_MPZ_Intern(temp - small);
+        }
+        if ((result = GMPy_MPZ_New(NULL))) {
+            if (temp >= 0) {
+                mpz_ui_sub(result->z, temp, MPZ(y));
+            }
+            else {
+                mpz_add_ui(result->z, MPZ(y), -temp);
+                mpz_neg(result->z, result->z);
+            }
+        }
+        return (PyObject*)result;
+    }
+
     if (IS_INTEGER(x) && IS_INTEGER(y))
         return GMPy_Integer_Sub(x, y, NULL);
 
@@ -264,27 +311,27 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPFR_Check(x) && MPFR_Check(y)) {
-        mpfr_clear_flags();
+    if (CHECK_MPFRANY(x) && CHECK_MPFRANY(y)) {
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_sub(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
         goto done;
     }
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         if (PyIntOrLong_Check(y)) {
             int error;
             long temp = GMPy_Integer_AsLongAndError(y, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_sub_si(result->f, MPFR(x), temp, GET_MPFR_ROUND(context));
                 goto done;
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, y);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_sub_z(result->f, MPFR(x), global.tempz, GET_MPFR_ROUND(context));
                 goto done;
@@ -292,7 +339,7 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_sub_z(result->f, MPFR(x), MPZ(y), GET_MPFR_ROUND(context));
             goto done;
@@ -308,7 +355,7 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
                 /* LCOV_EXCL_STOP */
             }
 
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_sub_q(result->f, MPFR(x), tempy->q, GET_MPFR_ROUND(context));
             Py_DECREF((PyObject*)tempy);
@@ -316,20 +363,20 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_sub_d(result->f, MPFR(x), PyFloat_AS_DOUBLE(y), GET_MPFR_ROUND(context));
             goto done;
         }
     }
 
-    if (MPFR_Check(y)) {
+    if (CHECK_MPFRANY(y)) {
         if (PyIntOrLong_Check(x)) {
             int error;
             long temp = GMPy_Integer_AsLongAndError(x, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_sub_si(result->f, MPFR(y), temp, GET_MPFR_ROUND(context));
                 mpfr_neg(result->f, result->f, GET_MPFR_ROUND(context));
@@ -337,7 +384,7 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, x);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_sub_z(result->f, MPFR(y), global.tempz, GET_MPFR_ROUND(context));
                 mpfr_neg(result->f, result->f, GET_MPFR_ROUND(context));
@@ -346,7 +393,7 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_sub_z(result->f, MPFR(y), MPZ(x), GET_MPFR_ROUND(context));
             mpfr_neg(result->f, result->f, GET_MPFR_ROUND(context));
@@ -363,7 +410,7 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
                 /* LCOV_EXCL_STOP */
             }
 
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_sub_q(result->f, MPFR(y), tempx->q, GET_MPFR_ROUND(context));
             mpfr_neg(result->f, result->f, GET_MPFR_ROUND(context));
@@ -372,7 +419,7 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_sub_d(result->f, MPFR(y), PyFloat_AS_DOUBLE(x), GET_MPFR_ROUND(context));
             mpfr_neg(result->f, result->f, GET_MPFR_ROUND(context));
@@ -393,7 +440,7 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
             /* LCOV_EXCL_STOP */
         }
 
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_sub(result->f, MPFR(tempx), MPFR(tempy), GET_MPFR_ROUND(context));
         Py_DECREF((PyObject*)tempx);
@@ -420,14 +467,14 @@ GMPy_Real_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
 static PyObject *
 GMPy_MPFR_Sub_Slot(PyObject *x, PyObject *y)
 {
-    if (MPFR_Check(x) && MPFR_Check(y)) {
+    if (CHECK_MPFRANY(x) && CHECK_MPFRANY(y)) {
         MPFR_Object *result;
         CTXT_Object *context = NULL;
 
         CHECK_CONTEXT(context);
 
         if ((result = GMPy_MPFR_New(0, context))) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_sub(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
             _GMPy_MPFR_Cleanup(&result, context);
@@ -462,7 +509,7 @@ GMPy_Complex_Sub(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPC_Check(x) && MPC_Check(y)) {
+    if (CHECK_MPCANY(x) && CHECK_MPCANY(y)) {
 
         result->rc = mpc_sub(result->c, MPC(x), MPC(y), GET_MPC_ROUND(context));
         _GMPy_MPC_Cleanup(&result, context);
@@ -540,11 +587,12 @@ PyDoc_STRVAR(GMPy_doc_context_sub,
 "Return x - y.");
 
 static PyObject *
-GMPy_Context_Sub(PyObject *self, PyObject *args)
+GMPy_Context_Sub(PyObject *self, GMPY_KWARGS_PARAMS)
 {
-    CTXT_Object *context = NULL;
+    CTXT_Object *context = NULL, *local, temp_context;
+    PyObject *result;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (GMPY_KWARGS_NARGS != 2) {
         TYPE_ERROR("sub() requires 2 arguments");
         return NULL;
     }
@@ -556,8 +604,14 @@ GMPy_Context_Sub(PyObject *self, PyObject *args)
         CHECK_CONTEXT(context);
     }
 
-    return GMPy_Number_Sub(PyTuple_GET_ITEM(args, 0),
-                           PyTuple_GET_ITEM(args, 1),
-                           context);
+    if (!(local = GMPY_KWARGS_CONTEXT(context, &temp_context))) {
+        return NULL;
+    }
+
+    result = GMPy_Number_Sub(GMPY_KWARGS_ARG(0),
+                             GMPY_KWARGS_ARG(1),
+                             local);
+    GMPy_CTXT_Merge_Flags(context, local);
+    return result;
 }
 
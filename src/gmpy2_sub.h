@@ -49,7 +49,7 @@ static PyObject * GMPy_MPQ_Sub_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPFR_Sub_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPC_Sub_Slot(PyObject *x, PyObject *y);
 
-static PyObject * GMPy_Context_Sub(PyObject *self, PyObject *args);
+static PyObject * GMPy_Context_Sub(PyObject *self, GMPY_KWARGS_PARAMS);
 
 #ifdef __cplusplus
 }
@@ -47,7 +47,7 @@
  *   GMPy_Real_TrueDiv(Real, Real, context|NULL)
  *   GMPy_Complex_TrueDiv(Complex, Complex, context|NULL)
  *
- *   GMPy_Context_TrueDiv(context, args)
+ *   GMPy_Context_TrueDiv(context, GMPY_KWARGS_PARAMS)
  *
  */
 
@@ -97,7 +97,7 @@ GMPy_Integer_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         mpq_set_den(tempq, tempy->z);
         mpq_canonicalize(tempq);
 
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_set_q(result->f, tempq, GET_MPFR_ROUND(context));
 
@@ -235,27 +235,27 @@ GMPy_Real_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         /* LCOV_EXCL_STOP */
     }
 
-    if (MPFR_Check(x) && MPFR_Check(y)) {
-        mpfr_clear_flags();
+    if (CHECK_MPFRANY(x) && CHECK_MPFRANY(y)) {
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_div(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
         goto done;
     }
 
-    if (MPFR_Check(x)) {
+    if (CHECK_MPFRANY(x)) {
         if (PyIntOrLong_Check(y)) {
             int error;
             long temp = GMPy_Integer_AsLongAndError(y, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_div_si(result->f, MPFR(x), temp, GET_MPFR_ROUND(context));
                 goto done;
             }
             else {
                 mpz_set_PyIntOrLong(global.tempz, y);
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_div_z(result->f, MPFR(x), global.tempz, GET_MPFR_ROUND(context));
                 goto done;
@@ -263,7 +263,7 @@ GMPy_Real_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (CHECK_MPZANY(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div_z(result->f, MPFR(x), MPZ(y), GET_MPFR_ROUND(context));
             goto done;
@@ -276,7 +276,7 @@ GMPy_Real_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
                 Py_DECREF((PyObject*)result);
                 return NULL;
             }
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div_q(result->f, MPFR(x), tempy->q, GET_MPFR_ROUND(context));
             Py_DECREF((PyObject*)tempy);
@@ -284,20 +284,20 @@ GMPy_Real_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
         }
 
         if (PyFloat_Check(y)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div_d(result->f, MPFR(x), PyFloat_AS_DOUBLE(y), GET_MPFR_ROUND(context));
             goto done;
         }
     }
 
-    if (MPFR_Check(y)) {
+    if (CHECK_MPFRANY(y)) {
         if (PyIntOrLong_Check(x)) {
             int error;
             long temp = GMPy_Integer_AsLongAndError(x, &error);
 
             if (!error) {
-                mpfr_clear_flags();
+                GMPY_MPFR_CLEAR_FLAGS(context);
 
                 result->rc = mpfr_si_div(result->f, temp, MPFR(y), GET_MPFR_ROUND(context));
                 goto done;
@@ -308,7 +308,7 @@ GMPy_Real_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
          * end by converting x to an mpfr. Ditto for rational.*/
 
         if (PyFloat_Check(x)) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_d_div(result->f, PyFloat_AS_DOUBLE(x), MPFR(y), GET_MPFR_ROUND(context));
             goto done;
@@ -326,7 +326,7 @@ GMPy_Real_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
             Py_DECREF((PyObject*)result);
             return NULL;
         }
-        mpfr_clear_flags();
+        GMPY_MPFR_CLEAR_FLAGS(context);
 
         result->rc = mpfr_div(result->f, tempx->f, tempy->f, GET_MPFR_ROUND(context));
         Py_DECREF((PyObject*)tempx);
@@ -345,14 +345,14 @@ GMPy_Real_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
 static PyObject *
 GMPy_MPFR_TrueDiv_Slot(PyObject *x, PyObject *y)
 {
-     if (MPFR_Check(x) && MPFR_Check(y)) {
+     if (CHECK_MPFRANY(x) && CHECK_MPFRANY(y)) {
         MPFR_Object *result;
         CTXT_Object *context = NULL;
 
         CHECK_CONTEXT(context);
 
         if ((result = GMPy_MPFR_New(0, context))) {
-            mpfr_clear_flags();
+            GMPY_MPFR_CLEAR_FLAGS(context);
 
             result->rc = mpfr_div(result->f, MPFR(x), MPFR(y), GET_MPFR_ROUND(context));
             _GMPy_MPFR_Cleanup(&result, context);
@@ -379,10 +379,10 @@ GMPy_Complex_TrueDiv(PyObject *x, PyObject *y, CTXT_Object *context)
     if (!(result = GMPy_MPC_New(0, 0, context)))
         return NULL;
 
-    if (MPC_Check(x) && MPC_Check(y)) {
+    if (CHECK_MPCANY(x) && CHECK_MPCANY(y)) {
 
         if (MPC_IS_ZERO_P(y)) {
-            context->ctx.divzero = 1;
+            GMPY_SET_FLAG(context, divzero);
             if (context->ctx.traps & TRAP_DIVZERO) {
                 GMPY_DIVZERO("'mpc' division by zero");
                 Py_DECREF((PyObject*)result);
@@ -453,11 +453,12 @@ PyDoc_STRVAR(GMPy_doc_context_truediv,
 "Return x / y; uses true division.");
 
 static PyObject *
-GMPy_Context_TrueDiv(PyObject *self, PyObject *args)
+GMPy_Context_TrueDiv(PyObject *self, GMPY_KWARGS_PARAMS)
 {
-    CTXT_Object *context = NULL;
+    CTXT_Object *context = NULL, *local, temp_context;
+    PyObject *result;
 
-    if (PyTuple_GET_SIZE(args) != 2) {
+    if (GMPY_KWARGS_NARGS != 2) {
         TYPE_ERROR("div() requires 2 arguments.");
         return NULL;
     }
@@ -469,7 +470,13 @@ GMPy_Context_TrueDiv(PyObject *self, PyObject *args)
         CHECK_CONTEXT(context);
     }
 
-    return GMPy_Number_TrueDiv(PyTuple_GET_ITEM(args, 0), PyTuple_GET_ITEM(args, 1),
-                               context);
+    if (!(local = GMPY_KWARGS_CONTEXT(context, &temp_context))) {
+        return NULL;
+    }
+
+    result = GMPy_Number_TrueDiv(GMPY_KWARGS_ARG(0), GMPY_KWARGS_ARG(1),
+                                 local);
+    GMPy_CTXT_Merge_Flags(context, local);
+    return result;
 }
 
@@ -49,7 +49,7 @@ static PyObject * GMPy_MPQ_TrueDiv_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPFR_TrueDiv_Slot(PyObject *x, PyObject *y);
 static PyObject * GMPy_MPC_TrueDiv_Slot(PyObject *x, PyObject *y);
 
-static PyObject * GMPy_Context_TrueDiv(PyObject *self, PyObject *args);
+static PyObject * GMPy_Context_TrueDiv(PyObject *self, GMPY_KWARGS_PARAMS);
 
 #ifdef __cplusplus
 }
@@ -89,6 +89,7 @@ typedef struct {
     mpfr_rnd_t imag_round;   /* current rounding mode for Im(MPC) */
     int allow_complex;       /* if 1, allow mpfr functions to return an mpc */
     int rational_division;   /* if 1, mpz/mpz returns an mpq result */
+    int track_flags;         /* if 0, do not update the exception flags */
 } gmpy_context;
 
 typedef struct {
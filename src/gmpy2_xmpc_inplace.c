@@ -0,0 +1,281 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpc_inplace.c                                                    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Provides inplace mutating operations for xmpc.
+ *
+ * The result is rounded to the precision of the real and imaginary parts of
+ * the xmpc instance using the rounding modes of the current context. The
+ * exponent range, subnormalize and trap settings of the current context are
+ * applied in the same way as for a new mpc.
+ */
+
+#define XMPC_OP_ADD 0
+#define XMPC_OP_SUB 1
+#define XMPC_OP_MUL 2
+#define XMPC_OP_DIV 3
+
+/* Finish an inplace operation. If a trap is raised, NULL is returned but
+ * the value of the xmpc has already been changed.
+ */
+
+static PyObject *
+_GMPy_XMPC_Finish(PyObject *self, int rc, CTXT_Object *context)
+{
+    MPC_Object *result = (MPC_Object*)self;
+
+    result->rc = rc;
+    Py_INCREF(self);
+    _GMPy_MPC_Cleanup(&result, context);
+    return (PyObject*)result;
+}
+
+/* Returns 1 if division by zero should raise an exception. */
+
+static int
+_GMPy_XMPC_DivZero(CTXT_Object *context)
+{
+    GMPY_SET_FLAG(context, divzero);
+    if (context->ctx.traps & TRAP_DIVZERO) {
+        GMPY_DIVZERO("'xmpc' division by zero");
+        return 1;
+    }
+    return 0;
+}
+
+/* Real operands use the mpc_FUNC_fr functions so a real value is never
+ * promoted to a temporary mpc. Operands that are not mpfr or mpc are
+ * converted exactly.
+ */
+
+static PyObject *
+_GMPy_XMPC_Inplace(PyObject *self, PyObject *other, int op)
+{
+    CTXT_Object *context = NULL;
+    MPFR_Object *tempf = NULL;
+    MPC_Object *tempc = NULL;
+    int rc = 0;
+
+    CHECK_CONTEXT(context);
+
+    if (IS_REAL(other)) {
+        if (CHECK_MPFRANY(other)) {
+            Py_INCREF(other);
+            tempf = (MPFR_Object*)other;
+        }
+        else if (!(tempf = GMPy_MPFR_From_Real(other, 1, context))) {
+            return NULL;
+        }
+
+        if (op == XMPC_OP_DIV && mpfr_zero_p(tempf->f) &&
+            _GMPy_XMPC_DivZero(context)) {
+            Py_DECREF((PyObject*)tempf);
+            return NULL;
+        }
+
+        switch (op) {
+            case XMPC_OP_ADD:
+                rc = mpc_add_fr(MPC(self), MPC(self), tempf->f, GET_MPC_ROUND(context));
+                break;
+            case XMPC_OP_SUB:
+                rc = mpc_sub_fr(MPC(self), MPC(self), tempf->f, GET_MPC_ROUND(context));
+                break;
+            case XMPC_OP_MUL:
+                rc = mpc_mul_fr(MPC(self), MPC(self), tempf->f, GET_MPC_ROUND(context));
+                break;
+            default:
+                rc = mpc_div_fr(MPC(self), MPC(self), tempf->f, GET_MPC_ROUND(context));
+                break;
+        }
+        Py_DECREF((PyObject*)tempf);
+        return _GMPy_XMPC_Finish(self, rc, context);
+    }
+
+    if (IS_COMPLEX(other)) {
+        if (CHECK_MPCANY(other)) {
+            Py_INCREF(other);
+            tempc = (MPC_Object*)other;
+        }
+        else if (!(tempc = GMPy_MPC_From_Complex(other, 1, 1, context))) {
+            return NULL;
+        }
+
+        if (op == XMPC_OP_DIV && MPC_IS_ZERO_P(tempc) &&
+            _GMPy_XMPC_DivZero(context)) {
+            Py_DECREF((PyObject*)tempc);
+            return NULL;
+        }
+
+        switch (op) {
+            case XMPC_OP_ADD:
+                rc = mpc_add(MPC(self), MPC(self), tempc->c, GET_MPC_ROUND(context));
+                break;
+            case XMPC_OP_SUB:
+                rc = mpc_sub(MPC(self), MPC(self), tempc->c, GET_MPC_ROUND(context));
+                break;
+            case XMPC_OP_MUL:
+                rc = mpc_mul(MPC(self), MPC(self), tempc->c, GET_MPC_ROUND(context));
+                break;
+            default:
+                rc = mpc_div(MPC(self), MPC(self), tempc->c, GET_MPC_ROUND(context));
+                break;
+        }
+        Py_DECREF((PyObject*)tempc);
+        return _GMPy_XMPC_Finish(self, rc, context);
+    }
+
+    Py_RETURN_NOTIMPLEMENTED;
+}
+
+static PyObject *
+GMPy_XMPC_IAdd_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_Inplace(self, other, XMPC_OP_ADD);
+}
+
+static PyObject *
+GMPy_XMPC_ISub_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_Inplace(self, other, XMPC_OP_SUB);
+}
+
+static PyObject *
+GMPy_XMPC_IMul_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_Inplace(self, other, XMPC_OP_MUL);
+}
+
+static PyObject *
+GMPy_XMPC_ITrueDiv_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPC_Inplace(self, other, XMPC_OP_DIV);
+}
+
+static PyObject *
+GMPy_XMPC_IPow_Slot(PyObject *self, PyObject *other, PyObject *mod)
+{
+    CTXT_Object *context = NULL;
+    MPFR_Object *tempf;
+    MPC_Object *tempc;
+    int rc;
+
+    if (mod != Py_None) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    CHECK_CONTEXT(context);
+
+    if (PyIntOrLong_Check(other)) {
+        int error;
+        long temp = GMPy_Integer_AsLongAndError(other, &error);
+
+        if (!error) {
+            rc = mpc_pow_si(MPC(self), MPC(self), temp, GET_MPC_ROUND(context));
+        }
+        else {
+            mpz_set_PyIntOrLong(global.tempz, other);
+            rc = mpc_pow_z(MPC(self), MPC(self), global.tempz, GET_MPC_ROUND(context));
+        }
+        return _GMPy_XMPC_Finish(self, rc, context);
+    }
+
+    if (CHECK_MPZANY(other)) {
+        rc = mpc_pow_z(MPC(self), MPC(self), MPZ(other), GET_MPC_ROUND(context));
+        return _GMPy_XMPC_Finish(self, rc, context);
+    }
+
+    if (IS_REAL(other)) {
+        if (!(tempf = GMPy_MPFR_From_Real(other, 1, context))) {
+            return NULL;
+        }
+        rc = mpc_pow_fr(MPC(self), MPC(self), tempf->f, GET_MPC_ROUND(context));
+        Py_DECREF((PyObject*)tempf);
+        return _GMPy_XMPC_Finish(self, rc, context);
+    }
+
+    if (IS_COMPLEX(other)) {
+        if (!(tempc = GMPy_MPC_From_Complex(other, 1, 1, context))) {
+            return NULL;
+        }
+        rc = mpc_pow(MPC(self), MPC(self), tempc->c, GET_MPC_ROUND(context));
+        Py_DECREF((PyObject*)tempc);
+        return _GMPy_XMPC_Finish(self, rc, context);
+    }
+
+    Py_RETURN_NOTIMPLEMENTED;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpc_method_fma_inplace,
+"x.fma_inplace(y, z) -> xmpc\n\n"
+"Replace x with (y * z) + x computed with a single rounding and return x.\n"
+"The result is rounded to the precision of x.");
+
+static PyObject *
+GMPy_XMPC_Method_FMA_Inplace(PyObject *self, PyObject *args)
+{
+    CTXT_Object *context = NULL;
+    MPC_Object *tempy = NULL, *tempz = NULL;
+    PyObject *y, *z;
+    int rc;
+
+    if (PyTuple_GET_SIZE(args) != 2) {
+        TYPE_ERROR("fma_inplace() requires 2 arguments");
+        return NULL;
+    }
+
+    y = PyTuple_GET_ITEM(args, 0);
+    z = PyTuple_GET_ITEM(args, 1);
+
+    if (!IS_COMPLEX(y) || !IS_COMPLEX(z)) {
+        TYPE_ERROR("fma_inplace() argument type not supported");
+        return NULL;
+    }
+
+    CHECK_CONTEXT(context);
+
+    if (CHECK_MPCANY(y)) {
+        Py_INCREF(y);
+        tempy = (MPC_Object*)y;
+    }
+    else if (!(tempy = GMPy_MPC_From_Complex(y, 1, 1, context))) {
+        return NULL;
+    }
+
+    if (CHECK_MPCANY(z)) {
+        Py_INCREF(z);
+        tempz = (MPC_Object*)z;
+    }
+    else if (!(tempz = GMPy_MPC_From_Complex(z, 1, 1, context))) {
+        Py_DECREF((PyObject*)tempy);
+        return NULL;
+    }
+
+    rc = mpc_fma(MPC(self), tempy->c, tempz->c, MPC(self), GET_MPC_ROUND(context));
+    Py_DECREF((PyObject*)tempy);
+    Py_DECREF((PyObject*)tempz);
+    return _GMPy_XMPC_Finish(self, rc, context);
+}
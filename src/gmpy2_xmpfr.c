@@ -0,0 +1,224 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpfr.c                                                           *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+PyDoc_STRVAR(GMPy_doc_xmpfr,
+"xmpfr() -> xmpfr(0.0)\n\n"
+"      If no argument is given, return xmpfr(0.0).\n\n"
+"xmpfr(n [, precision=0]) -> xmpfr\n\n"
+"      Return an 'xmpfr' object after converting a numeric value or a\n"
+"      string. The interpretation of precision is the same as for mpfr().\n\n"
+"Note: 'xmpfr' is a mutable floating-point number. Augmented assignment\n"
+"      (+=, -=, *=, /=, **=) and fma_inplace() store the result in the\n"
+"      existing object, rounded to its precision, instead of creating a\n"
+"      new object. All other operations return an 'mpfr'. 'xmpfr'\n"
+"      objects cannot be used as dictionary keys. The use of 'mpfr'\n"
+"      objects is recommended in most cases.");
+
+PyDoc_STRVAR(GMPy_doc_xmpfr_method_copy,
+"x.copy() -> xmpfr\n\n"
+"Return a copy of x.");
+
+static PyObject *
+GMPy_XMPFR_Method_Copy(PyObject *self, PyObject *other)
+{
+    XMPFR_Object *result;
+
+    if ((result = GMPy_XMPFR_New(mpfr_get_prec(MPFR(self)), NULL))) {
+        mpfr_set(result->f, MPFR(self), MPFR_RNDN);
+        result->rc = ((XMPFR_Object*)self)->rc;
+    }
+    return (PyObject*)result;
+}
+
+static PyObject *
+GMPy_XMPFR_Plus_Slot(PyObject *self)
+{
+    return (PyObject*)GMPy_MPFR_From_XMPFR((XMPFR_Object*)self, 0, NULL);
+}
+
+#ifdef PY3
+static PyNumberMethods GMPy_XMPFR_number_methods =
+{
+    (binaryfunc) GMPy_MPFR_Add_Slot,         /* nb_add                  */
+    (binaryfunc) GMPy_MPFR_Sub_Slot,         /* nb_subtract             */
+    (binaryfunc) GMPy_MPFR_Mul_Slot,         /* nb_multiply             */
+    (binaryfunc) GMPy_MPFR_Mod_Slot,         /* nb_remainder            */
+    (binaryfunc) GMPy_MPFR_DivMod_Slot,      /* nb_divmod               */
+    (ternaryfunc) GMPy_MPFR_Pow_Slot,        /* nb_power                */
+    (unaryfunc) GMPy_MPFR_Minus_Slot,        /* nb_negative             */
+    (unaryfunc) GMPy_XMPFR_Plus_Slot,        /* nb_positive             */
+    (unaryfunc) GMPy_MPFR_Abs_Slot,          /* nb_absolute             */
+    (inquiry) GMPy_MPFR_NonZero_Slot,        /* nb_bool                 */
+        0,                                   /* nb_invert               */
+        0,                                   /* nb_lshift               */
+        0,                                   /* nb_rshift               */
+        0,                                   /* nb_and                  */
+        0,                                   /* nb_xor                  */
+        0,                                   /* nb_or                   */
+    (unaryfunc) GMPy_MPFR_Int_Slot,          /* nb_int                  */
+        0,                                   /* nb_reserved             */
+    (unaryfunc) GMPy_MPFR_Float_Slot,        /* nb_float                */
+    (binaryfunc) GMPy_XMPFR_IAdd_Slot,       /* nb_inplace_add          */
+    (binaryfunc) GMPy_XMPFR_ISub_Slot,       /* nb_inplace_subtract     */
+    (binaryfunc) GMPy_XMPFR_IMul_Slot,       /* nb_inplace_multiply     */
+        0,                                   /* nb_inplace_remainder    */
+    (ternaryfunc) GMPy_XMPFR_IPow_Slot,      /* nb_inplace_power        */
+        0,                                   /* nb_inplace_lshift       */
+        0,                                   /* nb_inplace_rshift       */
+        0,                                   /* nb_inplace_and          */
+        0,                                   /* nb_inplace_xor          */
+        0,                                   /* nb_inplace_or           */
+    (binaryfunc) GMPy_MPFR_FloorDiv_Slot,    /* nb_floor_divide         */
+    (binaryfunc) GMPy_MPFR_TrueDiv_Slot,     /* nb_true_divide          */
+        0,                                   /* nb_inplace_floor_divide */
+    (binaryfunc) GMPy_XMPFR_ITrueDiv_Slot,   /* nb_inplace_true_divide  */
+        0,                                   /* nb_index                */
+};
+#else
+static PyNumberMethods GMPy_XMPFR_number_methods =
+{
+    (binaryfunc) GMPy_MPFR_Add_Slot,         /* nb_add                  */
+    (binaryfunc) GMPy_MPFR_Sub_Slot,         /* nb_subtract             */
+    (binaryfunc) GMPy_MPFR_Mul_Slot,         /* nb_multiply             */
+    (binaryfunc) GMPy_MPFR_TrueDiv_Slot,     /* nb_divide               */
+    (binaryfunc) GMPy_MPFR_Mod_Slot,         /* nb_remainder            */
+    (binaryfunc) GMPy_MPFR_DivMod_Slot,      /* nb_divmod               */
+    (ternaryfunc) GMPy_MPFR_Pow_Slot,        /* nb_power                */
+    (unaryfunc) GMPy_MPFR_Minus_Slot,        /* nb_negative             */
+    (unaryfunc) GMPy_XMPFR_Plus_Slot,        /* nb_positive             */
+    (unaryfunc) GMPy_MPFR_Abs_Slot,          /* nb_absolute             */
+    (inquiry) GMPy_MPFR_NonZero_Slot,        /* nb_bool                 */
+        0,                                   /* nb_invert               */
+        0,                                   /* nb_lshift               */
+        0,                                   /* nb_rshift               */
+        0,                                   /* nb_and                  */
+        0,                                   /* nb_xor                  */
+        0,                                   /* nb_or                   */
+        0,                                   /* nb_coerce               */
+    (unaryfunc) GMPy_MPFR_Int_Slot,          /* nb_int                  */
+    (unaryfunc) GMPy_MPFR_Long_Slot,         /* nb_long                 */
+    (unaryfunc) GMPy_MPFR_Float_Slot,        /* nb_float                */
+        0,                                   /* nb_oct                  */
+        0,                                   /* nb_hex                  */
+    (binaryfunc) GMPy_XMPFR_IAdd_Slot,       /* nb_inplace_add          */
+    (binaryfunc) GMPy_XMPFR_ISub_Slot,       /* nb_inplace_subtract     */
+    (binaryfunc) GMPy_XMPFR_IMul_Slot,       /* nb_inplace_multiply     */
+    (binaryfunc) GMPy_XMPFR_ITrueDiv_Slot,   /* nb_inplace_divide       */
+        0,                                   /* nb_inplace_remainder    */
+    (ternaryfunc) GMPy_XMPFR_IPow_Slot,      /* nb_inplace_power        */
+        0,                                   /* nb_inplace_lshift       */
+        0,                                   /* nb_inplace_rshift       */
+        0,                                   /* nb_inplace_and          */
+        0,                                   /* nb_inplace_xor          */
+        0,                                   /* nb_inplace_or           */
+    (binaryfunc) GMPy_MPFR_FloorDiv_Slot,    /* nb_floor_divide         */
+    (binaryfunc) GMPy_MPFR_TrueDiv_Slot,     /* nb_true_divide          */
+        0,                                   /* nb_inplace_floor_divide */
+    (binaryfunc) GMPy_XMPFR_ITrueDiv_Slot,   /* nb_inplace_true_divide  */
+};
+#endif
+
+static PyGetSetDef GMPy_XMPFR_getseters[] =
+{
+    {"precision", (getter)GMPy_MPFR_GetPrec_Attrib, NULL, "precision in bits", NULL},
+    {"rc", (getter)GMPy_MPFR_GetRc_Attrib, NULL, "return code", NULL},
+    {NULL}
+};
+
+static PyMethodDef GMPy_XMPFR_methods [] =
+{
+    { "__copy__", GMPy_XMPFR_Method_Copy, METH_NOARGS, GMPy_doc_xmpfr_method_copy },
+    { "__deepcopy__", GMPy_XMPFR_Method_Copy, METH_O, GMPy_doc_xmpfr_method_copy },
+    { "__format__", GMPy_MPFR_Format, METH_VARARGS, GMPy_doc_mpfr_format },
+    { "__reduce__", GMPy_MPANY_Method_Reduce, METH_NOARGS, GMPy_doc_method_reduce },
+    { "__sizeof__", GMPy_MPFR_SizeOf_Method, METH_NOARGS, GMPy_doc_mpfr_sizeof_method },
+    { "copy", GMPy_XMPFR_Method_Copy, METH_NOARGS, GMPy_doc_xmpfr_method_copy },
+    { "digits", GMPy_MPFR_Digits_Method, METH_VARARGS, GMPy_doc_mpfr_digits_method },
+    { "fma_inplace", GMPy_XMPFR_Method_FMA_Inplace, METH_VARARGS, GMPy_doc_xmpfr_method_fma_inplace },
+    { "is_finite", GMPy_MPFR_Is_Finite_Method, METH_NOARGS, GMPy_doc_method_is_finite },
+    { "is_infinite", GMPy_MPFR_Is_Infinite_Method, METH_NOARGS, GMPy_doc_method_is_infinite },
+    { "is_integer", GMPy_MPFR_Is_Integer_Method, METH_NOARGS, GMPy_doc_method_is_integer },
+    { "is_nan", GMPy_MPFR_Is_NAN_Method, METH_NOARGS, GMPy_doc_method_is_nan },
+    { "is_zero", GMPy_MPFR_Is_Zero_Method, METH_NOARGS, GMPy_doc_method_is_zero },
+    { NULL, NULL, 1 }
+};
+
+static PyTypeObject XMPFR_Type =
+{
+    /* PyObject_HEAD_INIT(&PyType_Type) */
+#ifdef PY3
+    PyVarObject_HEAD_INIT(NULL, 0)
+#else
+    PyObject_HEAD_INIT(0)
+    0,                                      /* ob_size          */
+#endif
+    "xmpfr",                                /* tp_name          */
+    sizeof(XMPFR_Object),                   /* tp_basicsize     */
+        0,                                  /* tp_itemsize      */
+    /* methods */
+    (destructor) GMPy_XMPFR_Dealloc,        /* tp_dealloc       */
+        0,                                  /* tp_print         */
+        0,                                  /* tp_getattr       */
+        0,                                  /* tp_setattr       */
+        0,                                  /* tp_reserved      */
+    (reprfunc) GMPy_MPFR_Repr_Slot,         /* tp_repr          */
+    &GMPy_XMPFR_number_methods,             /* tp_as_number     */
+        0,                                  /* tp_as_sequence   */
+        0,                                  /* tp_as_mapping    */
+        0,                                  /* tp_hash          */
+        0,                                  /* tp_call          */
+    (reprfunc) GMPy_MPFR_Str_Slot,          /* tp_str           */
+        0,                                  /* tp_getattro      */
+        0,                                  /* tp_setattro      */
+        0,                                  /* tp_as_buffer     */
+#ifdef PY3
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags         */
+#else
+    Py_TPFLAGS_HAVE_RICHCOMPARE|Py_TPFLAGS_CHECKTYPES| \
+    Py_TPFLAGS_HAVE_INPLACEOPS,
+#endif
+    GMPy_doc_xmpfr,                         /* tp_doc           */
+        0,                                  /* tp_traverse      */
+        0,                                  /* tp_clear         */
+    (richcmpfunc)&GMPy_RichCompare_Slot,    /* tp_richcompare   */
+        0,                                  /* tp_weaklistoffset*/
+        0,                                  /* tp_iter          */
+        0,                                  /* tp_iternext      */
+    GMPy_XMPFR_methods,                     /* tp_methods       */
+        0,                                  /* tp_members       */
+    GMPy_XMPFR_getseters,                   /* tp_getset        */
+        0,                                  /* tp_base          */
+        0,                                  /* tp_dict          */
+        0,                                  /* tp_descr_get     */
+        0,                                  /* tp_descr_set     */
+        0,                                  /* tp_dictoffset    */
+        0,                                  /* tp_init          */
+        0,                                  /* tp_alloc         */
+    GMPy_XMPFR_NewInit,                     /* tp_new           */
+        0,                                  /* tp_free          */
+};
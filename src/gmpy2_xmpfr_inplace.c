@@ -0,0 +1,222 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpfr_inplace.c                                                   *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Provides inplace mutating operations for xmpfr.
+ *
+ * The result is rounded to the precision of the xmpfr instance using the
+ * rounding mode of the current context. The exponent range, subnormalize
+ * and trap settings of the current context are applied to the result in
+ * the same way as for a new mpfr.
+ */
+
+/* Finish an inplace operation. The return code is saved and the context
+ * rules are applied. If a trap is raised, NULL is returned but the value
+ * of the xmpfr has already been changed.
+ */
+
+static PyObject *
+_GMPy_XMPFR_Finish(PyObject *self, int rc, CTXT_Object *context)
+{
+    MPFR_Object *result = (MPFR_Object*)self;
+
+    result->rc = rc;
+    Py_INCREF(self);
+    _GMPy_MPFR_Cleanup(&result, context);
+    return (PyObject*)result;
+}
+
+/* GMPY_XMPFR_INPLACE(NAME, FUNC) creates GMPy_XMPFR_INAME_Slot using the
+ * mpfr_FUNC family of functions. Real arguments without a dedicated mpfr
+ * function are converted to a temporary mpfr.
+ */
+
+#define GMPY_XMPFR_INPLACE(NAME, FUNC) \
+static PyObject * \
+GMPy_XMPFR_I##NAME##_Slot(PyObject *self, PyObject *other) \
+{ \
+    CTXT_Object *context = NULL; \
+    int rc; \
+    CHECK_CONTEXT(context); \
+    if (CHECK_MPFRANY(other)) { \
+        GMPY_MPFR_CLEAR_FLAGS(context); \
+        rc = mpfr_##FUNC(MPFR(self), MPFR(self), MPFR(other), GET_MPFR_ROUND(context)); \
+        return _GMPy_XMPFR_Finish(self, rc, context); \
+    } \
+    if (PyIntOrLong_Check(other)) { \
+        int error; \
+        long temp = GMPy_Integer_AsLongAndError(other, &error); \
+        GMPY_MPFR_CLEAR_FLAGS(context); \
+        if (!error) { \
+            rc = mpfr_##FUNC##_si(MPFR(self), MPFR(self), temp, GET_MPFR_ROUND(context)); \
+        } \
+        else { \
+            mpz_set_PyIntOrLong(global.tempz, other); \
+            rc = mpfr_##FUNC##_z(MPFR(self), MPFR(self), global.tempz, GET_MPFR_ROUND(context)); \
+        } \
+        return _GMPy_XMPFR_Finish(self, rc, context); \
+    } \
+    if (CHECK_MPZANY(other)) { \
+        GMPY_MPFR_CLEAR_FLAGS(context); \
+        rc = mpfr_##FUNC##_z(MPFR(self), MPFR(self), MPZ(other), GET_MPFR_ROUND(context)); \
+        return _GMPy_XMPFR_Finish(self, rc, context); \
+    } \
+    if (IS_RATIONAL(other)) { \
+        MPQ_Object *tempq; \
+        if (!(tempq = GMPy_MPQ_From_Number(other, context))) { \
+            return NULL; \
+        } \
+        GMPY_MPFR_CLEAR_FLAGS(context); \
+        rc = mpfr_##FUNC##_q(MPFR(self), MPFR(self), tempq->q, GET_MPFR_ROUND(context)); \
+        Py_DECREF((PyObject*)tempq); \
+        return _GMPy_XMPFR_Finish(self, rc, context); \
+    } \
+    if (PyFloat_Check(other)) { \
+        GMPY_MPFR_CLEAR_FLAGS(context); \
+        rc = mpfr_##FUNC##_d(MPFR(self), MPFR(self), PyFloat_AS_DOUBLE(other), GET_MPFR_ROUND(context)); \
+        return _GMPy_XMPFR_Finish(self, rc, context); \
+    } \
+    Py_RETURN_NOTIMPLEMENTED; \
+}
+
+GMPY_XMPFR_INPLACE(Add, add)
+GMPY_XMPFR_INPLACE(Sub, sub)
+GMPY_XMPFR_INPLACE(Mul, mul)
+GMPY_XMPFR_INPLACE(TrueDiv, div)
+
+/* Inplace xmpfr power. A result that would require a complex number is
+ * returned as NaN.
+ */
+
+static PyObject *
+GMPy_XMPFR_IPow_Slot(PyObject *self, PyObject *other, PyObject *mod)
+{
+    CTXT_Object *context = NULL;
+    MPFR_Object *tempf;
+    int rc;
+
+    if (mod != Py_None) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    CHECK_CONTEXT(context);
+
+    if (CHECK_MPFRANY(other)) {
+        GMPY_MPFR_CLEAR_FLAGS(context);
+        rc = mpfr_pow(MPFR(self), MPFR(self), MPFR(other), GET_MPFR_ROUND(context));
+        return _GMPy_XMPFR_Finish(self, rc, context);
+    }
+
+    if (PyIntOrLong_Check(other)) {
+        int error;
+        long temp = GMPy_Integer_AsLongAndError(other, &error);
+
+        GMPY_MPFR_CLEAR_FLAGS(context);
+        if (!error) {
+            rc = mpfr_pow_si(MPFR(self), MPFR(self), temp, GET_MPFR_ROUND(context));
+        }
+        else {
+            mpz_set_PyIntOrLong(global.tempz, other);
+            rc = mpfr_pow_z(MPFR(self), MPFR(self), global.tempz, GET_MPFR_ROUND(context));
+        }
+        return _GMPy_XMPFR_Finish(self, rc, context);
+    }
+
+    if (CHECK_MPZANY(other)) {
+        GMPY_MPFR_CLEAR_FLAGS(context);
+        rc = mpfr_pow_z(MPFR(self), MPFR(self), MPZ(other), GET_MPFR_ROUND(context));
+        return _GMPy_XMPFR_Finish(self, rc, context);
+    }
+
+    if (IS_REAL(other)) {
+        if (!(tempf = GMPy_MPFR_From_Real(other, 1, context))) {
+            return NULL;
+        }
+        GMPY_MPFR_CLEAR_FLAGS(context);
+        rc = mpfr_pow(MPFR(self), MPFR(self), tempf->f, GET_MPFR_ROUND(context));
+        Py_DECREF((PyObject*)tempf);
+        return _GMPy_XMPFR_Finish(self, rc, context);
+    }
+
+    Py_RETURN_NOTIMPLEMENTED;
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpfr_method_fma_inplace,
+"x.fma_inplace(y, z) -> xmpfr\n\n"
+"Replace x with (y * z) + x computed with a single rounding and return x.\n"
+"The result is rounded to the precision of x.");
+
+static PyObject *
+GMPy_XMPFR_Method_FMA_Inplace(PyObject *self, PyObject *args)
+{
+    CTXT_Object *context = NULL;
+    MPFR_Object *tempy = NULL, *tempz = NULL;
+    PyObject *y, *z;
+    int rc;
+
+    if (PyTuple_GET_SIZE(args) != 2) {
+        TYPE_ERROR("fma_inplace() requires 2 arguments");
+        return NULL;
+    }
+
+    y = PyTuple_GET_ITEM(args, 0);
+    z = PyTuple_GET_ITEM(args, 1);
+
+    if (!IS_REAL(y) || !IS_REAL(z)) {
+        TYPE_ERROR("fma_inplace() argument type not supported");
+        return NULL;
+    }
+
+    CHECK_CONTEXT(context);
+
+    /* mpfr and xmpfr arguments are used directly; other arguments are
+     * converted exactly.
+     */
+
+    if (CHECK_MPFRANY(y)) {
+        Py_INCREF(y);
+        tempy = (MPFR_Object*)y;
+    }
+    else if (!(tempy = GMPy_MPFR_From_Real(y, 1, context))) {
+        return NULL;
+    }
+
+    if (CHECK_MPFRANY(z)) {
+        Py_INCREF(z);
+        tempz = (MPFR_Object*)z;
+    }
+    else if (!(tempz = GMPy_MPFR_From_Real(z, 1, context))) {
+        Py_DECREF((PyObject*)tempy);
+        return NULL;
+    }
+
+    GMPY_MPFR_CLEAR_FLAGS(context);
+    rc = mpfr_fma(MPFR(self), tempy->f, tempz->f, MPFR(self), GET_MPFR_ROUND(context));
+    Py_DECREF((PyObject*)tempy);
+    Py_DECREF((PyObject*)tempz);
+    return _GMPy_XMPFR_Finish(self, rc, context);
+}
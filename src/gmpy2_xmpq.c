@@ -0,0 +1,336 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpq.c                                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+PyDoc_STRVAR(GMPy_doc_xmpq,
+"xmpq() -> xmpq(0,1)\n\n"
+"     If no argument is given, return xmpq(0,1).\n\n"
+"xmpq(n[, lazy=False[, limit=4096]]) -> xmpq\n"
+"xmpq(n, m[, lazy=False[, limit=4096]]) -> xmpq\n"
+"xmpq(s[, base=10[, lazy=False[, limit=4096]]]) -> xmpq\n\n"
+"     Return an 'xmpq' object. The positional arguments are interpreted\n"
+"     in the same way as for mpq().\n\n"
+"     Note: 'xmpq' is a mutable rational. Augmented assignment (+=, -=,\n"
+"     *=, /=, and **= with an integer exponent) modifies the existing\n"
+"     object. All other operations return an 'mpq'. If lazy is True, the\n"
+"     common factors of the numerator and denominator are not removed\n"
+"     after each operation. The value is canonicalized when it is read,\n"
+"     compared, or converted, or when the numerator or denominator\n"
+"     exceeds limit bits. 'xmpq' objects cannot be used as dictionary\n"
+"     keys. The use of 'mpq' objects is recommended in most cases.");
+
+static PyObject *
+GMPy_XMPQ_Str_Slot(PyObject *self)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_PyStr_From_MPQ((MPQ_Object*)self, 10, 0, NULL);
+}
+
+static PyObject *
+GMPy_XMPQ_Repr_Slot(PyObject *self)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_PyStr_From_MPQ((MPQ_Object*)self, 10, 1, NULL);
+}
+
+static PyObject *
+GMPy_XMPQ_Attrib_GetNumer(PyObject *self, void *closure)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_MPQ_Attrib_GetNumer((MPQ_Object*)self, closure);
+}
+
+static PyObject *
+GMPy_XMPQ_Attrib_GetDenom(PyObject *self, void *closure)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_MPQ_Attrib_GetDenom((MPQ_Object*)self, closure);
+}
+
+static PyObject *
+GMPy_XMPQ_Attrib_GetLazy(XMPQ_Object *self, void *closure)
+{
+    return PyBool_FromLong(self->lazy);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpq_method_copy,
+"x.copy() -> xmpq\n\n"
+"Return a copy of x.");
+
+static PyObject *
+GMPy_XMPQ_Method_Copy(PyObject *self, PyObject *other)
+{
+    XMPQ_Object *result;
+
+    if ((result = GMPy_XMPQ_New(NULL))) {
+        mpq_set(result->q, MPQ(self));
+        result->lazy = ((XMPQ_Object*)self)->lazy;
+        result->canonical = ((XMPQ_Object*)self)->canonical;
+        result->limit = ((XMPQ_Object*)self)->limit;
+    }
+    return (PyObject*)result;
+}
+
+/* The rounding and digits methods of mpq only read the value, so they are
+ * shared after the value is put in canonical form.
+ */
+
+static PyObject *
+GMPy_XMPQ_Method_Ceil(PyObject *self, PyObject *other)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_MPQ_Method_Ceil(self, other);
+}
+
+static PyObject *
+GMPy_XMPQ_Method_Floor(PyObject *self, PyObject *other)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_MPQ_Method_Floor(self, other);
+}
+
+static PyObject *
+GMPy_XMPQ_Method_Round(PyObject *self, PyObject *args)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_MPQ_Method_Round(self, args);
+}
+
+static PyObject *
+GMPy_XMPQ_Method_Trunc(PyObject *self, PyObject *other)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_MPQ_Method_Trunc(self, other);
+}
+
+static PyObject *
+GMPy_XMPQ_Digits_Method(PyObject *self, PyObject *args)
+{
+    GMPy_XMPQ_Canonicalize(self);
+    return GMPy_MPQ_Digits_Method(self, args);
+}
+
+PyDoc_STRVAR(GMPy_doc_xmpq_method_setstate,
+"x.__setstate__(state)\n\n"
+"Restore the 'lazy' and 'limit' settings saved by x.__reduce__().");
+
+static PyObject *
+GMPy_XMPQ_Method_SetState(PyObject *self, PyObject *other)
+{
+    int lazy;
+    unsigned long limit;
+
+    if (!PyTuple_Check(other) ||
+        !PyArg_ParseTuple(other, "ik", &lazy, &limit)) {
+        PyErr_Clear();
+        TYPE_ERROR("xmpq.__setstate__() requires a (lazy, limit) tuple");
+        return NULL;
+    }
+    if (limit < 1) {
+        VALUE_ERROR("limit for xmpq() must be > 0");
+        return NULL;
+    }
+    ((XMPQ_Object*)self)->lazy = (lazy != 0);
+    ((XMPQ_Object*)self)->limit = (mp_bitcnt_t)limit;
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+GMPy_XMPQ_Plus_Slot(PyObject *self)
+{
+    return (PyObject*)GMPy_MPQ_From_XMPQ((XMPQ_Object*)self, NULL);
+}
+
+static PyObject *
+GMPy_XMPQ_Minus_Slot(PyObject *self)
+{
+    MPQ_Object *result;
+
+    if ((result = GMPy_MPQ_From_XMPQ((XMPQ_Object*)self, NULL)))
+        mpq_neg(result->q, result->q);
+    return (PyObject*)result;
+}
+
+#ifdef PY3
+static PyNumberMethods GMPy_XMPQ_number_methods =
+{
+    (binaryfunc) GMPy_MPQ_Add_Slot,         /* nb_add                  */
+    (binaryfunc) GMPy_MPQ_Sub_Slot,         /* nb_subtract             */
+    (binaryfunc) GMPy_MPQ_Mul_Slot,         /* nb_multiply             */
+    (binaryfunc) GMPy_MPQ_Mod_Slot,         /* nb_remainder            */
+    (binaryfunc) GMPy_MPQ_DivMod_Slot,      /* nb_divmod               */
+    (ternaryfunc) GMPy_MPANY_Pow_Slot,      /* nb_power                */
+    (unaryfunc) GMPy_XMPQ_Minus_Slot,       /* nb_negative             */
+    (unaryfunc) GMPy_XMPQ_Plus_Slot,        /* nb_positive             */
+    (unaryfunc) GMPy_MPQ_Abs_Slot,          /* nb_absolute             */
+    (inquiry) GMPy_MPQ_NonZero_Slot,        /* nb_bool                 */
+        0,                                  /* nb_invert               */
+        0,                                  /* nb_lshift               */
+        0,                                  /* nb_rshift               */
+        0,                                  /* nb_and                  */
+        0,                                  /* nb_xor                  */
+        0,                                  /* nb_or                   */
+    (unaryfunc) GMPy_MPQ_Int_Slot,          /* nb_int                  */
+        0,                                  /* nb_reserved             */
+    (unaryfunc) GMPy_MPQ_Float_Slot,        /* nb_float                */
+    (binaryfunc) GMPy_XMPQ_IAdd_Slot,       /* nb_inplace_add          */
+    (binaryfunc) GMPy_XMPQ_ISub_Slot,       /* nb_inplace_subtract     */
+    (binaryfunc) GMPy_XMPQ_IMul_Slot,       /* nb_inplace_multiply     */
+        0,                                  /* nb_inplace_remainder    */
+    (ternaryfunc) GMPy_XMPQ_IPow_Slot,      /* nb_inplace_power        */
+        0,                                  /* nb_inplace_lshift       */
+        0,                                  /* nb_inplace_rshift       */
+        0,                                  /* nb_inplace_and          */
+        0,                                  /* nb_inplace_xor          */
+        0,                                  /* nb_inplace_or           */
+    (binaryfunc) GMPy_MPQ_FloorDiv_Slot,    /* nb_floor_divide         */
+    (binaryfunc) GMPy_MPQ_TrueDiv_Slot,     /* nb_true_divide          */
+        0,                                  /* nb_inplace_floor_divide */
+    (binaryfunc) GMPy_XMPQ_ITrueDiv_Slot,   /* nb_inplace_true_divide  */
+        0,                                  /* nb_index                */
+};
+#else
+static PyNumberMethods GMPy_XMPQ_number_methods =
+{
+    (binaryfunc) GMPy_MPQ_Add_Slot,         /* nb_add                  */
+    (binaryfunc) GMPy_MPQ_Sub_Slot,         /* nb_subtract             */
+    (binaryfunc) GMPy_MPQ_Mul_Slot,         /* nb_multiply             */
+    (binaryfunc) GMPy_MPQ_TrueDiv_Slot,     /* nb_divide               */
+    (binaryfunc) GMPy_MPQ_Mod_Slot,         /* nb_remainder            */
+    (binaryfunc) GMPy_MPQ_DivMod_Slot,      /* nb_divmod               */
+    (ternaryfunc) GMPy_MPANY_Pow_Slot,      /* nb_power                */
+    (unaryfunc) GMPy_XMPQ_Minus_Slot,       /* nb_negative             */
+    (unaryfunc) GMPy_XMPQ_Plus_Slot,        /* nb_positive             */
+    (unaryfunc) GMPy_MPQ_Abs_Slot,          /* nb_absolute             */
+    (inquiry) GMPy_MPQ_NonZero_Slot,        /* nb_bool                 */
+        0,                                  /* nb_invert               */
+        0,                                  /* nb_lshift               */
+        0,                                  /* nb_rshift               */
+        0,                                  /* nb_and                  */
+        0,                                  /* nb_xor                  */
+        0,                                  /* nb_or                   */
+        0,                                  /* nb_coerce               */
+    (unaryfunc) GMPy_MPQ_Int_Slot,          /* nb_int                  */
+    (unaryfunc) GMPy_MPQ_Long_Slot,         /* nb_long                 */
+    (unaryfunc) GMPy_MPQ_Float_Slot,        /* nb_float                */
+        0,                                  /* nb_oct                  */
+        0,                                  /* nb_hex                  */
+    (binaryfunc) GMPy_XMPQ_IAdd_Slot,       /* nb_inplace_add          */
+    (binaryfunc) GMPy_XMPQ_ISub_Slot,       /* nb_inplace_subtract     */
+    (binaryfunc) GMPy_XMPQ_IMul_Slot,       /* nb_inplace_multiply     */
+    (binaryfunc) GMPy_XMPQ_ITrueDiv_Slot,   /* nb_inplace_divide       */
+        0,                                  /* nb_inplace_remainder    */
+    (ternaryfunc) GMPy_XMPQ_IPow_Slot,      /* nb_inplace_power        */
+        0,                                  /* nb_inplace_lshift       */
+        0,                                  /* nb_inplace_rshift       */
+        0,                                  /* nb_inplace_and          */
+        0,                                  /* nb_inplace_xor          */
+        0,                                  /* nb_inplace_or           */
+    (binaryfunc) GMPy_MPQ_FloorDiv_Slot,    /* nb_floor_divide         */
+    (binaryfunc) GMPy_MPQ_TrueDiv_Slot,     /* nb_true_divide          */
+        0,                                  /* nb_inplace_floor_divide */
+    (binaryfunc) GMPy_XMPQ_ITrueDiv_Slot,   /* nb_inplace_true_divide  */
+};
+#endif
+
+static PyGetSetDef GMPy_XMPQ_getseters[] =
+{
+    { "numerator", (getter)GMPy_XMPQ_Attrib_GetNumer, NULL, "numerator", NULL },
+    { "denominator", (getter)GMPy_XMPQ_Attrib_GetDenom, NULL, "denominator", NULL },
+    { "lazy", (getter)GMPy_XMPQ_Attrib_GetLazy, NULL, "canonicalization is deferred", NULL },
+    {NULL}
+};
+
+static PyMethodDef GMPy_XMPQ_methods [] =
+{
+    { "__ceil__", GMPy_XMPQ_Method_Ceil, METH_NOARGS, GMPy_doc_mpq_method_ceil },
+    { "__copy__", GMPy_XMPQ_Method_Copy, METH_NOARGS, GMPy_doc_xmpq_method_copy },
+    { "__deepcopy__", GMPy_XMPQ_Method_Copy, METH_O, GMPy_doc_xmpq_method_copy },
+    { "__floor__", GMPy_XMPQ_Method_Floor, METH_NOARGS, GMPy_doc_mpq_method_floor },
+    { "__reduce__", GMPy_MPANY_Method_Reduce, METH_NOARGS, GMPy_doc_method_reduce },
+    { "__round__", GMPy_XMPQ_Method_Round, METH_VARARGS, GMPy_doc_mpq_method_round },
+    { "__setstate__", GMPy_XMPQ_Method_SetState, METH_O, GMPy_doc_xmpq_method_setstate },
+    { "__trunc__", GMPy_XMPQ_Method_Trunc, METH_NOARGS, GMPy_doc_mpq_method_trunc },
+    { "copy", GMPy_XMPQ_Method_Copy, METH_NOARGS, GMPy_doc_xmpq_method_copy },
+    { "digits", GMPy_XMPQ_Digits_Method, METH_VARARGS, GMPy_doc_mpq_digits_method },
+    { NULL, NULL, 1 }
+};
+
+static PyTypeObject XMPQ_Type =
+{
+    /* PyObject_HEAD_INIT(&PyType_Type) */
+#ifdef PY3
+    PyVarObject_HEAD_INIT(NULL, 0)
+#else
+    PyObject_HEAD_INIT(0)
+        0,                                  /* ob_size          */
+#endif
+    "xmpq",                                 /* tp_name          */
+    sizeof(XMPQ_Object),                    /* tp_basicsize     */
+        0,                                  /* tp_itemsize      */
+    /* methods */
+    (destructor) GMPy_XMPQ_Dealloc,         /* tp_dealloc       */
+        0,                                  /* tp_print         */
+        0,                                  /* tp_getattr       */
+        0,                                  /* tp_setattr       */
+        0,                                  /* tp_reserved      */
+    (reprfunc) GMPy_XMPQ_Repr_Slot,         /* tp_repr          */
+    &GMPy_XMPQ_number_methods,              /* tp_as_number     */
+        0,                                  /* tp_as_sequence   */
+        0,                                  /* tp_as_mapping    */
+        0,                                  /* tp_hash          */
+        0,                                  /* tp_call          */
+    (reprfunc) GMPy_XMPQ_Str_Slot,          /* tp_str           */
+        0,                                  /* tp_getattro      */
+        0,                                  /* tp_setattro      */
+        0,                                  /* tp_as_buffer     */
+#ifdef PY3
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags         */
+#else
+    Py_TPFLAGS_HAVE_RICHCOMPARE|Py_TPFLAGS_CHECKTYPES| \
+    Py_TPFLAGS_HAVE_INPLACEOPS,
+#endif
+    GMPy_doc_xmpq,                          /* tp_doc           */
+        0,                                  /* tp_traverse      */
+        0,                                  /* tp_clear         */
+    (richcmpfunc)&GMPy_RichCompare_Slot,    /* tp_richcompare   */
+        0,                                  /* tp_weaklistoffset*/
+        0,                                  /* tp_iter          */
+        0,                                  /* tp_iternext      */
+    GMPy_XMPQ_methods,                      /* tp_methods       */
+        0,                                  /* tp_members       */
+    GMPy_XMPQ_getseters,                    /* tp_getset        */
+        0,                                  /* tp_base          */
+        0,                                  /* tp_dict          */
+        0,                                  /* tp_descr_get     */
+        0,                                  /* tp_descr_set     */
+        0,                                  /* tp_dictoffset    */
+        0,                                  /* tp_init          */
+        0,                                  /* tp_alloc         */
+    GMPy_XMPQ_NewInit,                      /* tp_new           */
+        0,                                  /* tp_free          */
+};
@@ -0,0 +1,268 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy2_xmpq_inplace.c                                                    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Provides inplace mutating operations for xmpq.
+ *
+ * If lazy is false, the value is always kept in canonical form. If lazy is
+ * true, addition, subtraction, multiplication, and division only combine
+ * the numerators and denominators and the gcd is not computed until the
+ * value is read or the numerator or denominator grows beyond limit bits.
+ * The denominator is always kept positive.
+ */
+
+static void
+GMPy_XMPQ_Canonicalize(PyObject *self)
+{
+    XMPQ_Object *x = (XMPQ_Object*)self;
+
+    if (!x->canonical) {
+        mpq_canonicalize(x->q);
+        x->canonical = 1;
+    }
+}
+
+#define XMPQ_OP_ADD 0
+#define XMPQ_OP_SUB 1
+#define XMPQ_OP_MUL 2
+#define XMPQ_OP_DIV 3
+
+static PyObject *
+_GMPy_XMPQ_Inplace(PyObject *self, PyObject *other, int op)
+{
+    XMPQ_Object *x = (XMPQ_Object*)self;
+    MPQ_Object *tempq = NULL;
+    CTXT_Object *context = NULL;
+    mpz_ptr num = mpq_numref(x->q), den = mpq_denref(x->q);
+    mpz_ptr n = NULL;
+    mpq_ptr q = NULL;
+    long si = 0;
+    int error = 1;
+
+    if (PyIntOrLong_Check(other)) {
+        si = GMPy_Integer_AsLongAndError(other, &error);
+    }
+
+    if (!error) {
+        if (si == 0 && op == XMPQ_OP_DIV) {
+            ZERO_ERROR("xmpq division by zero");
+            return NULL;
+        }
+        if (op == XMPQ_OP_ADD || op == XMPQ_OP_SUB) {
+            /* (a + c*b)/b keeps the canonical state of a/b. */
+            if ((si >= 0) == (op == XMPQ_OP_ADD)) {
+                mpz_addmul_ui(num, den, si >= 0 ? (unsigned long)si : -(unsigned long)si);
+            }
+            else {
+                mpz_submul_ui(num, den, si >= 0 ? (unsigned long)si : -(unsigned long)si);
+            }
+            goto done;
+        }
+        mpz_set_si(global.tempz, si);
+        n = global.tempz;
+    }
+    else if (CHECK_MPZANY(other)) {
+        n = MPZ(other);
+    }
+    else if (MPQ_Check(other)) {
+        q = MPQ(other);
+    }
+    else if (XMPQ_Check(other) && other != self) {
+        GMPy_XMPQ_Canonicalize(other);
+        q = MPQ(other);
+    }
+    else if (IS_RATIONAL(other)) {
+        if (!(tempq = GMPy_MPQ_From_Number(other, context))) {
+            return NULL;
+        }
+        q = tempq->q;
+    }
+    else {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    if (q && mpz_cmp_ui(mpq_denref(q), 1) == 0) {
+        n = mpq_numref(q);
+        q = NULL;
+    }
+
+    if (op == XMPQ_OP_DIV && ((n && mpz_sgn(n) == 0) || (q && mpq_sgn(q) == 0))) {
+        ZERO_ERROR("xmpq division by zero");
+        Py_XDECREF((PyObject*)tempq);
+        return NULL;
+    }
+
+    if (n) {
+        switch (op) {
+        case XMPQ_OP_ADD:
+            mpz_addmul(num, den, n);
+            break;
+        case XMPQ_OP_SUB:
+            mpz_submul(num, den, n);
+            break;
+        case XMPQ_OP_MUL:
+            mpz_mul(num, num, n);
+            x->canonical = 0;
+            break;
+        default:
+            mpz_mul(den, den, n);
+            if (mpz_sgn(den) < 0) {
+                mpz_neg(num, num);
+                mpz_neg(den, den);
+            }
+            x->canonical = 0;
+            break;
+        }
+    }
+    else if (!x->lazy) {
+        switch (op) {
+        case XMPQ_OP_ADD:
+            mpq_add(x->q, x->q, q);
+            break;
+        case XMPQ_OP_SUB:
+            mpq_sub(x->q, x->q, q);
+            break;
+        case XMPQ_OP_MUL:
+            mpq_mul(x->q, x->q, q);
+            break;
+        default:
+            mpq_div(x->q, x->q, q);
+            break;
+        }
+    }
+    else {
+        switch (op) {
+        case XMPQ_OP_ADD:
+        case XMPQ_OP_SUB:
+            mpz_mul(num, num, mpq_denref(q));
+            if (op == XMPQ_OP_ADD)
+                mpz_addmul(num, den, mpq_numref(q));
+            else
+                mpz_submul(num, den, mpq_numref(q));
+            mpz_mul(den, den, mpq_denref(q));
+            break;
+        case XMPQ_OP_MUL:
+            mpz_mul(num, num, mpq_numref(q));
+            mpz_mul(den, den, mpq_denref(q));
+            break;
+        default:
+            mpz_mul(num, num, mpq_denref(q));
+            mpz_mul(den, den, mpq_numref(q));
+            if (mpz_sgn(den) < 0) {
+                mpz_neg(num, num);
+                mpz_neg(den, den);
+            }
+            break;
+        }
+        x->canonical = 0;
+    }
+    Py_XDECREF((PyObject*)tempq);
+
+  done:
+    if (!x->canonical &&
+        (!x->lazy ||
+         mpz_sizeinbase(num, 2) > x->limit ||
+         mpz_sizeinbase(den, 2) > x->limit)) {
+        GMPy_XMPQ_Canonicalize(self);
+    }
+    Py_INCREF(self);
+    return self;
+}
+
+static PyObject *
+GMPy_XMPQ_IAdd_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_Inplace(self, other, XMPQ_OP_ADD);
+}
+
+static PyObject *
+GMPy_XMPQ_ISub_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_Inplace(self, other, XMPQ_OP_SUB);
+}
+
+static PyObject *
+GMPy_XMPQ_IMul_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_Inplace(self, other, XMPQ_OP_MUL);
+}
+
+static PyObject *
+GMPy_XMPQ_ITrueDiv_Slot(PyObject *self, PyObject *other)
+{
+    return _GMPy_XMPQ_Inplace(self, other, XMPQ_OP_DIV);
+}
+
+/* Inplace xmpq power. Only integer exponents are supported; other exponents
+ * fall back to the regular power operation.
+ */
+
+static PyObject *
+GMPy_XMPQ_IPow_Slot(PyObject *self, PyObject *other, PyObject *mod)
+{
+    XMPQ_Object *x = (XMPQ_Object*)self;
+    mpz_ptr num = mpq_numref(x->q), den = mpq_denref(x->q);
+    unsigned long e;
+    long temp;
+    int error;
+
+    if (mod != Py_None || !IS_INTEGER(other)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+
+    temp = GMPy_Integer_AsLongAndError(other, &error);
+    if (error) {
+        VALUE_ERROR("xmpq exponent is too large");
+        return NULL;
+    }
+
+    /* Reduce first: the power of a canonical value is canonical, and the
+     * reduced operands are never larger than the lazy ones. */
+
+    GMPy_XMPQ_Canonicalize(self);
+
+    if (temp < 0) {
+        if (mpz_sgn(num) == 0) {
+            ZERO_ERROR("xmpq division by zero");
+            return NULL;
+        }
+        mpz_swap(num, den);
+        if (mpz_sgn(den) < 0) {
+            mpz_neg(num, num);
+            mpz_neg(den, den);
+        }
+        e = -(unsigned long)temp;
+    }
+    else {
+        e = (unsigned long)temp;
+    }
+
+    mpz_pow_ui(num, num, e);
+    mpz_pow_ui(den, den, e);
+    Py_INCREF(self);
+    return self;
+}
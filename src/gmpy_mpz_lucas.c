@@ -1,643 +1,375 @@
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
- * gmpy_mpz_lucas.c                                                        *
- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
- * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
- * libraries.                                                              *
- *                                                                         *
- * Copyright 2011 David Cleaver                                            *
- *                                                                         *
- * Copyright 2012, 2013, 2014, 2015, 2016, 2017, 2018 Case Van Horsen      *
- *                                                                         *
- * The original file is available at:                                      *
- *   <http://sourceforge.net/projects/mpzlucas/files/>                     *
- *                                                                         *
- * Modified by Case Van Horsen for inclusion into GMPY2.                   *
- *                                                                         *
- * This file is part of GMPY2.                                             *
- *                                                                         *
- * GMPY2 is free software: you can redistribute it and/or modify it under  *
- * the terms of the GNU Lesser General Public License as published by the  *
- * Free Software Foundation, either version 3 of the License, or (at your  *
- * option) any later version.                                              *
- *                                                                         *
- * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
- * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
- * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
- * License for more details.                                               *
- *                                                                         *
- * You should have received a copy of the GNU Lesser General Public        *
- * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
- * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-
-PyDoc_STRVAR(doc_mpz_lucasu,
-"lucasu(p,q,k) -> mpz\n\n"
-"Return the k-th element of the Lucas U sequence defined by p,q.\n"
-"p*p - 4*q must not equal 0; k must be greater than or equal to 0.");
-
-static PyObject *
-GMPY_mpz_lucasu(PyObject *self, PyObject *args)
-{
-    /* Adaptation of algorithm found in http://joye.site88.net/papers/JQ96lucas.pdf
-     * calculate u[k] of Lucas U sequence for p,q.
-     * Note: p^2-4q=0 is not tested, not a proper Lucas sequence!!
-     */
-
-    MPZ_Object *result = 0, *p, *q, *k;
-    size_t s = 0, j = 0;
-    mpz_t uh, vl, vh, ql, qh, tmp;
-
-    if (PyTuple_Size(args) != 3) {
-        TYPE_ERROR("lucasu() requires 3 integer arguments");
-        return NULL;
-    }
-
-    mpz_init(uh);
-    mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
-
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    k = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
-    if (!p || !q || !k) {
-        TYPE_ERROR("lucasu() requires 3 integer arguments");
-        goto cleanup;
-    }
-
-    /* Check if p*p - 4*q == 0. */
-
-    mpz_mul(tmp, p->z, p->z);
-    mpz_mul_ui(qh, q->z, 4);
-    mpz_sub(tmp, tmp, qh);
-    if (mpz_sgn(tmp) == 0) {
-        VALUE_ERROR("invalid values for p,q in lucasu()");
-        goto cleanup;
-    }
-
-    /* Check if k < 0. */
-
-    if (mpz_sgn(k->z) < 0) {
-        VALUE_ERROR("invalid value for k in lucasu()");
-        goto cleanup;
-    }
-
-    mpz_set_si(uh, 1);
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp, 0);
-
-    s = mpz_scan1(k->z, 0);
-    for (j = mpz_sizeinbase(k->z,2)-1; j >= s+1; j--) {
-        /* ql = ql*qh */
-        mpz_mul(ql, ql, qh);
-        if (mpz_tstbit(k->z,j) == 1) {
-            /* qh = ql*q */
-            mpz_mul(qh, ql, q->z);
-
-            /* uh = uh*vh */
-            mpz_mul(uh, uh, vh);
-
-            /* vl = vh*vl - p*ql */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-
-            /* vh = vh*vh - 2*qh */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-        }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
-
-            /* uh = uh*vl - ql */
-            mpz_mul(uh, uh, vl);
-            mpz_sub(uh, uh, ql);
-
-            /* vh = vh*vl - p*ql */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-
-            /* vl = vl*vl - 2*ql */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-        }
-    }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    /* qh = ql*q */
-    mpz_mul(qh, ql, q->z);
-
-    /* uh = uh*vl - ql */
-    mpz_mul(uh, uh, vl);
-    mpz_sub(uh, uh, ql);
-
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
-
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    for (j = 1; j <= s; j++) {
-        /* uh = uh*vl */
-        mpz_mul(uh, uh, vl);
-
-        /* vl = vl*vl - 2*ql */
-        mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-
-        /* ql = ql*ql */
-        mpz_mul(ql, ql, ql);
-    }
-
-    if (!(result = GMPy_MPZ_New(NULL)))
-        goto cleanup;
-
-    /* uh contains our return value */
-    mpz_set(result->z, uh);
-
-  cleanup:
-    mpz_clear(uh);
-    mpz_clear(vl);
-    mpz_clear(vh);
-    mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)q);
-    Py_XDECREF((PyObject*)k);
-
-    return (PyObject*)result;
-}
-
-PyDoc_STRVAR(doc_mpz_lucasu_mod,
-"lucasu_mod(p,q,k,n) -> mpz\n\n"
-"Return the k-th element of the Lucas U sequence defined by p,q (mod n).\n"
-"p*p - 4*q must not equal 0; k must be greater than or equal to 0;\n"
-"n must be greater than 0.");
-
-static PyObject *
-GMPY_mpz_lucasu_mod(PyObject *self, PyObject *args)
-{
-    /* Adaptation of algorithm found in http://joye.site88.net/papers/JQ96lucas.pdf
-     * calculate u[k] (modulo n) of Lucas U sequence for p,q.
-     * Note: p^2-4q=0 is not tested, not a proper Lucas sequence!!
-     */
-
-    MPZ_Object *result = 0, *p, *q, *k, *n;
-
-    size_t s = 0, j = 0;
-    mpz_t uh, vl, vh, ql, qh, tmp;
-
-    if (PyTuple_Size(args) != 4) {
-        TYPE_ERROR("lucasu_mod() requires 4 integer arguments");
-        return NULL;
-    }
-
-    mpz_init(uh);
-    mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
-
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    k = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 3), NULL);
-    if (!p || !q || !k || !n) {
-        TYPE_ERROR("lucasu_mod() requires 4 integer arguments");
-        goto cleanup;
-    }
-
-    /* Check if p*p - 4*q == 0. */
-
-    mpz_mul(tmp, p->z, p->z);
-    mpz_mul_ui(qh, q->z, 4);
-    mpz_sub(tmp, tmp, qh);
-    if (mpz_sgn(tmp) == 0) {
-        VALUE_ERROR("invalid values for p,q in lucasu_mod()");
-        goto cleanup;
-    }
-
-    /* Check if k < 0. */
-
-    if (mpz_sgn(k->z) < 0) {
-        VALUE_ERROR("invalid value for k in lucasu_mod()");
-        goto cleanup;
-    }
-
-    /* Check if n > 0. */
-
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("invalid value for n in lucasu_mod()");
-        goto cleanup;
-    }
-
-    mpz_set_si(uh, 1);
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp, 0);
-
-    s = mpz_scan1(k->z, 0);
-    for (j = mpz_sizeinbase(k->z,2)-1; j >= s+1; j--) {
-        /* ql = ql*qh (mod n) */
-        mpz_mul(ql, ql, qh);
-        mpz_mod(ql, ql, n->z);
-        if (mpz_tstbit(k->z,j) == 1) {
-            /* qh = ql*q */
-            mpz_mul(qh, ql, q->z);
-
-            /* uh = uh*vh (mod n) */
-            mpz_mul(uh, uh, vh);
-            mpz_mod(uh, uh, n->z);
-
-            /* vl = vh*vl - p*ql (mod n) */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-
-            /* vh = vh*vh - 2*qh (mod n) */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
-        }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
-
-            /* uh = uh*vl - ql (mod n) */
-            mpz_mul(uh, uh, vl);
-            mpz_sub(uh, uh, ql);
-            mpz_mod(uh, uh, n->z);
-
-            /* vh = vh*vl - p*ql (mod n) */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
-
-            /* vl = vl*vl - 2*ql (mod n) */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-        }
-    }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    /* qh = ql*q */
-    mpz_mul(qh, ql, q->z);
-
-    /* uh = uh*vl - ql */
-    mpz_mul(uh, uh, vl);
-    mpz_sub(uh, uh, ql);
-
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
-
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    for (j = 1; j <= s; j++) {
-        /* uh = uh*vl (mod n) */
-        mpz_mul(uh, uh, vl);
-        mpz_mod(uh, uh, n->z);
-
-        /* vl = vl*vl - 2*ql (mod n) */
-        mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-        mpz_mod(vl, vl, n->z);
-
-        /* ql = ql*ql (mod n) */
-        mpz_mul(ql, ql, ql);
-        mpz_mod(ql, ql, n->z);
-    }
-
-    if (!(result = GMPy_MPZ_New(NULL)))
-        goto cleanup;
-
-    /* uh contains our return value */
-    mpz_mod(result->z, uh, n->z);
-
-  cleanup:
-    mpz_clear(uh);
-    mpz_clear(vl);
-    mpz_clear(vh);
-    mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)q);
-    Py_XDECREF((PyObject*)k);
-    Py_XDECREF((PyObject*)n);
-
-    return (PyObject*)result;
-}
-
-PyDoc_STRVAR(doc_mpz_lucasv,
-"lucasv(p,q,k) -> mpz\n\n"
-"Return the k-th element of the Lucas V sequence defined by p,q.\n"
-"p*p - 4*q must not equal 0; k must be greater than or equal to 0.");
-
-static PyObject *
-GMPY_mpz_lucasv(PyObject *self, PyObject *args)
-{
-    /* Adaptation of algorithm found in http://joye.site88.net/papers/JQ96lucas.pdf
-     * calculate v[k] of Lucas V sequence for p,q.
-     * Note: p^2-4q=0 is not tested, not a proper Lucas sequence!!
-     */
-
-    MPZ_Object *result = 0, *p, *q, *k;
-    size_t s = 0, j = 0;
-    mpz_t vl, vh, ql, qh, tmp;
-
-    if (PyTuple_Size(args) != 3) {
-        TYPE_ERROR("lucasv() requires 3 integer arguments");
-        return NULL;
-    }
-
-    mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
-
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    k = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
-    if (!p || !q || !k) {
-        TYPE_ERROR("lucasv() requires 3 integer arguments");
-        goto cleanup;
-    }
-
-    /* Check if p*p - 4*q == 0. */
-
-    mpz_mul(tmp, p->z, p->z);
-    mpz_mul_ui(qh, q->z, 4);
-    mpz_sub(tmp, tmp, qh);
-    if (mpz_sgn(tmp) == 0) {
-        VALUE_ERROR("invalid values for p,q in lucasv()");
-        goto cleanup;
-    }
-
-    /* Check if k < 0. */
-
-    if (mpz_sgn(k->z) < 0) {
-        VALUE_ERROR("invalid value for k in lucasv()");
-        goto cleanup;
-    }
-
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp,0);
-
-    s = mpz_scan1(k->z, 0);
-    for (j = mpz_sizeinbase(k->z,2)-1; j >= s+1; j--) {
-        /* ql = ql*qh */
-        mpz_mul(ql, ql, qh);
-        if (mpz_tstbit(k->z,j) == 1) {
-            /* qh = ql*q */
-            mpz_mul(qh, ql, q->z);
-
-            /* vl = vh*vl - p*ql */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-
-            /* vh = vh*vh - 2*qh */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-        }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
-
-            /* vh = vh*vl - p*ql */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-
-            /* vl = vl*vl - 2*ql */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-        }
-    }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    /* qh = ql*q */
-    mpz_mul(qh, ql, q->z);
-
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
-
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    for (j = 1; j <= s; j++) {
-        /* vl = vl*vl - 2*ql */
-        mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-
-        /* ql = ql*ql */
-        mpz_mul(ql, ql, ql);
-    }
-
-    if (!(result = GMPy_MPZ_New(NULL)))
-        goto cleanup;
-
-    /* vl contains our return value */
-    mpz_set(result->z, vl);
-
-  cleanup:
-    mpz_clear(vl);
-    mpz_clear(vh);
-    mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)q);
-    Py_XDECREF((PyObject*)k);
-
-    return (PyObject*)result;
-}
-
-PyDoc_STRVAR(doc_mpz_lucasv_mod,
-"lucasv_mod(p,q,k,n) -> mpz\n\n"
-"Return the k-th element of the Lucas V sequence defined by p,q (mod n).\n"
-"p*p - 4*q must not equal 0; k must be greater than or equal to 0;\n"
-"n must be greater than 0.");
-
-static PyObject *
-GMPY_mpz_lucasv_mod(PyObject *self, PyObject *args)
-{
-    /* Adaptation of algorithm found in http://joye.site88.net/papers/JQ96lucas.pdf
-     * calculate v[k] (modulo n) of Lucas V sequence for p,q.
-     * Note: p^2-4q=0 is not tested, not a proper Lucas sequence!!
-     */
-
-    MPZ_Object *result = 0, *p, *q, *k, *n;
-
-    size_t s = 0, j = 0;
-    mpz_t vl, vh, ql, qh, tmp;
-
-    if (PyTuple_Size(args) != 4) {
-        TYPE_ERROR("lucasv_mod() requires 4 integer arguments");
-        return NULL;
-    }
-
-    mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
-
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    k = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 3), NULL);
-    if (!p || !q || !k || !n) {
-        TYPE_ERROR("lucasv_mod() requires 4 integer arguments");
-        goto cleanup;
-    }
-
-    /* Check if p*p - 4*q == 0. */
-
-    mpz_mul(tmp, p->z, p->z);
-    mpz_mul_ui(qh, q->z, 4);
-    mpz_sub(tmp, tmp, qh);
-    if (mpz_sgn(tmp) == 0) {
-        VALUE_ERROR("invalid values for p,q in lucasv_mod()");
-        goto cleanup;
-    }
-
-    /* Check if k < 0. */
-
-    if (mpz_sgn(k->z) < 0) {
-        VALUE_ERROR("invalid value for k in lucasv_mod()");
-        goto cleanup;
-    }
-
-    /* Check if n > 0. */
-
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("invalid value for n in lucasv_mod()");
-        goto cleanup;
-    }
-
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp,0);
-
-    s = mpz_scan1(k->z, 0);
-    for (j = mpz_sizeinbase(k->z,2)-1; j >= s+1; j--) {
-        /* ql = ql*qh (mod n) */
-        mpz_mul(ql, ql, qh);
-        mpz_mod(ql, ql, n->z);
-        if (mpz_tstbit(k->z,j) == 1) {
-            /* qh = ql*q */
-            mpz_mul(qh, ql, q->z);
-
-            /* vl = vh*vl - p*ql (mod n) */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-
-            /* vh = vh*vh - 2*qh (mod n) */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
-        }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
-
-            /* vh = vh*vl - p*ql (mod n) */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
-
-            /* vl = vl*vl - 2*ql (mod n) */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-        }
-    }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    /* qh = ql*q */
-    mpz_mul(qh, ql, q->z);
-
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
-
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    for (j = 1; j <= s; j++) {
-        /* vl = vl*vl - 2*ql (mod n) */
-        mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-        mpz_mod(vl, vl, n->z);
-
-        /* ql = ql*ql (mod n) */
-        mpz_mul(ql, ql, ql);
-        mpz_mod(ql, ql, n->z);
-    }
-
-    if (!(result = GMPy_MPZ_New(NULL)))
-        goto cleanup;
-
-    /* vl contains our return value */
-    mpz_mod(result->z, vl, n->z);
-
-  cleanup:
-    mpz_clear(vl);
-    mpz_clear(vh);
-    mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)q);
-    Py_XDECREF((PyObject*)k);
-    Py_XDECREF((PyObject*)n);
-
-    return (PyObject*)result;
-}
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy_mpz_lucas.c                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2011 David Cleaver                                            *
+ *                                                                         *
+ * Copyright 2012, 2013, 2014, 2015, 2016, 2017, 2018 Case Van Horsen      *
+ *                                                                         *
+ * The original file is available at:                                      *
+ *   <http://sourceforge.net/projects/mpzlucas/files/>                     *
+ *                                                                         *
+ * Modified by Case Van Horsen for inclusion into GMPY2.                   *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+
+/* Adaptation of algorithm found in http://joye.site88.net/papers/JQ96lucas.pdf
+ *
+ * GMPy_MPZ_Lucas_UV() is the shared core used by the lucasu/lucasv functions
+ * and by the Lucas probable prime tests. It calculates the k-th elements of
+ * the Lucas U and V sequences defined by p,q, and q**k. If n is not NULL,
+ * the calculations are done modulo n and the results are in [0, n). Any of
+ * u, v, or qk may be NULL if that result is not needed; the U sequence is
+ * not calculated if u is NULL.
+ *
+ * The caller must ensure k >= 0 and, if n is not NULL, n > 0. The results
+ * are only stored after all the calculations are done, so the outputs may
+ * share storage with the inputs. Odd moduli of up to GMPY_MONT_MAX_LIMBS
+ * limbs use the Montgomery form kernels in gmpy_mpz_mont.c.
+ */
+
+static void
+GMPy_MPZ_Lucas_UV(mpz_ptr u, mpz_ptr v, mpz_ptr qk, mpz_srcptr p, mpz_srcptr q,
+                  mpz_srcptr k, mpz_srcptr n)
+{
+    mpz_t uh, vl, vh, ql, qh, tmp;
+    mp_bitcnt_t s = 0, j = 0;
+    gmpy_mont_t ctx;
+
+    /* Small odd moduli are handled in Montgomery form. */
+    if (n && GMPy_Mont_Init(&ctx, n)) {
+        gmpy_mont_limbs mp, mq, mu, mv, mqk;
+
+        GMPy_Mont_To(&ctx, mp, p);
+        GMPy_Mont_To(&ctx, mq, q);
+        GMPy_Mont_Lucas_UV(&ctx, u ? mu : NULL, mv, mqk, mp, mq, k);
+        if (u)
+            GMPy_Mont_From(&ctx, u, mu);
+        if (v)
+            GMPy_Mont_From(&ctx, v, mv);
+        if (qk)
+            GMPy_Mont_From(&ctx, qk, mqk);
+        return;
+    }
+
+    mpz_init_set_ui(uh, 1);
+    mpz_init_set_ui(vl, 2);
+    mpz_init_set(vh, p);
+    mpz_init_set_ui(ql, 1);
+    mpz_init_set_ui(qh, 1);
+    mpz_init(tmp);
+
+    /* U_0 = 0, V_0 = 2, q**0 = 1 */
+    if (mpz_sgn(k) == 0) {
+        mpz_set_ui(uh, 0);
+        if (n) {
+            mpz_mod(vl, vl, n);
+            mpz_mod(ql, ql, n);
+        }
+        goto done;
+    }
+
+    s = mpz_scan1(k, 0);
+    for (j = mpz_sizeinbase(k, 2) - 1; j > s; j--) {
+        /* ql = ql*qh (mod n) */
+        mpz_mul(ql, ql, qh);
+        if (n)
+            mpz_mod(ql, ql, n);
+        if (mpz_tstbit(k, j) == 1) {
+            /* qh = ql*q (mod n) */
+            mpz_mul(qh, ql, q);
+            if (n)
+                mpz_mod(qh, qh, n);
+
+            /* uh = uh*vh (mod n) */
+            if (u) {
+                mpz_mul(uh, uh, vh);
+                if (n)
+                    mpz_mod(uh, uh, n);
+            }
+
+            /* vl = vh*vl - p*ql (mod n) */
+            mpz_mul(vl, vh, vl);
+            mpz_mul(tmp, ql, p);
+            mpz_sub(vl, vl, tmp);
+            if (n)
+                mpz_mod(vl, vl, n);
+
+            /* vh = vh*vh - 2*qh (mod n) */
+            mpz_mul(vh, vh, vh);
+            mpz_mul_2exp(tmp, qh, 1);
+            mpz_sub(vh, vh, tmp);
+            if (n)
+                mpz_mod(vh, vh, n);
+        }
+        else {
+            /* qh = ql */
+            mpz_set(qh, ql);
+
+            /* uh = uh*vl - ql (mod n) */
+            if (u) {
+                mpz_mul(uh, uh, vl);
+                mpz_sub(uh, uh, ql);
+                if (n)
+                    mpz_mod(uh, uh, n);
+            }
+
+            /* vh = vh*vl - p*ql (mod n) */
+            mpz_mul(vh, vh, vl);
+            mpz_mul(tmp, ql, p);
+            mpz_sub(vh, vh, tmp);
+            if (n)
+                mpz_mod(vh, vh, n);
+
+            /* vl = vl*vl - 2*ql (mod n) */
+            mpz_mul(vl, vl, vl);
+            mpz_mul_2exp(tmp, ql, 1);
+            mpz_sub(vl, vl, tmp);
+            if (n)
+                mpz_mod(vl, vl, n);
+        }
+    }
+    /* ql = ql*qh */
+    mpz_mul(ql, ql, qh);
+
+    /* qh = ql*q */
+    mpz_mul(qh, ql, q);
+
+    /* uh = uh*vl - ql */
+    if (u) {
+        mpz_mul(uh, uh, vl);
+        mpz_sub(uh, uh, ql);
+    }
+
+    /* vl = vh*vl - p*ql */
+    mpz_mul(vl, vh, vl);
+    mpz_mul(tmp, ql, p);
+    mpz_sub(vl, vl, tmp);
+
+    /* ql = ql*qh */
+    mpz_mul(ql, ql, qh);
+
+    if (n) {
+        if (u)
+            mpz_mod(uh, uh, n);
+        mpz_mod(vl, vl, n);
+        mpz_mod(ql, ql, n);
+    }
+
+    for (j = 1; j <= s; j++) {
+        /* uh = uh*vl (mod n) */
+        if (u) {
+            mpz_mul(uh, uh, vl);
+            if (n)
+                mpz_mod(uh, uh, n);
+        }
+
+        /* vl = vl*vl - 2*ql (mod n) */
+        mpz_mul(vl, vl, vl);
+        mpz_mul_2exp(tmp, ql, 1);
+        mpz_sub(vl, vl, tmp);
+        if (n)
+            mpz_mod(vl, vl, n);
+
+        /* ql = ql*ql (mod n) */
+        mpz_mul(ql, ql, ql);
+        if (n)
+            mpz_mod(ql, ql, n);
+    }
+
+  done:
+    if (u)
+        mpz_swap(u, uh);
+    if (v)
+        mpz_swap(v, vl);
+    if (qk)
+        mpz_swap(qk, ql);
+
+    mpz_clear(uh);
+    mpz_clear(vl);
+    mpz_clear(vh);
+    mpz_clear(ql);
+    mpz_clear(qh);
+    mpz_clear(tmp);
+}
+
+/* Convert and validate the arguments shared by the lucasu(), lucasu_mod(),
+ * lucasv(), and lucasv_mod() functions. On success, 0 is returned and
+ * references to the converted arguments are stored in p, q, k, and n (if
+ * n is not NULL). Otherwise an exception is set and -1 is returned.
+ */
+
+static int
+_GMPy_MPZ_Lucas_Args(PyObject *args, const char *name, MPZ_Object **p,
+                     MPZ_Object **q, MPZ_Object **k, MPZ_Object **n)
+{
+    Py_ssize_t argc = n ? 4 : 3;
+    mpz_t tmp;
+    int ok;
+
+    *p = *q = *k = NULL;
+    if (n)
+        *n = NULL;
+
+    if (PyTuple_Size(args) != argc) {
+        PyErr_Format(PyExc_TypeError, "%s() requires %d integer arguments",
+                     name, (int)argc);
+        return -1;
+    }
+
+    *p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
+    *q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
+    *k = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
+    if (n)
+        *n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 3), NULL);
+    if (!*p || !*q || !*k || (n && !*n)) {
+        PyErr_Format(PyExc_TypeError, "%s() requires %d integer arguments",
+                     name, (int)argc);
+        goto error;
+    }
+
+    /* Check if p*p - 4*q == 0. */
+
+    mpz_init(tmp);
+    mpz_mul(tmp, (*p)->z, (*p)->z);
+    mpz_submul_ui(tmp, (*q)->z, 4);
+    ok = mpz_sgn(tmp) != 0;
+    mpz_clear(tmp);
+    if (!ok) {
+        PyErr_Format(PyExc_ValueError, "invalid values for p,q in %s()", name);
+        goto error;
+    }
+
+    /* Check if k < 0. */
+
+    if (mpz_sgn((*k)->z) < 0) {
+        PyErr_Format(PyExc_ValueError, "invalid value for k in %s()", name);
+        goto error;
+    }
+
+    /* Check if n > 0. */
+
+    if (n && mpz_sgn((*n)->z) <= 0) {
+        PyErr_Format(PyExc_ValueError, "invalid value for n in %s()", name);
+        goto error;
+    }
+
+    return 0;
+
+  error:
+    Py_XDECREF((PyObject*)*p);
+    Py_XDECREF((PyObject*)*q);
+    Py_XDECREF((PyObject*)*k);
+    if (n)
+        Py_XDECREF((PyObject*)*n);
+    return -1;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasu,
+"lucasu(p,q,k) -> mpz\n\n"
+"Return the k-th element of the Lucas U sequence defined by p,q.\n"
+"p*p - 4*q must not equal 0; k must be greater than or equal to 0.");
+
+static PyObject *
+GMPY_mpz_lucasu(PyObject *self, PyObject *args)
+{
+    MPZ_Object *result, *p, *q, *k;
+
+    if (_GMPy_MPZ_Lucas_Args(args, "lucasu", &p, &q, &k, NULL) < 0)
+        return NULL;
+
+    if ((result = GMPy_MPZ_New(NULL)))
+        GMPy_MPZ_Lucas_UV(result->z, NULL, NULL, p->z, q->z, k->z, NULL);
+
+    Py_DECREF((PyObject*)p);
+    Py_DECREF((PyObject*)q);
+    Py_DECREF((PyObject*)k);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasu_mod,
+"lucasu_mod(p,q,k,n) -> mpz\n\n"
+"Return the k-th element of the Lucas U sequence defined by p,q (mod n).\n"
+"p*p - 4*q must not equal 0; k must be greater than or equal to 0;\n"
+"n must be greater than 0.");
+
+static PyObject *
+GMPY_mpz_lucasu_mod(PyObject *self, PyObject *args)
+{
+    MPZ_Object *result, *p, *q, *k, *n;
+
+    if (_GMPy_MPZ_Lucas_Args(args, "lucasu_mod", &p, &q, &k, &n) < 0)
+        return NULL;
+
+    if ((result = GMPy_MPZ_New(NULL)))
+        GMPy_MPZ_Lucas_UV(result->z, NULL, NULL, p->z, q->z, k->z, n->z);
+
+    Py_DECREF((PyObject*)p);
+    Py_DECREF((PyObject*)q);
+    Py_DECREF((PyObject*)k);
+    Py_DECREF((PyObject*)n);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasv,
+"lucasv(p,q,k) -> mpz\n\n"
+"Return the k-th element of the Lucas V sequence defined by p,q.\n"
+"p*p - 4*q must not equal 0; k must be greater than or equal to 0.");
+
+static PyObject *
+GMPY_mpz_lucasv(PyObject *self, PyObject *args)
+{
+    MPZ_Object *result, *p, *q, *k;
+
+    if (_GMPy_MPZ_Lucas_Args(args, "lucasv", &p, &q, &k, NULL) < 0)
+        return NULL;
+
+    if ((result = GMPy_MPZ_New(NULL)))
+        GMPy_MPZ_Lucas_UV(NULL, result->z, NULL, p->z, q->z, k->z, NULL);
+
+    Py_DECREF((PyObject*)p);
+    Py_DECREF((PyObject*)q);
+    Py_DECREF((PyObject*)k);
+    return (PyObject*)result;
+}
+
+PyDoc_STRVAR(doc_mpz_lucasv_mod,
+"lucasv_mod(p,q,k,n) -> mpz\n\n"
+"Return the k-th element of the Lucas V sequence defined by p,q (mod n).\n"
+"p*p - 4*q must not equal 0; k must be greater than or equal to 0;\n"
+"n must be greater than 0.");
+
+static PyObject *
+GMPY_mpz_lucasv_mod(PyObject *self, PyObject *args)
+{
+    MPZ_Object *result, *p, *q, *k, *n;
+
+    if (_GMPy_MPZ_Lucas_Args(args, "lucasv_mod", &p, &q, &k, &n) < 0)
+        return NULL;
+
+    if ((result = GMPy_MPZ_New(NULL)))
+        GMPy_MPZ_Lucas_UV(NULL, result->z, NULL, p->z, q->z, k->z, n->z);
+
+    Py_DECREF((PyObject*)p);
+    Py_DECREF((PyObject*)q);
+    Py_DECREF((PyObject*)k);
+    Py_DECREF((PyObject*)n);
+    return (PyObject*)result;
+}
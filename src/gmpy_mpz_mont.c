@@ -0,0 +1,562 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy_mpz_mont.c                                                         *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/* Montgomery multiplication needs an odd modulus. With m odd and
+ * R = 2**(limbs * GMP_NUMB_BITS), REDC(t) = t/R mod m is calculated by
+ * repeatedly adding the multiple of m that clears the lowest limb of t. The
+ * intermediate carries are stored in the cleared limbs and added back at the
+ * end, the same approach used by GMP's internal mpn_redc_1.
+ *
+ * All values are kept fully reduced in [0, m) so they can be compared
+ * directly.
+ */
+
+/* Initialize ctx for the modulus n. Returns 1 if n is odd, greater than 1,
+ * and fits in GMPY_MONT_MAX_LIMBS limbs. Otherwise returns 0 and the caller
+ * must use the generic mpz functions.
+ */
+
+static int
+GMPy_Mont_Init(gmpy_mont_t *ctx, mpz_srcptr n)
+{
+#ifdef GMPY_MONT
+    mp_limb_t inv, q[2], r[GMPY_MONT_MAX_LIMBS + 1] = {0};
+    mp_size_t i;
+    int j;
+
+    if (mpz_sgn(n) <= 0 || mpz_even_p(n) || mpz_cmp_ui(n, 1) == 0 ||
+        mpz_size(n) > GMPY_MONT_MAX_LIMBS) {
+        return 0;
+    }
+
+    ctx->n = (mp_size_t)mpz_size(n);
+    for (i = 0; i < GMPY_MONT_MAX_LIMBS; i++) {
+        ctx->m[i] = mpz_getlimbn(n, i);
+    }
+
+    /* Newton iteration for 1/m mod 2**GMP_NUMB_BITS. m*m == 1 mod 8 so the
+     * initial value is correct to 3 bits and each step doubles the number of
+     * correct bits.
+     */
+    inv = ctx->m[0];
+    for (j = 0; j < 5; j++) {
+        inv *= 2 - ctx->m[0] * inv;
+    }
+    ctx->minv = -inv;
+
+    /* one = R mod m. The most significant limb of m is not 0. */
+    r[ctx->n] = 1;
+    mpn_tdiv_qr(q, ctx->one, 0, r, ctx->n + 1, ctx->m, ctx->n);
+    for (i = ctx->n; i < GMPY_MONT_MAX_LIMBS; i++) {
+        ctx->one[i] = 0;
+    }
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/* r = x*R mod m. x may be any integer, including negative values. */
+
+static void
+GMPy_Mont_To(const gmpy_mont_t *ctx, mp_limb_t *r, mpz_srcptr x)
+{
+    mp_limb_t num[2 * GMPY_MONT_MAX_LIMBS], q[GMPY_MONT_MAX_LIMBS + 1];
+    mp_size_t i, n = ctx->n, xn = (mp_size_t)mpz_size(x);
+    mpz_t m, temp;
+
+    /* Calculate (|x| * R) mod m directly on the limbs if |x| fits in n
+     * limbs. Larger values are first reduced with the mpz functions.
+     */
+    if (xn == 0) {
+        for (i = 0; i < n; i++) {
+            r[i] = 0;
+        }
+        return;
+    }
+    if (xn <= n) {
+        for (i = 0; i < n; i++) {
+            num[i] = 0;
+        }
+        for (i = 0; i < xn; i++) {
+            num[n + i] = mpz_getlimbn(x, i);
+        }
+        mpn_tdiv_qr(q, r, 0, num, n + xn, ctx->m, n);
+        if (mpz_sgn(x) < 0 && !GMPy_Mont_Is_Zero(ctx, r))
+            mpn_sub_n(r, ctx->m, r, n);
+        return;
+    }
+
+    mpz_init(m);
+    mpz_init(temp);
+    mpz_import(m, ctx->n, -1, sizeof(mp_limb_t), 0, 0, ctx->m);
+    mpz_mod(temp, x, m);
+    mpz_mul_2exp(temp, temp, ctx->n * GMP_NUMB_BITS);
+    mpz_mod(temp, temp, m);
+    for (i = 0; i < ctx->n; i++) {
+        r[i] = mpz_getlimbn(temp, i);
+    }
+    mpz_clear(m);
+    mpz_clear(temp);
+}
+
+/* r = a/R mod m, i.e. convert back to a normal integer in [0, m). */
+
+static void
+GMPy_Mont_From(const gmpy_mont_t *ctx, mpz_ptr r, const mp_limb_t *a)
+{
+    gmpy_mont_limbs plain_one = {1}, temp;
+
+    GMPy_Mont_Mul(ctx, temp, a, plain_one);
+    mpz_import(r, ctx->n, -1, sizeof(mp_limb_t), 0, 0, temp);
+}
+
+#ifdef GMPY_MONT_INT128
+/* Coarsely integrated operand scanning (CIOS) Montgomery multiplication
+ * using 128-bit intermediate products. It is always called with a constant
+ * n so the compiler can fully unroll the loops for each size.
+ */
+
+static inline void
+_GMPy_Mont_Mul_CIOS(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a,
+                    const mp_limb_t *b, const mp_size_t n)
+{
+    mp_limb_t t[GMPY_MONT_MAX_LIMBS + 2] = {0}, d[GMPY_MONT_MAX_LIMBS];
+    mp_limb_t u, borrow, mask;
+    unsigned __int128 c;
+    mp_size_t i, j;
+
+    for (i = 0; i < n; i++) {
+        /* t = t + a*b[i] */
+        c = 0;
+        for (j = 0; j < n; j++) {
+            c = (unsigned __int128)a[j] * b[i] + t[j] + (mp_limb_t)(c >> 64);
+            t[j] = (mp_limb_t)c;
+        }
+        c = (unsigned __int128)t[n] + (mp_limb_t)(c >> 64);
+        t[n] = (mp_limb_t)c;
+        t[n + 1] = (mp_limb_t)(c >> 64);
+
+        /* t = (t + u*m) / 2**64 */
+        u = t[0] * ctx->minv;
+        c = (unsigned __int128)u * ctx->m[0] + t[0];
+        for (j = 1; j < n; j++) {
+            c = (unsigned __int128)u * ctx->m[j] + t[j] + (mp_limb_t)(c >> 64);
+            t[j - 1] = (mp_limb_t)c;
+        }
+        c = (unsigned __int128)t[n] + (mp_limb_t)(c >> 64);
+        t[n - 1] = (mp_limb_t)c;
+        t[n] = t[n + 1] + (mp_limb_t)(c >> 64);
+    }
+
+    /* t < 2*m. Subtract m without branching since the result of the
+     * comparison is unpredictable.
+     */
+    borrow = 0;
+    for (j = 0; j < n; j++) {
+        c = (unsigned __int128)t[j] - ctx->m[j] - borrow;
+        d[j] = (mp_limb_t)c;
+        borrow = (mp_limb_t)(c >> 64) & 1;
+    }
+    mask = -(mp_limb_t)(t[n] >= borrow);
+    for (j = 0; j < n; j++) {
+        r[j] = (d[j] & mask) | (t[j] & ~mask);
+    }
+}
+
+/* Montgomery multiplication for a one limb modulus m with inv = 1/m mod
+ * 2**64. With u = lo(a*b)*inv, the low limbs of a*b and u*m are equal so
+ * (a*b - u*m)/2**64 = hi(a*b) - hi(u*m), which is in (-m, m).
+ */
+
+static inline mp_limb_t
+_GMPy_Mont_Mul1(mp_limb_t a, mp_limb_t b, mp_limb_t m, mp_limb_t inv)
+{
+    unsigned __int128 p;
+    mp_limb_t hi, mh;
+
+    p = (unsigned __int128)a * b;
+    hi = (mp_limb_t)(p >> 64);
+    mh = (mp_limb_t)(((unsigned __int128)((mp_limb_t)p * inv) * m) >> 64);
+    return hi - mh + (m & -(mp_limb_t)(hi < mh));
+}
+#endif
+
+/* r = a*b/R mod m. r may be the same as a or b. */
+
+static void
+GMPy_Mont_Mul(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a,
+              const mp_limb_t *b)
+{
+    mp_limb_t t[2 * GMPY_MONT_MAX_LIMBS], cy;
+    mp_size_t i, n = ctx->n;
+
+#ifdef GMPY_MONT_INT128
+    if (n == 1) {
+        r[0] = _GMPy_Mont_Mul1(a[0], b[0], ctx->m[0], -ctx->minv);
+        return;
+    }
+
+    switch (n) {
+        case 2:
+            _GMPy_Mont_Mul_CIOS(ctx, r, a, b, 2);
+            return;
+        case 3:
+            _GMPy_Mont_Mul_CIOS(ctx, r, a, b, 3);
+            return;
+    }
+#endif
+
+    mpn_mul_n(t, a, b, n);
+    for (i = 0; i < n; i++) {
+        t[i] = mpn_addmul_1(t + i, ctx->m, n, t[i] * ctx->minv);
+    }
+    cy = mpn_add_n(r, t + n, t, n);
+    if (cy || mpn_cmp(r, ctx->m, n) >= 0)
+        mpn_sub_n(r, r, ctx->m, n);
+}
+
+/* r = a + b mod m */
+
+static void
+GMPy_Mont_Add(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a,
+              const mp_limb_t *b)
+{
+    mp_limb_t cy;
+
+    cy = mpn_add_n(r, a, b, ctx->n);
+    if (cy || mpn_cmp(r, ctx->m, ctx->n) >= 0)
+        mpn_sub_n(r, r, ctx->m, ctx->n);
+}
+
+/* r = a - b mod m */
+
+static void
+GMPy_Mont_Sub(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a,
+              const mp_limb_t *b)
+{
+    if (mpn_sub_n(r, a, b, ctx->n))
+        mpn_add_n(r, r, ctx->m, ctx->n);
+}
+
+static void
+GMPy_Mont_Set(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a)
+{
+    mp_size_t i;
+
+    for (i = 0; i < ctx->n; i++) {
+        r[i] = a[i];
+    }
+}
+
+static int
+GMPy_Mont_Cmp(const gmpy_mont_t *ctx, const mp_limb_t *a, const mp_limb_t *b)
+{
+    return mpn_cmp(a, b, ctx->n);
+}
+
+static int
+GMPy_Mont_Is_Zero(const gmpy_mont_t *ctx, const mp_limb_t *a)
+{
+    mp_size_t i;
+
+    for (i = 0; i < ctx->n; i++) {
+        if (a[i])
+            return 0;
+    }
+    return 1;
+}
+
+/* Montgomery form version of GMPy_MPZ_Lucas_UV(). p and q must already be
+ * in Montgomery form and the results are returned in Montgomery form. Any
+ * of u, v, or qk may be NULL. k must be >= 0.
+ */
+
+static void
+GMPy_Mont_Lucas_UV(const gmpy_mont_t *ctx, mp_limb_t *u, mp_limb_t *v,
+                   mp_limb_t *qk, const mp_limb_t *p, const mp_limb_t *q,
+                   mpz_srcptr k)
+{
+    gmpy_mont_limbs uh, vl, vh, ql, qh, tmp;
+    mp_bitcnt_t s = 0, j = 0;
+    int p_is_one;
+
+    /* The Selfridge parameters always use p == 1. */
+    p_is_one = (GMPy_Mont_Cmp(ctx, p, ctx->one) == 0);
+
+    GMPy_Mont_Set(ctx, uh, ctx->one);
+    GMPy_Mont_Add(ctx, vl, ctx->one, ctx->one);
+    GMPy_Mont_Set(ctx, vh, p);
+    GMPy_Mont_Set(ctx, ql, ctx->one);
+    GMPy_Mont_Set(ctx, qh, ctx->one);
+
+    /* U_0 = 0, V_0 = 2, q**0 = 1 */
+    if (mpz_sgn(k) == 0) {
+        GMPy_Mont_Sub(ctx, uh, uh, uh);
+        goto done;
+    }
+
+#define MONT_P_TIMES(r, x) \
+    do { \
+        if (p_is_one) \
+            GMPy_Mont_Set(ctx, r, x); \
+        else \
+            GMPy_Mont_Mul(ctx, r, x, p); \
+    } while (0)
+
+    s = mpz_scan1(k, 0);
+    for (j = mpz_sizeinbase(k, 2) - 1; j > s; j--) {
+        /* ql = ql*qh */
+        GMPy_Mont_Mul(ctx, ql, ql, qh);
+        if (mpz_tstbit(k, j) == 1) {
+            /* qh = ql*q */
+            GMPy_Mont_Mul(ctx, qh, ql, q);
+
+            /* uh = uh*vh */
+            if (u)
+                GMPy_Mont_Mul(ctx, uh, uh, vh);
+
+            /* vl = vh*vl - p*ql */
+            GMPy_Mont_Mul(ctx, vl, vh, vl);
+            MONT_P_TIMES(tmp, ql);
+            GMPy_Mont_Sub(ctx, vl, vl, tmp);
+
+            /* vh = vh*vh - 2*qh */
+            GMPy_Mont_Mul(ctx, vh, vh, vh);
+            GMPy_Mont_Add(ctx, tmp, qh, qh);
+            GMPy_Mont_Sub(ctx, vh, vh, tmp);
+        }
+        else {
+            /* qh = ql */
+            GMPy_Mont_Set(ctx, qh, ql);
+
+            /* uh = uh*vl - ql */
+            if (u) {
+                GMPy_Mont_Mul(ctx, uh, uh, vl);
+                GMPy_Mont_Sub(ctx, uh, uh, ql);
+            }
+
+            /* vh = vh*vl - p*ql */
+            GMPy_Mont_Mul(ctx, vh, vh, vl);
+            MONT_P_TIMES(tmp, ql);
+            GMPy_Mont_Sub(ctx, vh, vh, tmp);
+
+            /* vl = vl*vl - 2*ql */
+            GMPy_Mont_Mul(ctx, vl, vl, vl);
+            GMPy_Mont_Add(ctx, tmp, ql, ql);
+            GMPy_Mont_Sub(ctx, vl, vl, tmp);
+        }
+    }
+    /* ql = ql*qh */
+    GMPy_Mont_Mul(ctx, ql, ql, qh);
+
+    /* qh = ql*q */
+    GMPy_Mont_Mul(ctx, qh, ql, q);
+
+    /* uh = uh*vl - ql */
+    if (u) {
+        GMPy_Mont_Mul(ctx, uh, uh, vl);
+        GMPy_Mont_Sub(ctx, uh, uh, ql);
+    }
+
+    /* vl = vh*vl - p*ql */
+    GMPy_Mont_Mul(ctx, vl, vh, vl);
+    MONT_P_TIMES(tmp, ql);
+    GMPy_Mont_Sub(ctx, vl, vl, tmp);
+
+    /* ql = ql*qh */
+    GMPy_Mont_Mul(ctx, ql, ql, qh);
+
+#undef MONT_P_TIMES
+
+    for (j = 1; j <= s; j++) {
+        /* uh = uh*vl */
+        if (u)
+            GMPy_Mont_Mul(ctx, uh, uh, vl);
+
+        /* vl = vl*vl - 2*ql */
+        GMPy_Mont_Mul(ctx, vl, vl, vl);
+        GMPy_Mont_Add(ctx, tmp, ql, ql);
+        GMPy_Mont_Sub(ctx, vl, vl, tmp);
+
+        /* ql = ql*ql */
+        GMPy_Mont_Mul(ctx, ql, ql, ql);
+    }
+
+  done:
+    if (u)
+        GMPy_Mont_Set(ctx, u, uh);
+    if (v)
+        GMPy_Mont_Set(ctx, v, vl);
+    if (qk)
+        GMPy_Mont_Set(ctx, qk, ql);
+}
+
+#ifdef GMPY_MONT_INT128
+/* Word sized Miller-Rabin tests. For n < 2**64 the arithmetic is done
+ * directly on 64-bit values without any mpz or mpn calls.
+ */
+
+typedef struct {
+    mp_limb_t n;        /* the odd modulus */
+    mp_limb_t inv;      /* 1/n mod 2**64 */
+    mp_limb_t one;      /* 2**64 mod n */
+    mp_limb_t r2;       /* 2**128 mod n, used to convert into Montgomery form */
+    mp_limb_t d;        /* n - 1 = d * 2**s with d odd */
+    int s;
+} gmpy_mont1_t;
+
+static void
+_GMPy_Mont1_Init(gmpy_mont1_t *ctx, mp_limb_t n)
+{
+    int j;
+
+    ctx->n = n;
+    ctx->inv = n;
+    for (j = 0; j < 5; j++) {
+        ctx->inv *= 2 - n * ctx->inv;
+    }
+    ctx->one = (0 - n) % n;
+    ctx->r2 = (mp_limb_t)(((unsigned __int128)ctx->one << 64) % n);
+    ctx->d = n - 1;
+    ctx->s = 0;
+    while (!(ctx->d & 1)) {
+        ctx->d >>= 1;
+        ctx->s++;
+    }
+}
+
+/* Return 1 if n is a strong probable prime to the base a, 0 if n is
+ * composite. a must be in [1, n).
+ */
+
+static int
+_GMPy_Mont1_Strong_PRP(const gmpy_mont1_t *ctx, mp_limb_t a)
+{
+    mp_limb_t n = ctx->n, inv = ctx->inv, base, x, mask, mnm1;
+    int i;
+
+    base = _GMPy_Mont_Mul1(a, ctx->r2, n, inv);
+    mnm1 = n - ctx->one;
+
+    /* x = a**d, left-to-right binary exponentiation */
+    mask = (mp_limb_t)1 << (GMP_NUMB_BITS - 1);
+    while (!(ctx->d & mask))
+        mask >>= 1;
+    x = base;
+    for (mask >>= 1; mask; mask >>= 1) {
+        x = _GMPy_Mont_Mul1(x, x, n, inv);
+        if (ctx->d & mask)
+            x = _GMPy_Mont_Mul1(x, base, n, inv);
+    }
+
+    if (x == ctx->one || x == mnm1)
+        return 1;
+
+    for (i = 1; i < ctx->s; i++) {
+        x = _GMPy_Mont_Mul1(x, x, n, inv);
+        if (x == mnm1)
+            return 1;
+        if (x == ctx->one)
+            return 0;
+    }
+    return 0;
+}
+
+/* Strong probable prime test for an odd n > 1 that fits in one limb. a may
+ * be any value in [1, n).
+ */
+
+static int
+GMPy_Mont_Strong_PRP_Limb(mp_limb_t n, mp_limb_t a)
+{
+    gmpy_mont1_t ctx;
+
+    _GMPy_Mont1_Init(&ctx, n);
+    return _GMPy_Mont1_Strong_PRP(&ctx, a);
+}
+
+/* Deterministic primality test for n < 2**64. Trial division by the primes
+ * below 100 is followed by Miller-Rabin tests with a set of bases that is
+ * known to have no strong pseudoprimes below the given limit. The sets for
+ * the smaller limits are from Pomerance, Selfridge & Wagstaff and Jaeschke,
+ * the final set of seven bases was found by Jim Sinclair.
+ */
+
+static const unsigned char gmpy_small_primes[] = {
+    3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71,
+    73, 79, 83, 89, 97
+};
+
+static const struct {
+    mp_limb_t limit;
+    int count;
+    mp_limb_t bases[7];
+} gmpy_mr_bases[] = {
+    {2047,          1, {2}},
+    {1373653,       2, {2, 3}},
+    {25326001,      3, {2, 3, 5}},
+    {3215031751,    4, {2, 3, 5, 7}},
+    {4759123141,    3, {2, 7, 61}},
+    {0,             7, {2, 325, 9375, 28178, 450775, 9780504, 1795265022}}
+};
+
+static int
+GMPy_Mont_Is_Prime_Limb(mp_limb_t n)
+{
+    gmpy_mont1_t ctx;
+    mp_limb_t a;
+    size_t i;
+    int j;
+
+    if (n < 2)
+        return 0;
+    if (!(n & 1))
+        return n == 2;
+
+    for (i = 0; i < sizeof(gmpy_small_primes); i++) {
+        if (n % gmpy_small_primes[i] == 0)
+            return n == gmpy_small_primes[i];
+    }
+
+    /* A composite with no factor below 100 is at least 101*101. */
+    if (n < 101 * 101)
+        return 1;
+
+    for (i = 0; gmpy_mr_bases[i].limit && n >= gmpy_mr_bases[i].limit; i++)
+        ;
+
+    _GMPy_Mont1_Init(&ctx, n);
+    for (j = 0; j < gmpy_mr_bases[i].count; j++) {
+        a = gmpy_mr_bases[i].bases[j] % n;
+        if (a && !_GMPy_Mont1_Strong_PRP(&ctx, a))
+            return 0;
+    }
+    return 1;
+}
+#endif
@@ -0,0 +1,94 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * gmpy_mpz_mont.h                                                         *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Python interface to the GMP or MPIR, MPFR, and MPC multiple precision   *
+ * libraries.                                                              *
+ *                                                                         *
+ * Copyright 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,               *
+ *           2008, 2009 Alex Martelli                                      *
+ *                                                                         *
+ * Copyright 2008, 2009, 2010, 2011, 2012, 2013, 2014,                     *
+ *           2015, 2016, 2017, 2018 Case Van Horsen                        *
+ *                                                                         *
+ * This file is part of GMPY2.                                             *
+ *                                                                         *
+ * GMPY2 is free software: you can redistribute it and/or modify it under  *
+ * the terms of the GNU Lesser General Public License as published by the  *
+ * Free Software Foundation, either version 3 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * GMPY2 is distributed in the hope that it will be useful, but WITHOUT    *
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or   *
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public    *
+ * License for more details.                                               *
+ *                                                                         *
+ * You should have received a copy of the GNU Lesser General Public        *
+ * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef GMPY_MONT_H
+#define GMPY_MONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Montgomery arithmetic for small odd moduli.
+ *
+ * The probable prime tests spend almost all of their time multiplying and
+ * reducing numbers modulo n. For moduli of up to GMPY_MONT_MAX_LIMBS limbs,
+ * the values are kept in Montgomery form (x*R mod n, with R = 2**(limbs *
+ * GMP_NUMB_BITS)) in fixed size limb arrays so each step is a product and a
+ * REDC instead of a product and a division. When the compiler provides a
+ * 128-bit integer type, one limb moduli use native arithmetic and two and
+ * three limb moduli use unrolled CIOS multiplication. Four limb moduli use
+ * the mpn functions.
+ *
+ * GMP's mpz_powm() already works in Montgomery form internally so it is
+ * still used for the modular exponentiations, except for n < 2**64 where the
+ * Miller-Rabin tests are done entirely in 64-bit registers. This also
+ * provides a deterministic primality test for n < 2**64.
+ */
+
+#define GMPY_MONT_MAX_LIMBS 4
+
+#if (GMP_NAIL_BITS == 0)
+#  define GMPY_MONT 1
+#endif
+
+#if defined(GMPY_MONT) && (GMP_NUMB_BITS == 64) && defined(__SIZEOF_INT128__)
+#  define GMPY_MONT_INT128 1
+#endif
+
+typedef struct {
+    mp_size_t n;                            /* number of limbs in m */
+    mp_limb_t minv;                         /* -1/m mod 2**GMP_NUMB_BITS */
+    mp_limb_t m[GMPY_MONT_MAX_LIMBS];       /* the odd modulus */
+    mp_limb_t one[GMPY_MONT_MAX_LIMBS];     /* R mod m, i.e. 1 in Montgomery form */
+} gmpy_mont_t;
+
+/* A value in Montgomery form. Only the first n limbs are used. */
+
+typedef mp_limb_t gmpy_mont_limbs[GMPY_MONT_MAX_LIMBS];
+
+static int  GMPy_Mont_Init(gmpy_mont_t *ctx, mpz_srcptr n);
+static void GMPy_Mont_To(const gmpy_mont_t *ctx, mp_limb_t *r, mpz_srcptr x);
+static void GMPy_Mont_From(const gmpy_mont_t *ctx, mpz_ptr r, const mp_limb_t *a);
+static void GMPy_Mont_Mul(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a, const mp_limb_t *b);
+static void GMPy_Mont_Add(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a, const mp_limb_t *b);
+static void GMPy_Mont_Sub(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a, const mp_limb_t *b);
+static void GMPy_Mont_Set(const gmpy_mont_t *ctx, mp_limb_t *r, const mp_limb_t *a);
+static int  GMPy_Mont_Cmp(const gmpy_mont_t *ctx, const mp_limb_t *a, const mp_limb_t *b);
+static int  GMPy_Mont_Is_Zero(const gmpy_mont_t *ctx, const mp_limb_t *a);
+static void GMPy_Mont_Lucas_UV(const gmpy_mont_t *ctx, mp_limb_t *u, mp_limb_t *v, mp_limb_t *qk,
+                               const mp_limb_t *p, const mp_limb_t *q, mpz_srcptr k);
+
+#ifdef GMPY_MONT_INT128
+static int  GMPy_Mont_Strong_PRP_Limb(mp_limb_t n, mp_limb_t a);
+static int  GMPy_Mont_Is_Prime_Limb(mp_limb_t n);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -29,93 +29,137 @@
  * License along with GMPY2; if not, see <http://www.gnu.org/licenses/>    *
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-/* ******************************************************************
- * mpz_prp: (also called a Fermat probable prime)
- * A "probable prime" to the base a is a number n such that,
- * (a,n)=1 and a^(n-1) = 1 mod n
- * ******************************************************************/
 
-PyDoc_STRVAR(doc_mpz_is_fermat_prp,
-"is_fermat_prp(n,a) -> boolean\n\n"
-"Return True if n is a Fermat probable prime to the base a.\n"
-"Assuming:\n"
-"    gcd(n,a) == 1\n"
-"Then a Fermat probable prime requires:\n"
-"    a**(n-1) == 1 (mod n)");
+/* The probable prime tests are implemented in two layers. The GMPy_MPZ_Is_*
+ * functions are the core of each test. They operate directly on mpz_t values,
+ * never touch Python objects, and return GMPY_PRP_COMPOSITE,
+ * GMPY_PRP_PROBABLE_PRIME, or one of the negative GMPY_PRP_ERROR_* codes if
+ * the arguments are not valid for the test. They are also exported through
+ * the C-API. The GMPY_mpz_is_* functions are thin Python wrappers that
+ * convert the arguments, call the core, and translate the result.
+ */
 
-static PyObject *
-GMPY_mpz_is_fermat_prp(PyObject *self, PyObject *args)
+/* Returned by _GMPy_PRP_Check_N() when n is odd and greater than 2. */
+
+#define GMPY_PRP_UNKNOWN 2
+
+/* Common checks for n: n must be positive, 1 is not prime, and 2 is the
+ * only even prime.
+ */
+
+static int
+_GMPy_PRP_Check_N(mpz_srcptr n)
 {
-    MPZ_Object *a, *n;
-    PyObject *result = 0;
-    mpz_t res, nm1;
+    if (mpz_sgn(n) <= 0)
+        return GMPY_PRP_ERROR_N;
 
-    if (PyTuple_Size(args) != 2) {
-        TYPE_ERROR("is_fermat_prp() requires 2 integer arguments");
-        return NULL;
-    }
+    if (mpz_cmp_ui(n, 1) == 0)
+        return GMPY_PRP_COMPOSITE;
 
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    a = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    if (!a || !n) {
-        TYPE_ERROR("is_fermat_prp() requires 2 integer arguments");
-        goto cleanup;
-    }
+    if (mpz_even_p(n))
+        return mpz_cmp_ui(n, 2) == 0 ? GMPY_PRP_PROBABLE_PRIME : GMPY_PRP_COMPOSITE;
 
-    mpz_init(res);
-    mpz_init(nm1);
+    return GMPY_PRP_UNKNOWN;
+}
 
-    /* Require a >= 2. */
-    if (mpz_cmp_ui(a->z, 2) < 0) {
-        VALUE_ERROR("is_fermat_prp() requires 'a' greater than or equal to 2");
-        goto cleanup;
-    }
+/* Return 0 if gcd(n, x) is 1 or n, otherwise return GMPY_PRP_ERROR_GCD. */
+
+static int
+_GMPy_PRP_Check_GCD(mpz_srcptr n, mpz_srcptr x)
+{
+    mpz_t g;
+    int result = 0;
+
+    mpz_init(g);
+    mpz_gcd(g, x, n);
+    if ((mpz_cmp(g, n) != 0) && (mpz_cmp_ui(g, 1) > 0))
+        result = GMPY_PRP_ERROR_GCD;
+    mpz_clear(g);
+    return result;
+}
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_fermat_prp() requires 'n' be greater than 0");
+/* Set d to p*p - 4*q and return 0, or return GMPY_PRP_ERROR_PQ if d is 0. */
+
+static int
+_GMPy_PRP_Lucas_D(mpz_ptr d, mpz_srcptr p, mpz_srcptr q)
+{
+    mpz_mul(d, p, p);
+    mpz_submul_ui(d, q, 4);
+    return mpz_sgn(d) ? 0 : GMPY_PRP_ERROR_PQ;
+}
+
+/* Validate the Lucas parameters p,q for n and compute n - Jacobi(D,n). The
+ * checks are made in the same order as the original Python-level functions.
+ */
+
+static int
+_GMPy_PRP_Lucas_Setup(mpz_ptr nmj, mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+{
+    mpz_t zD;
+    int ret;
+
+    mpz_init(zD);
+    if ((ret = _GMPy_PRP_Lucas_D(zD, p, q)) < 0)
         goto cleanup;
-    }
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
         goto cleanup;
-    }
 
-    /* Handle n even. */
-    /* Should n even raise an exception? */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
+    /* Check gcd(n, 2*q*D) */
+    mpz_mul(nmj, zD, q);
+    mpz_mul_2exp(nmj, nmj, 1);
+    if ((ret = _GMPy_PRP_Check_GCD(n, nmj)) < 0)
         goto cleanup;
-    }
+
+    /* nmj = n - (D/n), where (D/n) is the Jacobi symbol */
+    mpz_set(nmj, n);
+    ret = mpz_jacobi(zD, n);
+    if (ret == -1)
+        mpz_add_ui(nmj, nmj, 1);
+    else if (ret == 1)
+        mpz_sub_ui(nmj, nmj, 1);
+    ret = GMPY_PRP_UNKNOWN;
+
+  cleanup:
+    mpz_clear(zD);
+    return ret;
+}
+
+/* ******************************************************************
+ * mpz_prp: (also called a Fermat probable prime)
+ * A "probable prime" to the base a is a number n such that,
+ * (a,n)=1 and a^(n-1) = 1 mod n
+ * ******************************************************************/
+
+static int
+GMPy_MPZ_Is_Fermat_PRP(mpz_srcptr n, mpz_srcptr a)
+{
+    mpz_t res, nm1;
+    int ret;
+
+    /* Require a >= 2. */
+    if (mpz_cmp_ui(a, 2) < 0)
+        return GMPY_PRP_ERROR_A;
+
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
+        return ret;
 
     /* Check gcd(a,n) */
-    mpz_gcd(res, n->z, a->z);
+    mpz_init(res);
+    mpz_gcd(res, n, a);
     if (mpz_cmp_ui(res, 1) > 0) {
-        VALUE_ERROR("is_fermat_prp() requires gcd(n,a) == 1");
-        goto cleanup;
+        mpz_clear(res);
+        return GMPY_PRP_ERROR_GCD;
     }
 
-    mpz_set(nm1, n->z);
-    mpz_sub_ui(nm1, nm1, 1);
-    mpz_powm(res, a->z, nm1, n->z);
-
-    if (mpz_cmp_ui(res, 1) == 0)
-        result = Py_True;
-    else
-        result = Py_False;
+    mpz_init(nm1);
+    mpz_sub_ui(nm1, n, 1);
+    mpz_powm(res, a, nm1, n);
+    ret = mpz_cmp_ui(res, 1) == 0;
 
-  cleanup:
-    Py_XINCREF(result);
     mpz_clear(res);
     mpz_clear(nm1);
-    Py_XDECREF((PyObject*)a);
-    Py_XDECREF((PyObject*)n);
-    return result;
+    return ret;
 }
 
 /* *************************************************************************
@@ -124,99 +168,46 @@ GMPY_mpz_is_fermat_prp(PyObject *self, PyObject *args)
  * (a,n)=1 such that a^((n-1)/2)=(a/n) mod n [(a/n) is the Jacobi symbol]
  * *************************************************************************/
 
-PyDoc_STRVAR(doc_mpz_is_euler_prp,
-"is_euler_prp(n,a) -> boolean\n\n"
-"Return True if n is an Euler (also known as Solovay-Strassen)\n"
-"probable prime to the base a.\n"
-"Assuming:\n"
-"    gcd(n,a) == 1\n"
-"    n is odd\n"
-"Then an Euler probable prime requires:\n"
-"    a**((n-1)/2) == 1 (mod n)");
-
-static PyObject *
-GMPY_mpz_is_euler_prp(PyObject *self, PyObject *args)
+static int
+GMPy_MPZ_Is_Euler_PRP(mpz_srcptr n, mpz_srcptr a)
 {
-    MPZ_Object *a, *n;
-    PyObject *result = 0;
     mpz_t res, exp;
     int ret;
 
-    if (PyTuple_Size(args) != 2) {
-        TYPE_ERROR("is_euler_prp() requires 2 integer arguments");
-        return NULL;
-    }
-
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    a = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    if (!a || !n) {
-        TYPE_ERROR("is_euler_prp() requires 2 integer arguments");
-        goto cleanup;
-    }
-
-    mpz_init(res);
-    mpz_init(exp);
-
     /* Require a >= 2. */
-    if (mpz_cmp_ui(a->z, 2) < 0) {
-        VALUE_ERROR("is_euler_prp() requires 'a' greater than or equal to 2");
-        goto cleanup;
-    }
-
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_euler_prp() requires 'n' be greater than 0");
-        goto cleanup;
-    }
+    if (mpz_cmp_ui(a, 2) < 0)
+        return GMPY_PRP_ERROR_A;
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
-
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
+        return ret;
 
-    /* Check gcd(a,b) */
-    mpz_gcd(res, n->z, a->z);
+    /* Check gcd(a,n) */
+    mpz_init(res);
+    mpz_gcd(res, n, a);
     if (mpz_cmp_ui(res, 1) > 0) {
-        VALUE_ERROR("is_euler_prp() requires gcd(n,a) == 1");
-        goto cleanup;
+        mpz_clear(res);
+        return GMPY_PRP_ERROR_GCD;
     }
 
-    mpz_set(exp, n->z);
-    mpz_sub_ui(exp, exp, 1);
+    mpz_init(exp);
+    mpz_sub_ui(exp, n, 1);
     mpz_divexact_ui(exp, exp, 2);
-    mpz_powm(res, a->z, exp, n->z);
+    mpz_powm(res, a, exp, n);
 
     /* reuse exp to calculate jacobi(a,n) mod n */
-    ret = mpz_jacobi(a->z,n->z);
-    mpz_set(exp, n->z);
+    ret = mpz_jacobi(a, n);
+    mpz_set(exp, n);
     if (ret == -1)
         mpz_sub_ui(exp, exp, 1);
     else if (ret == 1)
         mpz_add_ui(exp, exp, 1);
-    mpz_mod(exp, exp, n->z);
+    mpz_mod(exp, exp, n);
 
-    if (mpz_cmp(res, exp) == 0)
-        result = Py_True;
-    else
-        result = Py_False;
+    ret = mpz_cmp(res, exp) == 0;
 
-  cleanup:
-    Py_XINCREF(result);
     mpz_clear(res);
     mpz_clear(exp);
-    Py_XDECREF((PyObject*)a);
-    Py_XDECREF((PyObject*)n);
-    return result;
+    return ret;
 }
 
 /* *********************************************************************************************
@@ -225,112 +216,99 @@ GMPY_mpz_is_euler_prp(PyObject *self, PyObject *args)
  * either a^s == 1 mod n, or a^((2^t)*s) == -1 mod n, for some integer t, with 0 <= t < r.
  * *********************************************************************************************/
 
-PyDoc_STRVAR(doc_mpz_is_strong_prp,
-"is_strong_prp(n,a) -> boolean\n\n"
-"Return True if n is an strong (also known as Miller-Rabin)\n"
-"probable prime to the base a.\n"
-"Assuming:\n"
-"    gcd(n,a) == 1\n"
-"    n is odd\n"
-"    n = s*(2**r) + 1, with s odd\n"
-"Then a strong probable prime requires one of the following is true:\n"
-"    a**s == 1 (mod n)\n"
-"    or\n"
-"    a**(s*(2**t)) == -1 (mod n) for some t, 0 <= t < r.");
+/* Check the arguments of the strong test. Returns GMPY_PRP_UNKNOWN if n is
+ * odd, greater than 2, and coprime to a so the test must be run. Otherwise
+ * the result of the test or an error code is returned.
+ */
 
-static PyObject *
-GMPY_mpz_is_strong_prp(PyObject *self, PyObject *args)
+static int
+_GMPy_PRP_Strong_Check(mpz_srcptr n, mpz_srcptr a)
 {
-    MPZ_Object *a, *n;
-    PyObject *result = 0;
-    mpz_t s, nm1, mpz_test;
-    mp_bitcnt_t r = 0;
-
-    if (PyTuple_Size(args) != 2) {
-        TYPE_ERROR("is_strong_prp() requires 2 integer arguments");
-        return NULL;
-    }
+    mpz_t g;
+    int ret;
 
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    a = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    if (!a || !n) {
-        TYPE_ERROR("is_strong_prp() requires 2 integer arguments");
-        goto cleanup;
-    }
+    /* Require a >= 2. */
+    if (mpz_cmp_ui(a, 2) < 0)
+        return GMPY_PRP_ERROR_A;
 
-    mpz_init(s);
-    mpz_init(nm1);
-    mpz_init(mpz_test);
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
+        return ret;
 
-    /* Require a >= 2. */
-    if (mpz_cmp_ui(a->z, 2) < 0) {
-        VALUE_ERROR("is_strong_prp() requires 'a' greater than or equal to 2");
-        goto cleanup;
-    }
+    /* Check gcd(a,n) */
+    mpz_init(g);
+    mpz_gcd(g, n, a);
+    ret = mpz_cmp_ui(g, 1) > 0 ? GMPY_PRP_ERROR_GCD : GMPY_PRP_UNKNOWN;
+    mpz_clear(g);
+    return ret;
+}
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_strong_prp() requires 'n' be greater than 0");
-        goto cleanup;
-    }
+/* The strong test for arguments accepted by _GMPy_PRP_Strong_Check(). If
+ * cancel is not NULL, it is checked between the squarings and the test gives
+ * up, returning GMPY_PRP_COMPOSITE, once another thread has set it.
+ */
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
+static int
+_GMPy_PRP_Strong_Test(mpz_srcptr n, mpz_srcptr a, volatile int *cancel)
+{
+    mpz_t s, nm1, mpz_test;
+    mp_bitcnt_t r = 0;
+    int ret;
 
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
+    mpz_init(s);
 
-    /* Check gcd(a,b) */
-    mpz_gcd(s, n->z, a->z);
-    if (mpz_cmp_ui(s, 1) > 0) {
-        VALUE_ERROR("is_strong_prp() requires gcd(n,a) == 1");
-        goto cleanup;
+#ifdef GMPY_MONT_INT128
+    /* Use the word sized test when n fits in one limb. */
+    if (mpz_size(n) == 1) {
+        mpz_mod(s, a, n);
+        ret = GMPy_Mont_Strong_PRP_Limb(mpz_getlimbn(n, 0), mpz_getlimbn(s, 0));
+        mpz_clear(s);
+        return ret;
     }
+#endif
 
-    mpz_set(nm1, n->z);
-    mpz_sub_ui(nm1, nm1, 1);
+    mpz_init(nm1);
+    mpz_init(mpz_test);
+    mpz_sub_ui(nm1, n, 1);
 
     /* Find s and r satisfying: n-1=(2^r)*s, s odd */
     r = mpz_scan1(nm1, 0);
     mpz_fdiv_q_2exp(s, nm1, r);
 
-
     /* Check a^((2^t)*s) mod n for 0 <= t < r */
-    mpz_powm(mpz_test, a->z, s, n->z);
-    if ((mpz_cmp_ui(mpz_test, 1) == 0) || (mpz_cmp(mpz_test, nm1) == 0)) {
-        result = Py_True;
+    ret = GMPY_PRP_PROBABLE_PRIME;
+    mpz_powm(mpz_test, a, s, n);
+    if ((mpz_cmp_ui(mpz_test, 1) == 0) || (mpz_cmp(mpz_test, nm1) == 0))
         goto cleanup;
-    }
 
     while (--r) {
+        if (cancel && *cancel)
+            break;
+
         /* mpz_test = mpz_test^2%n */
         mpz_mul(mpz_test, mpz_test, mpz_test);
-        mpz_mod(mpz_test, mpz_test, n->z);
+        mpz_mod(mpz_test, mpz_test, n);
 
-        if (mpz_cmp(mpz_test, nm1) == 0) {
-            result = Py_True;
+        if (mpz_cmp(mpz_test, nm1) == 0)
             goto cleanup;
-        }
     }
+    ret = GMPY_PRP_COMPOSITE;
 
-    result = Py_False;
   cleanup:
-    Py_XINCREF(result);
     mpz_clear(s);
     mpz_clear(nm1);
     mpz_clear(mpz_test);
-    Py_XDECREF((PyObject*)a);
-    Py_XDECREF((PyObject*)n);
-    return result;
+    return ret;
+}
+
+static int
+GMPy_MPZ_Is_Strong_PRP(mpz_srcptr n, mpz_srcptr a)
+{
+    int ret;
+
+    if ((ret = _GMPy_PRP_Strong_Check(n, a)) != GMPY_PRP_UNKNOWN)
+        return ret;
+
+    return _GMPy_PRP_Strong_Test(n, a, NULL);
 }
 
 /* *************************************************************************
@@ -340,1100 +318,946 @@ GMPY_mpz_is_strong_prp(PyObject *self, PyObject *args)
  * [V is the Lucas V sequence with parameters P,Q]
  * *************************************************************************/
 
-PyDoc_STRVAR(doc_mpz_is_fibonacci_prp,
-"is_fibonacci_prp(n,p,q) -> boolean\n\n"
-"Return True if n is an Fibonacci probable prime with parameters (p,q).\n"
-"Assuming:\n"
-"    n is odd\n"
-"    p > 0, q = +/-1\n"
-"    p*p - 4*q != 0\n"
-"Then a Fibonacci probable prime requires:\n"
-"    lucasv(p,q,n) == p (mod n).");
-
-static PyObject *
-GMPY_mpz_is_fibonacci_prp(PyObject *self, PyObject *args)
+static int
+GMPy_MPZ_Is_Fibonacci_PRP(mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
 {
-    MPZ_Object *n, *p, *q;
-    PyObject *result = 0;
-    mpz_t pmodn, zP;
-    /* used for calculating the Lucas V sequence */
-    mpz_t vl, vh, ql, qh, tmp;
-    mp_bitcnt_t s = 0, j = 0;
-
-    if (PyTuple_Size(args) != 3) {
-        TYPE_ERROR("is_fibonacci_prp() requires 3 integer arguments");
-        return NULL;
-    }
+    mpz_t pmodn, vn;
+    int ret;
+
+    /* Check if p*p - 4*q == 0. */
+    mpz_init(vn);
+    ret = _GMPy_PRP_Lucas_D(vn, p, q);
+    mpz_clear(vn);
+    if (ret < 0)
+        return ret;
+
+    /* Verify q = +/-1 */
+    if ((mpz_cmp_si(q, 1) && mpz_cmp_si(q, -1)) || (mpz_sgn(p) <= 0))
+        return GMPY_PRP_ERROR_PQ;
+
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
+        return ret;
 
     mpz_init(pmodn);
-    mpz_init(zP);
-    mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
-
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
-    if (!n || !p || !q) {
-        TYPE_ERROR("is_fibonacci_prp() requires 3 integer arguments");
-        goto cleanup;
-    }
+    mpz_init(vn);
+    mpz_mod(pmodn, p, n);
+    GMPy_MPZ_Lucas_UV(NULL, vn, NULL, p, q, n, n);
+    ret = mpz_cmp(vn, pmodn) == 0;
+    mpz_clear(pmodn);
+    mpz_clear(vn);
+    return ret;
+}
 
-    /* Check if p*p - 4*q == 0. */
+/* *******************************************************************************
+ * mpz_lucas_prp:
+ * A "Lucas probable prime" with parameters (P,Q) is a composite n with D=P^2-4Q,
+ * (n,2QD)=1 such that U_(n-(D/n)) == 0 mod n [(D/n) is the Jacobi symbol]
+ * *******************************************************************************/
 
-    mpz_mul(tmp, p->z, p->z);
-    mpz_mul_ui(qh, q->z, 4);
-    mpz_sub(tmp, tmp, qh);
-    if (mpz_sgn(tmp) == 0) {
-        VALUE_ERROR("invalid values for p,q in is_fibonacci_prp()");
-        goto cleanup;
+static int
+GMPy_MPZ_Is_Lucas_PRP(mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+{
+    mpz_t index;
+    int ret;
+
+    mpz_init(index);
+    if ((ret = _GMPy_PRP_Lucas_Setup(index, n, p, q)) == GMPY_PRP_UNKNOWN) {
+        GMPy_MPZ_Lucas_UV(index, NULL, NULL, p, q, index, n);
+        ret = mpz_sgn(index) == 0;
     }
+    mpz_clear(index);
+    return ret;
+}
 
-    /* Verify q = +/-1 */
+/* *********************************************************************************************
+ * mpz_stronglucas_prp:
+ * A "strong Lucas probable prime" with parameters (P,Q) is a composite n = (2^r)*s+(D/n), where
+ * s is odd, D=P^2-4Q, and (n,2QD)=1 such that either U_s == 0 mod n or V_((2^t)*s) == 0 mod n
+ * for some t, 0 <= t < r. [(D/n) is the Jacobi symbol]
+ * *********************************************************************************************/
 
-    if ((mpz_cmp_si(q->z, 1) && mpz_cmp_si(q->z, -1)) || (mpz_sgn(p->z) <= 0)) {
-        VALUE_ERROR("invalid values for p,q in is_fibonacci_prp()");
-        goto cleanup;
-    }
+static int
+GMPy_MPZ_Is_StrongLucas_PRP(mpz_srcptr n, mpz_srcptr p, mpz_srcptr q)
+{
+    mpz_t s, uh, vl, ql;
+    mp_bitcnt_t r = 0, j = 0;
+    gmpy_mont_t ctx;
+    int ret;
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_fibonacci_prp() requires 'n' be greater than 0");
-        goto cleanup;
+    mpz_init(s);
+    if ((ret = _GMPy_PRP_Lucas_Setup(s, n, p, q)) != GMPY_PRP_UNKNOWN) {
+        mpz_clear(s);
+        return ret;
     }
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
+    r = mpz_scan1(s, 0);
+    mpz_fdiv_q_2exp(s, s, r);
 
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
+    /* make sure U_s == 0 mod n or V_((2^t)*s) == 0 mod n, for some t, 0 <= t < r */
+    mpz_init(uh);
+    mpz_init(vl);
+    mpz_init(ql);
 
-    mpz_set(zP, p->z);
-    mpz_mod(pmodn, zP, n->z);
-
-    /* mpz_lucasvmod(res, p, q, n, n); */
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp,0);
-
-    s = mpz_scan1(n->z, 0);
-    for (j = mpz_sizeinbase(n->z,2)-1; j >= s+1; j--) {
-        /* ql = ql*qh (mod n) */
-        mpz_mul(ql, ql, qh);
-        mpz_mod(ql, ql, n->z);
-        if (mpz_tstbit(n->z,j) == 1) {
-            /* qh = ql*q */
-            mpz_mul(qh, ql, q->z);
-
-            /* vl = vh*vl - p*ql (mod n) */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-
-            /* vh = vh*vh - 2*qh (mod n) */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
-        }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
+    ret = GMPY_PRP_PROBABLE_PRIME;
+    if (GMPy_Mont_Init(&ctx, n)) {
+        gmpy_mont_limbs mp, mq, mu, mv, mql, mtmp;
 
-            /* vh = vh*vl - p*ql (mod n) */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
+        GMPy_Mont_To(&ctx, mp, p);
+        GMPy_Mont_To(&ctx, mq, q);
+        GMPy_Mont_Lucas_UV(&ctx, mu, mv, mql, mp, mq, s);
+        if (GMPy_Mont_Is_Zero(&ctx, mu) || GMPy_Mont_Is_Zero(&ctx, mv))
+            goto cleanup;
 
+        for (j = 1; j < r; j++) {
             /* vl = vl*vl - 2*ql (mod n) */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-        }
-    }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
+            GMPy_Mont_Mul(&ctx, mv, mv, mv);
+            GMPy_Mont_Add(&ctx, mtmp, mql, mql);
+            GMPy_Mont_Sub(&ctx, mv, mv, mtmp);
 
-    /* qh = ql*q */
-    mpz_mul(qh, ql, q->z);
+            /* ql = ql*ql (mod n) */
+            GMPy_Mont_Mul(&ctx, mql, mql, mql);
 
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
+            if (GMPy_Mont_Is_Zero(&ctx, mv))
+                goto cleanup;
+        }
+        ret = GMPY_PRP_COMPOSITE;
+        goto cleanup;
+    }
 
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
+    GMPy_MPZ_Lucas_UV(uh, vl, ql, p, q, s, n);
+    if ((mpz_sgn(uh) == 0) || (mpz_sgn(vl) == 0))
+        goto cleanup;
 
-    for (j = 1; j <= s; j++) {
+    for (j = 1; j < r; j++) {
         /* vl = vl*vl - 2*ql (mod n) */
         mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-        mpz_mod(vl, vl, n->z);
+        mpz_submul_ui(vl, ql, 2);
+        mpz_mod(vl, vl, n);
 
         /* ql = ql*ql (mod n) */
         mpz_mul(ql, ql, ql);
-        mpz_mod(ql, ql, n->z);
-    }
-
-    /* vl contains our return value */
-    mpz_mod(vl, vl, n->z);
+        mpz_mod(ql, ql, n);
 
-    if (mpz_cmp(vl, pmodn) == 0)
-        result = Py_True;
-    else
-        result = Py_False;
+        if (mpz_sgn(vl) == 0)
+            goto cleanup;
+    }
+    ret = GMPY_PRP_COMPOSITE;
 
   cleanup:
-    Py_XINCREF(result);
-    mpz_clear(pmodn);
-    mpz_clear(zP);
+    mpz_clear(s);
+    mpz_clear(uh);
     mpz_clear(vl);
-    mpz_clear(vh);
     mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)q);
-    Py_XDECREF((PyObject*)n);
-    return result;
+    return ret;
 }
 
+/* *******************************************************************************************
+ * mpz_extrastronglucas_prp:
+ * Let U_n = LucasU(p,1), V_n = LucasV(p,1), and D=p^2-4.
+ * An "extra strong Lucas probable prime" to the base p is a composite n = (2^r)*s+(D/n), where
+ * s is odd and (n,2D)=1, such that either U_s == 0 mod n or V_s == +/-2 mod n, or
+ * V_((2^t)*s) == 0 mod n for some t with 0 <= t < r-1 [(D/n) is the Jacobi symbol]
+ * *******************************************************************************************/
 
-/* *******************************************************************************
- * mpz_lucas_prp:
- * A "Lucas probable prime" with parameters (P,Q) is a composite n with D=P^2-4Q,
- * (n,2QD)=1 such that U_(n-(D/n)) == 0 mod n [(D/n) is the Jacobi symbol]
- * *******************************************************************************/
-
-PyDoc_STRVAR(doc_mpz_is_lucas_prp,
-"is_lucas_prp(n,p,q) -> boolean\n\n"
-"Return True if n is a Lucas probable prime with parameters (p,q).\n"
-"Assuming:\n"
-"    n is odd\n"
-"    D = p*p - 4*q, D != 0\n"
-"    gcd(n, 2*q*D) == 1\n"
-"Then a Lucas probable prime requires:\n"
-"    lucasu(p,q,n - Jacobi(D,n)) == 0 (mod n)");
-
-static PyObject *
-GMPY_mpz_is_lucas_prp(PyObject *self, PyObject *args)
+static int
+GMPy_MPZ_Is_ExtraStrongLucas_PRP(mpz_srcptr n, mpz_srcptr p)
 {
-    MPZ_Object *n, *p, *q;
-    PyObject *result = 0;
-    mpz_t zD, res, index;
-    /* used for calculating the Lucas U sequence */
-    mpz_t uh, vl, vh, ql, qh, tmp;
-    mp_bitcnt_t s = 0, j = 0;
+    mpz_t one, s, nm2, uh, vl;
+    mp_bitcnt_t r = 0, j = 0;
+    gmpy_mont_t ctx;
     int ret;
 
-    if (PyTuple_Size(args) != 3) {
-        TYPE_ERROR("is_lucas_prp() requires 3 integer arguments");
-        return NULL;
+    /* Setting q = 1 gives D = p*p - 4 and gcd(n, 2*q*D) = gcd(n, 2*D). */
+    mpz_init_set_ui(one, 1);
+    mpz_init(s);
+    if ((ret = _GMPy_PRP_Lucas_Setup(s, n, p, one)) != GMPY_PRP_UNKNOWN) {
+        mpz_clear(one);
+        mpz_clear(s);
+        return ret;
     }
 
-    mpz_init(zD);
-    mpz_init(res);
-    mpz_init(index);
+    r = mpz_scan1(s, 0);
+    mpz_fdiv_q_2exp(s, s, r);
+
+    mpz_init(nm2);
+    mpz_sub_ui(nm2, n, 2);
+
+    /* make sure that either U_s == 0 mod n or V_s == +/-2 mod n, or */
+    /* V_((2^t)*s) == 0 mod n for some t with 0 <= t < r-1           */
     mpz_init(uh);
     mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
-
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
-    if (!n || !p || !q) {
-        TYPE_ERROR("is_lucas_prp() requires 3 integer arguments");
-        goto cleanup;
-    }
 
-    /* Check if p*p - 4*q == 0. */
-    mpz_mul(zD, p->z, p->z);
-    mpz_mul_ui(tmp, q->z, 4);
-    mpz_sub(zD, zD, tmp);
-    if (mpz_sgn(zD) == 0) {
-        VALUE_ERROR("invalid values for p,q in is_lucas_prp()");
-        goto cleanup;
-    }
+    ret = GMPY_PRP_PROBABLE_PRIME;
+    if (GMPy_Mont_Init(&ctx, n)) {
+        gmpy_mont_limbs mp, mu, mv, mtwo, mnm2, zero = {0};
+
+        GMPy_Mont_Add(&ctx, mtwo, ctx.one, ctx.one);
+        GMPy_Mont_Sub(&ctx, mnm2, zero, mtwo);
+        GMPy_Mont_To(&ctx, mp, p);
+        GMPy_Mont_Lucas_UV(&ctx, mu, mv, NULL, mp, ctx.one, s);
+        if (GMPy_Mont_Is_Zero(&ctx, mu) || GMPy_Mont_Is_Zero(&ctx, mv) ||
+            (GMPy_Mont_Cmp(&ctx, mv, mnm2) == 0) ||
+            (GMPy_Mont_Cmp(&ctx, mv, mtwo) == 0))
+            goto cleanup;
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_lucas_prp() requires 'n' be greater than 0");
-        goto cleanup;
-    }
+        for (j = 1; j + 1 < r; j++) {
+            /* vl = vl*vl - 2 (mod n) */
+            GMPy_Mont_Mul(&ctx, mv, mv, mv);
+            GMPy_Mont_Sub(&ctx, mv, mv, mtwo);
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
+            if (GMPy_Mont_Is_Zero(&ctx, mv))
+                goto cleanup;
+        }
+        ret = GMPY_PRP_COMPOSITE;
         goto cleanup;
     }
 
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
+    GMPy_MPZ_Lucas_UV(uh, vl, NULL, p, one, s, n);
+    if ((mpz_sgn(uh) == 0) || (mpz_sgn(vl) == 0) ||
+        (mpz_cmp(vl, nm2) == 0) || (mpz_cmp_si(vl, 2) == 0))
         goto cleanup;
-    }
 
-    /* Check GCD */
-    mpz_mul(res, zD, q->z);
-    mpz_mul_ui(res, res, 2);
-    mpz_gcd(res, res, n->z);
-    if ((mpz_cmp(res, n->z) != 0) && (mpz_cmp_ui(res, 1) > 0)) {
-        VALUE_ERROR("is_lucas_prp() requires gcd(n,2*q*D) == 1");
-        goto cleanup;
+    for (j = 1; j + 1 < r; j++) {
+        /* vl = vl*vl - 2 (mod n) */
+        mpz_mul(vl, vl, vl);
+        mpz_sub_ui(vl, vl, 2);
+        mpz_mod(vl, vl, n);
+
+        if (mpz_sgn(vl) == 0)
+            goto cleanup;
     }
+    ret = GMPY_PRP_COMPOSITE;
 
-    /* index = n-(D/n), where (D/n) is the Jacobi symbol */
-    mpz_set(index, n->z);
-    ret = mpz_jacobi(zD, n->z);
-    if (ret == -1)
-        mpz_add_ui(index, index, 1);
-    else if (ret == 1)
-        mpz_sub_ui(index, index, 1);
-
-    /* mpz_lucasumod(res, p, q, index, n); */
-    mpz_set_si(uh, 1);
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp,0);
-
-    s = mpz_scan1(index, 0);
-    for (j = mpz_sizeinbase(index,2)-1; j >= s+1; j--) {
-        /* ql = ql*qh (mod n) */
-        mpz_mul(ql, ql, qh);
-        mpz_mod(ql, ql, n->z);
-        if (mpz_tstbit(index,j) == 1) {
-            /* qh = ql*q */
-            mpz_mul(qh, ql, q->z);
-
-            /* uh = uh*vh (mod n) */
-            mpz_mul(uh, uh, vh);
-            mpz_mod(uh, uh, n->z);
-
-            /* vl = vh*vl - p*ql (mod n) */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-
-            /* vh = vh*vh - 2*qh (mod n) */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
-        }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
+  cleanup:
+    mpz_clear(one);
+    mpz_clear(s);
+    mpz_clear(nm2);
+    mpz_clear(uh);
+    mpz_clear(vl);
+    return ret;
+}
 
-            /* uh = uh*vl - ql (mod n) */
-            mpz_mul(uh, uh, vl);
-            mpz_sub(uh, uh, ql);
-            mpz_mod(uh, uh, n->z);
+/* ***********************************************************************************************
+ * mpz_selfridge_prp:
+ * A "Lucas-Selfridge probable prime" n is a "Lucas probable prime" using Selfridge parameters of:
+ * Find the first element D in the sequence {5, -7, 9, -11, 13, ...} such that Jacobi(D,n) = -1
+ * Then use P=1 and Q=(1-D)/4 in the Lucas probable prime test.
+ * Make sure n is not a perfect square, otherwise the search for D will only stop when D=n.
+ * ***********************************************************************************************/
 
-            /* vh = vh*vl - p*ql (mod n) */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
+/* Find the Selfridge parameters for n. Returns GMPY_PRP_UNKNOWN and sets p
+ * and q if they were found, otherwise returns the result of the test or
+ * GMPY_PRP_ERROR_D.
+ */
 
-            /* vl = vl*vl - 2*ql (mod n) */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-        }
-    }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
+static int
+_GMPy_PRP_Selfridge_PQ(mpz_ptr p, mpz_ptr q, mpz_srcptr n)
+{
+    long d = 5, max_d = 1000000;
+    int jacobi = 0, ret;
+    mpz_t zD;
 
-    /* qh = ql*q */
-    mpz_mul(qh, ql, q->z);
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
+        return ret;
 
-    /* uh = uh*vl - ql */
-    mpz_mul(uh, uh, vl);
-    mpz_sub(uh, uh, ql);
+    mpz_init_set_ui(zD, d);
 
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
+    while (1) {
+        jacobi = mpz_jacobi(zD, n);
 
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
+        /* if jacobi == 0, d is a factor of n, therefore n is composite... */
+        /* if d == n, then either n is either prime or 9... */
+        if (jacobi == 0) {
+            if ((mpz_cmpabs(zD, n) == 0) && (mpz_cmp_ui(zD, 9) != 0))
+                ret = GMPY_PRP_PROBABLE_PRIME;
+            else
+                ret = GMPY_PRP_COMPOSITE;
+            goto cleanup;
+        }
+        if (jacobi == -1)
+            break;
 
-    for (j = 1; j <= s; j++) {
-        /* uh = uh*vl (mod n) */
-        mpz_mul(uh, uh, vl);
-        mpz_mod(uh, uh, n->z);
+        /* if we get to the 5th d, make sure we aren't dealing with a square... */
+        if (d == 13) {
+            if (mpz_perfect_square_p(n)) {
+                ret = GMPY_PRP_COMPOSITE;
+                goto cleanup;
+            }
+        }
 
-        /* vl = vl*vl - 2*ql (mod n) */
-        mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-        mpz_mod(vl, vl, n->z);
+        if (d < 0) {
+            d *= -1;
+            d += 2;
+        }
+        else {
+            d += 2;
+            d *= -1;
+        }
 
-        /* ql = ql*ql (mod n) */
-        mpz_mul(ql, ql, ql);
-        mpz_mod(ql, ql, n->z);
+        /* make sure we don't search forever */
+        if (d >= max_d) {
+            ret = GMPY_PRP_ERROR_D;
+            goto cleanup;
+        }
+
+        mpz_set_si(zD, d);
     }
 
-    /* uh contains our return value */
-    mpz_mod(res, uh, n->z);
-    if (mpz_cmp_ui(res, 0) == 0)
-        result = Py_True;
-    else
-        result = Py_False;
+    mpz_set_ui(p, 1);
+    mpz_set_si(q, (1-d)/4);
+    ret = GMPY_PRP_UNKNOWN;
 
   cleanup:
-    Py_XINCREF(result);
     mpz_clear(zD);
-    mpz_clear(res);
-    mpz_clear(index);
-    mpz_clear(uh);
-    mpz_clear(vl);
-    mpz_clear(vh);
-    mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)q);
-    Py_XDECREF((PyObject*)n);
-    return result;
+    return ret;
 }
 
-/* *********************************************************************************************
- * mpz_stronglucas_prp:
- * A "strong Lucas probable prime" with parameters (P,Q) is a composite n = (2^r)*s+(D/n), where
- * s is odd, D=P^2-4Q, and (n,2QD)=1 such that either U_s == 0 mod n or V_((2^t)*s) == 0 mod n
- * for some t, 0 <= t < r. [(D/n) is the Jacobi symbol]
- * *********************************************************************************************/
+static int
+GMPy_MPZ_Is_Selfridge_PRP(mpz_srcptr n)
+{
+    mpz_t p, q;
+    int ret;
 
-PyDoc_STRVAR(doc_mpz_is_stronglucas_prp,
-"is_strong_lucas_prp(n,p,q) -> boolean\n\n"
-"Return True if n is a strong Lucas probable prime with parameters (p,q).\n"
-"Assuming:\n"
-"    n is odd\n"
-"    D = p*p - 4*q, D != 0\n"
-"    gcd(n, 2*q*D) == 1\n"
-"    n = s*(2**r) + Jacobi(D,n), s odd\n"
-"Then a strong Lucas probable prime requires:\n"
-"    lucasu(p,q,s) == 0 (mod n)\n"
-"    or\n"
-"    lucasv(p,q,s*(2**t)) == 0 (mod n) for some t, 0 <= t < r");
+    mpz_init(p);
+    mpz_init(q);
+    if ((ret = _GMPy_PRP_Selfridge_PQ(p, q, n)) == GMPY_PRP_UNKNOWN)
+        ret = GMPy_MPZ_Is_Lucas_PRP(n, p, q);
+    mpz_clear(p);
+    mpz_clear(q);
+    return ret;
+}
 
-static PyObject *
-GMPY_mpz_is_stronglucas_prp(PyObject *self, PyObject *args)
+/* *********************************************************************************************************
+ * mpz_strongselfridge_prp:
+ * A "strong Lucas-Selfridge probable prime" n is a "strong Lucas probable prime" using Selfridge parameters of:
+ * Find the first element D in the sequence {5, -7, 9, -11, 13, ...} such that Jacobi(D,n) = -1
+ * Then use P=1 and Q=(1-D)/4 in the strong Lucas probable prime test.
+ * Make sure n is not a perfect square, otherwise the search for D will only stop when D=n.
+ * **********************************************************************************************************/
+
+static int
+GMPy_MPZ_Is_StrongSelfridge_PRP(mpz_srcptr n)
 {
-    MPZ_Object *n, *p, *q;
-    PyObject *result = 0;
-    mpz_t zD, s, nmj, res;
-    /* these are needed for the LucasU and LucasV part of this function */
-    mpz_t uh, vl, vh, ql, qh, tmp;
-    mp_bitcnt_t r = 0, j = 0;
-    int ret = 0;
+    mpz_t p, q;
+    int ret;
 
-    if (PyTuple_Size(args) != 3) {
-        TYPE_ERROR("is_strong_lucas_prp() requires 3 integer arguments");
-        return NULL;
-    }
+    mpz_init(p);
+    mpz_init(q);
+    if ((ret = _GMPy_PRP_Selfridge_PQ(p, q, n)) == GMPY_PRP_UNKNOWN)
+        ret = GMPy_MPZ_Is_StrongLucas_PRP(n, p, q);
+    mpz_clear(p);
+    mpz_clear(q);
+    return ret;
+}
 
-    mpz_init(zD);
-    mpz_init(s);
-    mpz_init(nmj);
-    mpz_init(res);
-    mpz_init(uh);
-    mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
-
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    q = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 2), NULL);
-    if (!n || !p || !q) {
-        TYPE_ERROR("is_strong_lucas_prp() requires 3 integer arguments");
-        goto cleanup;
-    }
+/* **********************************************************************************
+ * mpz_bpsw_prp:
+ * A "Baillie-Pomerance-Selfridge-Wagstaff probable prime" is a composite n such that
+ * n is a strong probable prime to the base 2 and
+ * n is a Lucas probable prime using the Selfridge parameters.
+ * **********************************************************************************/
 
-    /* Check if p*p - 4*q == 0. */
-    mpz_mul(zD, p->z, p->z);
-    mpz_mul_ui(tmp, q->z, 4);
-    mpz_sub(zD, zD, tmp);
-    if (mpz_sgn(zD) == 0) {
-        VALUE_ERROR("invalid values for p,q in is_strong_lucas_prp()");
-        goto cleanup;
-    }
+static int
+GMPy_MPZ_Is_BPSW_PRP(mpz_srcptr n)
+{
+    mpz_t two;
+    int ret;
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_strong_lucas_prp() requires 'n' be greater than 0");
-        goto cleanup;
-    }
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
+        return ret;
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
+    mpz_init_set_ui(two, 2);
+    ret = GMPy_MPZ_Is_Strong_PRP(n, two);
+    mpz_clear(two);
+    if (ret != GMPY_PRP_PROBABLE_PRIME)
+        return ret;
 
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
+    return GMPy_MPZ_Is_Selfridge_PRP(n);
+}
 
-    /* Check GCD */
-    mpz_mul(res, zD, q->z);
-    mpz_mul_ui(res, res, 2);
-    mpz_gcd(res, res, n->z);
-    if ((mpz_cmp(res, n->z) != 0) && (mpz_cmp_ui(res, 1) > 0)) {
-        VALUE_ERROR("is_strong_lucas_prp() requires gcd(n,2*q*D) == 1");
-        goto cleanup;
-    }
+/* ****************************************************************************************
+ * mpz_strongbpsw_prp:
+ * A "strong Baillie-Pomerance-Selfridge-Wagstaff probable prime" is a composite n such that
+ * n is a strong probable prime to the base 2 and
+ * n is a strong Lucas probable prime using the Selfridge parameters.
+ * ****************************************************************************************/
 
-    /* nmj = n - (D/n), where (D/n) is the Jacobi symbol */
-    mpz_set(nmj, n->z);
-    ret = mpz_jacobi(zD, n->z);
-    if (ret == -1)
-        mpz_add_ui(nmj, nmj, 1);
-    else if (ret == 1)
-        mpz_sub_ui(nmj, nmj, 1);
+static int
+GMPy_MPZ_Is_StrongBPSW_PRP(mpz_srcptr n)
+{
+    mpz_t two;
+    int ret;
 
-    r = mpz_scan1(nmj, 0);
-    mpz_fdiv_q_2exp(s, nmj, r);
+    if ((ret = _GMPy_PRP_Check_N(n)) != GMPY_PRP_UNKNOWN)
+        return ret;
 
-    /* make sure U_s == 0 mod n or V_((2^t)*s) == 0 mod n, for some t, 0 <= t < r */
-    mpz_set_si(uh, 1);
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp,0);
-
-    for (j = mpz_sizeinbase(s,2)-1; j >= 1; j--) {
-        /* ql = ql*qh (mod n) */
-        mpz_mul(ql, ql, qh);
-        mpz_mod(ql, ql, n->z);
-        if (mpz_tstbit(s,j) == 1) {
-            /* qh = ql*q */
-            mpz_mul(qh, ql, q->z);
-
-            /* uh = uh*vh (mod n) */
-            mpz_mul(uh, uh, vh);
-            mpz_mod(uh, uh, n->z);
-
-            /* vl = vh*vl - p*ql (mod n) */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-
-            /* vh = vh*vh - 2*qh (mod n) */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
-        }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
+    mpz_init_set_ui(two, 2);
+    ret = GMPy_MPZ_Is_Strong_PRP(n, two);
+    mpz_clear(two);
+    if (ret != GMPY_PRP_PROBABLE_PRIME)
+        return ret;
 
-            /* uh = uh*vl - ql (mod n) */
-            mpz_mul(uh, uh, vl);
-            mpz_sub(uh, uh, ql);
-            mpz_mod(uh, uh, n->z);
+    return GMPy_MPZ_Is_StrongSelfridge_PRP(n);
+}
 
-            /* vh = vh*vl - p*ql (mod n) */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
+/* Run a list of independent tests on n, possibly concurrently. Each entry
+ * of bases is either the base for a strong test or NULL for the strong Lucas
+ * test with the Selfridge parameters. n must be odd, greater than 2, and
+ * coprime to every base. Returns GMPY_PRP_PROBABLE_PRIME if n passes every
+ * test and GMPY_PRP_COMPOSITE otherwise.
+ *
+ * Up to threads - 1 worker threads are started and the calling thread also
+ * takes tests from the list. Once a test fails, no new tests are started and
+ * the strong tests still running stop at their next squaring. Only GMP is
+ * used so this function may, and should, be called without the GIL.
+ */
+
+static int
+_GMPy_PRP_Run_Test(mpz_srcptr n, mpz_srcptr a, volatile int *cancel)
+{
+    if (a)
+        return _GMPy_PRP_Strong_Test(n, a, cancel);
+    return GMPy_MPZ_Is_StrongSelfridge_PRP(n);
+}
 
-            /* vl = vl*vl - 2*ql (mod n) */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
+#ifndef WITHOUT_THREADS
+/* State shared by the threads running the tests. */
+
+typedef struct {
+    mpz_srcptr n;
+    mpz_srcptr *bases;
+    Py_ssize_t count;
+    Py_ssize_t next;            /* index of the next test to start */
+    int running;                /* threads still taking tests */
+    volatile int composite;     /* set once a test fails */
+    PyThread_type_lock lock;    /* protects next, running, and composite */
+    PyThread_type_lock done;    /* released by the last thread to finish */
+} prp_pool;
+
+static void
+_GMPy_PRP_Pool_Worker(void *arg)
+{
+    prp_pool *pool = (prp_pool*)arg;
+    Py_ssize_t i;
+    int last;
+
+    for (;;) {
+        PyThread_acquire_lock(pool->lock, WAIT_LOCK);
+        if (pool->composite || pool->next >= pool->count) {
+            last = (--pool->running == 0);
+            PyThread_release_lock(pool->lock);
+            if (last)
+                PyThread_release_lock(pool->done);
+            return;
+        }
+        i = pool->next++;
+        PyThread_release_lock(pool->lock);
+
+        if (_GMPy_PRP_Run_Test(pool->n, pool->bases[i], &pool->composite)
+                != GMPY_PRP_PROBABLE_PRIME) {
+            PyThread_acquire_lock(pool->lock, WAIT_LOCK);
+            pool->composite = 1;
+            PyThread_release_lock(pool->lock);
         }
     }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
-
-    /* qh = ql*q */
-    mpz_mul(qh, ql, q->z);
-
-    /* uh = uh*vl - ql */
-    mpz_mul(uh, uh, vl);
-    mpz_sub(uh, uh, ql);
-
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
-
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
+}
+#endif
 
-    mpz_mod(uh, uh, n->z);
-    mpz_mod(vl, vl, n->z);
+static int
+_GMPy_PRP_Run_Tests(mpz_srcptr n, mpz_srcptr *bases, Py_ssize_t count,
+                    int threads)
+{
+    Py_ssize_t i;
+
+#ifndef WITHOUT_THREADS
+    if (threads > 1 && count > 1) {
+        prp_pool pool;
+
+        pool.n = n;
+        pool.bases = bases;
+        pool.count = count;
+        pool.next = 0;
+        pool.running = 1;
+        pool.composite = 0;
+        if (!(pool.lock = PyThread_allocate_lock()))
+            goto sequential;
+        if (!(pool.done = PyThread_allocate_lock())) {
+            PyThread_free_lock(pool.lock);
+            goto sequential;
+        }
+        PyThread_acquire_lock(pool.done, WAIT_LOCK);
+
+        /* The calling thread counts as one of the threads. */
+        if (threads > count)
+            threads = (int)count;
+        while (--threads) {
+            PyThread_acquire_lock(pool.lock, WAIT_LOCK);
+            pool.running++;
+            PyThread_release_lock(pool.lock);
+            if ((long)PyThread_start_new_thread(_GMPy_PRP_Pool_Worker, &pool) == -1) {
+                PyThread_acquire_lock(pool.lock, WAIT_LOCK);
+                pool.running--;
+                PyThread_release_lock(pool.lock);
+                break;
+            }
+        }
 
-    /* uh contains LucasU_s and vl contains LucasV_s */
-    if ((mpz_cmp_ui(uh, 0) == 0) || (mpz_cmp_ui(vl, 0) == 0)) {
-        result = Py_True;
-        goto cleanup;
+        _GMPy_PRP_Pool_Worker(&pool);
+        PyThread_acquire_lock(pool.done, WAIT_LOCK);
+        PyThread_release_lock(pool.done);
+        PyThread_free_lock(pool.done);
+        PyThread_free_lock(pool.lock);
+        return pool.composite ? GMPY_PRP_COMPOSITE : GMPY_PRP_PROBABLE_PRIME;
     }
 
-    for (j = 1; j < r; j++) {
-        /* vl = vl*vl - 2*ql (mod n) */
-        mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-        mpz_mod(vl, vl, n->z);
-
-        /* ql = ql*ql (mod n) */
-        mpz_mul(ql, ql, ql);
-        mpz_mod(ql, ql, n->z);
-
-        if (mpz_cmp_ui(vl, 0) == 0) {
-            result = Py_True;
-            goto cleanup;
-        }
+  sequential:
+#endif
+    for (i = 0; i < count; i++) {
+        if (_GMPy_PRP_Run_Test(n, bases[i], NULL) != GMPY_PRP_PROBABLE_PRIME)
+            return GMPY_PRP_COMPOSITE;
     }
-
-    result = Py_False;
-  cleanup:
-    Py_XINCREF(result);
-    mpz_clear(zD);
-    mpz_clear(s);
-    mpz_clear(nmj);
-    mpz_clear(res);
-    mpz_clear(uh);
-    mpz_clear(vl);
-    mpz_clear(vh);
-    mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)q);
-    Py_XDECREF((PyObject*)n);
-    return result;
+    return GMPY_PRP_PROBABLE_PRIME;
 }
 
-/* *******************************************************************************************
- * mpz_extrastronglucas_prp:
- * Let U_n = LucasU(p,1), V_n = LucasV(p,1), and D=p^2-4.
- * An "extra strong Lucas probable prime" to the base p is a composite n = (2^r)*s+(D/n), where
- * s is odd and (n,2D)=1, such that either U_s == 0 mod n or V_s == +/-2 mod n, or
- * V_((2^t)*s) == 0 mod n for some t with 0 <= t < r-1 [(D/n) is the Jacobi symbol]
- * *******************************************************************************************/
+/* Multi-threaded version of mpz_probab_prime_p() for large n. Like GMP 6.2,
+ * a BPSW test (a strong test to the base 2 and a strong Lucas test) is
+ * followed by reps - 24 additional strong tests; the bases used here are the
+ * odd primes 3, 5, 7, ... All the tests are run concurrently by
+ * _GMPy_PRP_Run_Tests(). The sign of n is ignored. Python is not used so the
+ * caller should release the GIL.
+ */
 
-PyDoc_STRVAR(doc_mpz_is_extrastronglucas_prp,
-"is_extra_strong_lucas_prp(n,p) -> boolean\n\n"
-"Return True if n is an extra strong Lucas probable prime with parameters\n"
-"(p,1). Assuming:\n"
-"    n is odd\n"
-"    D = p*p - 4, D != 0\n"
-"    gcd(n, 2*D) == 1\n"
-"    n = s*(2**r) + Jacobi(D,n), s odd\n"
-"Then an extra strong Lucas probable prime requires:\n"
-"    lucasu(p,1,s) == 0 (mod n)\n"
-"    or\n"
-"    lucasv(p,1,s) == +/-2 (mod n)\n"
-"    or\n"
-"    lucasv(p,1,s*(2**t)) == 0 (mod n) for some t, 0 <= t < r");
-
-static PyObject *
-GMPY_mpz_is_extrastronglucas_prp(PyObject *self, PyObject *args)
+static int
+GMPy_MPZ_Is_Prime_Threaded(mpz_srcptr n, int reps, int threads)
 {
-    MPZ_Object *n, *p;
-    PyObject *result = 0;
-    mpz_t zD, s, nmj, nm2, res;
-    /* these are needed for the LucasU and LucasV part of this function */
-    mpz_t uh, vl, vh, ql, qh, tmp;
-    mp_bitcnt_t r = 0, j = 0;
-    int ret = 0;
+    mpz_t absn, *primes = NULL;
+    mpz_srcptr *bases = NULL;
+    Py_ssize_t i, extra, count;
+    int ret;
 
-    if (PyTuple_Size(args) != 2) {
-        TYPE_ERROR("is_extra_strong_lucas_prp() requires 2 integer arguments");
-        return NULL;
-    }
+    /* Small values are quicker to test directly. */
+    if (mpz_sizeinbase(n, 2) <= 64)
+        return mpz_probab_prime_p(n, reps);
 
-    mpz_init(zD);
-    mpz_init(s);
-    mpz_init(nmj);
-    mpz_init(nm2);
-    mpz_init(res);
-    mpz_init(uh);
-    mpz_init(vl);
-    mpz_init(vh);
-    mpz_init(ql);
-    mpz_init(qh);
-    mpz_init(tmp);
+    mpz_init(absn);
+    mpz_abs(absn, n);
 
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    p = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 1), NULL);
-    if (!n || !p) {
-        TYPE_ERROR("is_extra_strong_lucas_prp() requires 2 integer arguments");
-        goto cleanup;
+    /* Trial division by 2 and the odd primes below 30. */
+    if (mpz_even_p(absn) || mpz_gcd_ui(NULL, absn, 3234846615UL) > 1) {
+        mpz_clear(absn);
+        return 0;
     }
 
-    /* Check if p*p - 4 == 0. */
-    mpz_mul(zD, p->z, p->z);
-    mpz_sub_ui(zD, zD, 4);
-    if (mpz_sgn(zD) == 0) {
-        VALUE_ERROR("invalid value for p in is_extra_strong_lucas_prp()");
-        goto cleanup;
+    extra = reps > 24 ? reps - 24 : 0;
+    count = extra + 2;
+    if (!(primes = malloc(sizeof(mpz_t) * (extra + 1))) ||
+        !(bases = malloc(sizeof(mpz_srcptr) * count))) {
+        /* LCOV_EXCL_START */
+        free(primes);
+        mpz_clear(absn);
+        return mpz_probab_prime_p(n, reps);
+        /* LCOV_EXCL_STOP */
     }
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_extra_strong_lucas_prp() requires 'n' be greater than 0");
-        goto cleanup;
+    mpz_init_set_ui(primes[0], 2);
+    bases[0] = primes[0];
+    bases[1] = NULL;
+    for (i = 1; i <= extra; i++) {
+        mpz_init(primes[i]);
+        mpz_nextprime(primes[i], primes[i - 1]);
+        bases[i + 1] = primes[i];
     }
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
+    ret = _GMPy_PRP_Run_Tests(absn, bases, count, threads) == GMPY_PRP_PROBABLE_PRIME;
 
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
+    for (i = 0; i <= extra; i++)
+        mpz_clear(primes[i]);
+    free(primes);
+    free(bases);
+    mpz_clear(absn);
+    return ret;
+}
 
-    /* Check GCD */
-    mpz_mul_ui(res, zD, 2);
-    mpz_gcd(res, res, n->z);
-    if ((mpz_cmp(res, n->z) != 0) && (mpz_cmp_ui(res, 1) > 0)) {
-        VALUE_ERROR("is_extra_strong_lucas_prp() requires gcd(n,2*D) == 1");
-        goto cleanup;
-    }
+/* Python wrappers for the probable prime tests. */
 
-    /* nmj = n - (D/n), where (D/n) is the Jacobi symbol */
-    mpz_set(nmj, n->z);
-    ret = mpz_jacobi(zD, n->z);
-    if (ret == -1)
-        mpz_add_ui(nmj, nmj, 1);
-    else if (ret == 1)
-        mpz_sub_ui(nmj, nmj, 1);
+/* Convert the count arguments in args to mpz. On success, 0 is returned and
+ * new references are stored in z. Otherwise an exception is set and -1 is
+ * returned.
+ */
 
-    r = mpz_scan1(nmj, 0);
-    mpz_fdiv_q_2exp(s, nmj, r);
+static int
+_GMPy_PRP_Args(PyObject *args, const char *name, Py_ssize_t count, MPZ_Object **z)
+{
+    Py_ssize_t i;
 
-    mpz_set(nm2, n->z);
-    mpz_sub_ui(nm2, nm2, 2);
+    if (PyTuple_GET_SIZE(args) != count)
+        goto error;
 
-    /* make sure that either U_s == 0 mod n or V_s == +/-2 mod n, or */
-    /* V_((2^t)*s) == 0 mod n for some t with 0 <= t < r-1           */
-    mpz_set_si(uh, 1);
-    mpz_set_si(vl, 2);
-    mpz_set(vh, p->z);
-    mpz_set_si(ql, 1);
-    mpz_set_si(qh, 1);
-    mpz_set_si(tmp,0);
-
-    for (j = mpz_sizeinbase(s,2)-1; j >= 1; j--) {
-        /* ql = ql*qh (mod n) */
-        mpz_mul(ql, ql, qh);
-        mpz_mod(ql, ql, n->z);
-        if (mpz_tstbit(s,j) == 1) {
-            /* qh = ql*q */
-            mpz_set(qh, ql);
-
-            /* uh = uh*vh (mod n) */
-            mpz_mul(uh, uh, vh);
-            mpz_mod(uh, uh, n->z);
-
-            /* vl = vh*vl - p*ql (mod n) */
-            mpz_mul(vl, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-
-            /* vh = vh*vh - 2*qh (mod n) */
-            mpz_mul(vh, vh, vh);
-            mpz_mul_si(tmp, qh, 2);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
+    for (i = 0; i < count; i++) {
+        if (!(z[i] = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, i), NULL))) {
+            while (i--)
+                Py_DECREF((PyObject*)z[i]);
+            goto error;
         }
-        else {
-            /* qh = ql */
-            mpz_set(qh, ql);
-
-            /* uh = uh*vl - ql (mod n) */
-            mpz_mul(uh, uh, vl);
-            mpz_sub(uh, uh, ql);
-            mpz_mod(uh, uh, n->z);
+    }
+    return 0;
 
-            /* vh = vh*vl - p*ql (mod n) */
-            mpz_mul(vh, vh, vl);
-            mpz_mul(tmp, ql, p->z);
-            mpz_sub(vh, vh, tmp);
-            mpz_mod(vh, vh, n->z);
+  error:
+    PyErr_Format(PyExc_TypeError, "%s() requires %d integer argument%s",
+                 name, (int)count, count == 1 ? "" : "s");
+    return -1;
+}
 
-            /* vl = vl*vl - 2*ql (mod n) */
-            mpz_mul(vl, vl, vl);
-            mpz_mul_si(tmp, ql, 2);
-            mpz_sub(vl, vl, tmp);
-            mpz_mod(vl, vl, n->z);
-        }
-    }
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
+static void
+_GMPy_PRP_Release(Py_ssize_t count, MPZ_Object **z)
+{
+    while (count--)
+        Py_DECREF((PyObject*)z[count]);
+}
 
-    /* qh = ql*q */
-    mpz_set(qh, ql);
+/* Convert the result of a core test to True or False, or raise the
+ * ValueError that corresponds to an error code. gcd describes the gcd that
+ * must be 1 and pq describes the Lucas parameters.
+ */
 
-    /* uh = uh*vl - ql */
-    mpz_mul(uh, uh, vl);
-    mpz_sub(uh, uh, ql);
+static PyObject *
+_GMPy_PRP_Result(int ret, const char *name, const char *gcd, const char *pq)
+{
+    switch (ret) {
+    case GMPY_PRP_PROBABLE_PRIME:
+        Py_RETURN_TRUE;
+    case GMPY_PRP_COMPOSITE:
+        Py_RETURN_FALSE;
+    case GMPY_PRP_ERROR_A:
+        PyErr_Format(PyExc_ValueError,
+                     "%s() requires 'a' greater than or equal to 2", name);
+        break;
+    case GMPY_PRP_ERROR_N:
+        PyErr_Format(PyExc_ValueError,
+                     "%s() requires 'n' be greater than 0", name);
+        break;
+    case GMPY_PRP_ERROR_GCD:
+        PyErr_Format(PyExc_ValueError, "%s() requires %s == 1", name, gcd);
+        break;
+    case GMPY_PRP_ERROR_PQ:
+        PyErr_Format(PyExc_ValueError, "invalid %s in %s()", pq, name);
+        break;
+    default:
+        PyErr_Format(PyExc_ValueError,
+                     "appropriate value for D cannot be found in %s()", name);
+    }
+    return NULL;
+}
 
-    /* vl = vh*vl - p*ql */
-    mpz_mul(vl, vh, vl);
-    mpz_mul(tmp, ql, p->z);
-    mpz_sub(vl, vl, tmp);
+PyDoc_STRVAR(doc_mpz_is_fermat_prp,
+"is_fermat_prp(n,a) -> boolean\n\n"
+"Return True if n is a Fermat probable prime to the base a.\n"
+"Assuming:\n"
+"    gcd(n,a) == 1\n"
+"Then a Fermat probable prime requires:\n"
+"    a**(n-1) == 1 (mod n)");
 
-    /* ql = ql*qh */
-    mpz_mul(ql, ql, qh);
+static PyObject *
+GMPY_mpz_is_fermat_prp(PyObject *self, PyObject *args)
+{
+    MPZ_Object *z[2];
+    int ret;
 
-    mpz_mod(uh, uh, n->z);
-    mpz_mod(vl, vl, n->z);
+    if (_GMPy_PRP_Args(args, "is_fermat_prp", 2, z) < 0)
+        return NULL;
 
-    /* uh contains LucasU_s and vl contains LucasV_s */
-    if ((mpz_cmp_ui(uh, 0) == 0) || (mpz_cmp_ui(vl, 0) == 0) ||
-        (mpz_cmp(vl, nm2) == 0) || (mpz_cmp_si(vl, 2) == 0)) {
-        result = Py_True;
-        goto cleanup;
-    }
+    ret = GMPy_MPZ_Is_Fermat_PRP(z[0]->z, z[1]->z);
+    _GMPy_PRP_Release(2, z);
+    return _GMPy_PRP_Result(ret, "is_fermat_prp", "gcd(n,a)", NULL);
+}
 
-    for (j = 1; j < r-1; j++) {
-        /* vl = vl*vl - 2*ql (mod n) */
-        mpz_mul(vl, vl, vl);
-        mpz_mul_si(tmp, ql, 2);
-        mpz_sub(vl, vl, tmp);
-        mpz_mod(vl, vl, n->z);
+PyDoc_STRVAR(doc_mpz_is_euler_prp,
+"is_euler_prp(n,a) -> boolean\n\n"
+"Return True if n is an Euler (also known as Solovay-Strassen)\n"
+"probable prime to the base a.\n"
+"Assuming:\n"
+"    gcd(n,a) == 1\n"
+"    n is odd\n"
+"Then an Euler probable prime requires:\n"
+"    a**((n-1)/2) == 1 (mod n)");
 
-        /* ql = ql*ql (mod n) */
-        mpz_mul(ql, ql, ql);
-        mpz_mod(ql, ql, n->z);
+static PyObject *
+GMPY_mpz_is_euler_prp(PyObject *self, PyObject *args)
+{
+    MPZ_Object *z[2];
+    int ret;
 
-        if (mpz_cmp_ui(vl, 0) == 0) {
-            result = Py_True;
-            goto cleanup;
-        }
-    }
+    if (_GMPy_PRP_Args(args, "is_euler_prp", 2, z) < 0)
+        return NULL;
 
-    result = Py_False;
-  cleanup:
-    Py_XINCREF(result);
-    mpz_clear(zD);
-    mpz_clear(s);
-    mpz_clear(nmj);
-    mpz_clear(nm2);
-    mpz_clear(res);
-    mpz_clear(uh);
-    mpz_clear(vl);
-    mpz_clear(vh);
-    mpz_clear(ql);
-    mpz_clear(qh);
-    mpz_clear(tmp);
-    Py_XDECREF((PyObject*)p);
-    Py_XDECREF((PyObject*)n);
-    return result;
+    ret = GMPy_MPZ_Is_Euler_PRP(z[0]->z, z[1]->z);
+    _GMPy_PRP_Release(2, z);
+    return _GMPy_PRP_Result(ret, "is_euler_prp", "gcd(n,a)", NULL);
 }
 
-/* ***********************************************************************************************
- * mpz_selfridge_prp:
- * A "Lucas-Selfridge probable prime" n is a "Lucas probable prime" using Selfridge parameters of:
- * Find the first element D in the sequence {5, -7, 9, -11, 13, ...} such that Jacobi(D,n) = -1
- * Then use P=1 and Q=(1-D)/4 in the Lucas probable prime test.
- * Make sure n is not a perfect square, otherwise the search for D will only stop when D=n.
- * ***********************************************************************************************/
-
-PyDoc_STRVAR(doc_mpz_is_selfridge_prp,
-"is_selfridge_prp(n) -> boolean\n\n"
-"Return True if n is a Lucas probable prime with Selfidge parameters\n"
-"(p,q). The Selfridge parameters are chosen by finding the first\n"
-"element D in the sequence {5, -7, 9, -11, 13, ...} such that\n"
-"Jacobi(D,n) == -1. Then let p=1 and q = (1-D)/4. Then perform\n"
-"a Lucas probable prime test.");
+PyDoc_STRVAR(doc_mpz_is_strong_prp,
+"is_strong_prp(n,a) -> boolean\n\n"
+"Return True if n is an strong (also known as Miller-Rabin)\n"
+"probable prime to the base a.\n"
+"Assuming:\n"
+"    gcd(n,a) == 1\n"
+"    n is odd\n"
+"    n = s*(2**r) + 1, with s odd\n"
+"Then a strong probable prime requires one of the following is true:\n"
+"    a**s == 1 (mod n)\n"
+"    or\n"
+"    a**(s*(2**t)) == -1 (mod n) for some t, 0 <= t < r.");
 
 static PyObject *
-GMPY_mpz_is_selfridge_prp(PyObject *self, PyObject *args)
+GMPY_mpz_is_strong_prp(PyObject *self, PyObject *args)
 {
-    MPZ_Object *n;
-    PyObject *result = 0, *temp = 0;
-    long d = 5, p = 1, q = 0, max_d = 1000000;
-    int jacobi = 0;
-    mpz_t zD;
+    MPZ_Object *z[2];
+    int ret;
+
+    if (_GMPy_PRP_Args(args, "is_strong_prp", 2, z) < 0)
+        return NULL;
+
+    ret = GMPy_MPZ_Is_Strong_PRP(z[0]->z, z[1]->z);
+    _GMPy_PRP_Release(2, z);
+    return _GMPy_PRP_Result(ret, "is_strong_prp", "gcd(n,a)", NULL);
+}
+
+PyDoc_STRVAR(doc_mpz_strong_prp_bases,
+"strong_prp_bases(n, bases, threads=1) -> boolean\n\n"
+"Return True if n is a strong probable prime to every base in the\n"
+"iterable bases. bases must not be empty, each base must be greater\n"
+"than or equal to 2 and gcd(n,base) must be 1. The tests are run without holding the GIL.\n"
+"If threads is greater than 1, up to threads tests are run at the\n"
+"same time and the remaining tests are cancelled as soon as one\n"
+"base shows that n is composite.");
 
-    if (PyTuple_Size(args) != 1) {
-        TYPE_ERROR("is_selfridge_prp() requires 1 integer argument");
+static PyObject *
+GMPY_mpz_strong_prp_bases(PyObject *self, PyObject *args, PyObject *keywds)
+{
+    PyObject *n_obj, *bases_obj, *seq = NULL, *result = NULL;
+    MPZ_Object *n = NULL, **z = NULL;
+    mpz_srcptr *bases = NULL;
+    Py_ssize_t i, count = 0, converted = 0;
+    int threads = 1, ret, known = GMPY_PRP_UNKNOWN;
+    static char *kwlist[] = {"n", "bases", "threads", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, keywds, "OO|i", kwlist,
+                                     &n_obj, &bases_obj, &threads)) {
         return NULL;
     }
 
-    mpz_init(zD);
+    if (threads < 1) {
+        VALUE_ERROR("strong_prp_bases() requires threads be greater than 0");
+        return NULL;
+    }
 
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    if (!n) {
-        TYPE_ERROR("is_selfridge_prp() requires 1 integer argument");
-        goto cleanup;
+    if (!(n = GMPy_MPZ_From_Integer(n_obj, NULL))) {
+        PyErr_Clear();
+        TYPE_ERROR("strong_prp_bases() requires an integer 'n'");
+        return NULL;
     }
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_selfridge_prp() requires 'n' be greater than 0");
+    if (!(seq = PySequence_Fast(bases_obj, "strong_prp_bases() requires an iterable of bases")))
         goto cleanup;
-    }
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
+    count = PySequence_Fast_GET_SIZE(seq);
+    if (count == 0) {
+        VALUE_ERROR("strong_prp_bases() requires at least one base");
         goto cleanup;
     }
-
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
+    if (!(z = PyMem_New(MPZ_Object*, count + 1)) ||
+        !(bases = PyMem_New(mpz_srcptr, count + 1))) {
+        /* LCOV_EXCL_START */
+        PyErr_NoMemory();
         goto cleanup;
+        /* LCOV_EXCL_STOP */
     }
 
-    mpz_set_ui(zD, d);
-
-    while (1) {
-        jacobi = mpz_jacobi(zD, n->z);
-
-        /* if jacobi == 0, d is a factor of n, therefore n is composite... */
-        /* if d == n, then either n is either prime or 9... */
-        if (jacobi == 0) {
-            if ((mpz_cmpabs(zD, n->z) == 0) && (mpz_cmp_ui(zD, 9) != 0)) {
-                result = Py_True;
-                goto cleanup;
-            }
-            else {
-                result = Py_False;
-                goto cleanup;
-            }
-        }
-        if (jacobi == -1)
-            break;
-
-        /* if we get to the 5th d, make sure we aren't dealing with a square... */
-        if (d == 13) {
-            if (mpz_perfect_square_p(n->z)) {
-                result = Py_False;
-                goto cleanup;
-            }
-        }
-
-        if (d < 0) {
-            d *= -1;
-            d += 2;
-        }
-        else {
-            d += 2;
-            d *= -1;
+    /* Check all the bases before any test is run. */
+    for (i = 0; i < count; i++) {
+        if (!(z[i] = GMPy_MPZ_From_Integer(PySequence_Fast_GET_ITEM(seq, i), NULL))) {
+            PyErr_Clear();
+            TYPE_ERROR("strong_prp_bases() requires integer bases");
+            goto cleanup;
         }
+        converted++;
+        bases[i] = z[i]->z;
 
-        /* make sure we don't search forever */
-        if (d >= max_d) {
-            VALUE_ERROR("appropriate value for D cannot be found in is_selfridge_prp()");
+        ret = _GMPy_PRP_Strong_Check(n->z, bases[i]);
+        if (ret < 0) {
+            result = _GMPy_PRP_Result(ret, "strong_prp_bases", "gcd(n,a)", NULL);
             goto cleanup;
         }
-
-        mpz_set_si(zD, d);
+        known = ret;
     }
 
-    q = (1-d)/4;
-
-    /* Since "O" is used, the refcount for n is incremented so deleting
-     * temp will not delete n.
-     */
-    temp = Py_BuildValue("Oll", n, p, q);
-    if (!temp)
+    if (known != GMPY_PRP_UNKNOWN) {
+        result = _GMPy_PRP_Result(known, "strong_prp_bases", "gcd(n,a)", NULL);
         goto cleanup;
-    result = GMPY_mpz_is_lucas_prp(NULL, temp);
-    Py_DECREF(temp);
-    goto return_result;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ret = _GMPy_PRP_Run_Tests(n->z, bases, count, threads);
+    Py_END_ALLOW_THREADS
+    result = _GMPy_PRP_Result(ret, "strong_prp_bases", "gcd(n,a)", NULL);
 
   cleanup:
-    Py_XINCREF(result);
-  return_result:
-    mpz_clear(zD);
+    while (converted--)
+        Py_DECREF((PyObject*)z[converted]);
+    PyMem_Free(z);
+    PyMem_Free(bases);
+    Py_XDECREF(seq);
     Py_DECREF((PyObject*)n);
     return result;
 }
 
-/* *********************************************************************************************************
- * mpz_strongselfridge_prp:
- * A "strong Lucas-Selfridge probable prime" n is a "strong Lucas probable prime" using Selfridge parameters of:
- * Find the first element D in the sequence {5, -7, 9, -11, 13, ...} such that Jacobi(D,n) = -1
- * Then use P=1 and Q=(1-D)/4 in the strong Lucas probable prime test.
- * Make sure n is not a perfect square, otherwise the search for D will only stop when D=n.
- * **********************************************************************************************************/
-
-PyDoc_STRVAR(doc_mpz_is_strongselfridge_prp,
-"is_strong_selfridge_prp(n) -> boolean\n\n"
-"Return True if n is a strong Lucas probable prime with Selfidge\n"
-"parameters (p,q). The Selfridge parameters are chosen by finding\n"
-"the first element D in the sequence {5, -7, 9, -11, 13, ...} such\n"
-"that Jacobi(D,n) == -1. Then let p=1 and q = (1-D)/4. Then perform\n"
-"a strong Lucas probable prime test.");
+PyDoc_STRVAR(doc_mpz_is_fibonacci_prp,
+"is_fibonacci_prp(n,p,q) -> boolean\n\n"
+"Return True if n is an Fibonacci probable prime with parameters (p,q).\n"
+"Assuming:\n"
+"    n is odd\n"
+"    p > 0, q = +/-1\n"
+"    p*p - 4*q != 0\n"
+"Then a Fibonacci probable prime requires:\n"
+"    lucasv(p,q,n) == p (mod n).");
 
 static PyObject *
-GMPY_mpz_is_strongselfridge_prp(PyObject *self, PyObject *args)
+GMPY_mpz_is_fibonacci_prp(PyObject *self, PyObject *args)
 {
-    MPZ_Object *n;
-    PyObject *result = 0, *temp = 0;
-    long d = 5, p = 1, q = 0, max_d = 1000000;
-    int jacobi = 0;
-    mpz_t zD;
+    MPZ_Object *z[3];
+    int ret;
 
-    if (PyTuple_Size(args) != 1) {
-        TYPE_ERROR("is_strong_selfridge_prp() requires 1 integer argument");
+    if (_GMPy_PRP_Args(args, "is_fibonacci_prp", 3, z) < 0)
         return NULL;
-    }
 
-    mpz_init(zD);
+    ret = GMPy_MPZ_Is_Fibonacci_PRP(z[0]->z, z[1]->z, z[2]->z);
+    _GMPy_PRP_Release(3, z);
+    return _GMPy_PRP_Result(ret, "is_fibonacci_prp", NULL, "values for p,q");
+}
 
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    if (!n) {
-        TYPE_ERROR("is_strong_selfridge_prp() requires 1 integer argument");
-        goto cleanup;
-    }
+PyDoc_STRVAR(doc_mpz_is_lucas_prp,
+"is_lucas_prp(n,p,q) -> boolean\n\n"
+"Return True if n is a Lucas probable prime with parameters (p,q).\n"
+"Assuming:\n"
+"    n is odd\n"
+"    D = p*p - 4*q, D != 0\n"
+"    gcd(n, 2*q*D) == 1\n"
+"Then a Lucas probable prime requires:\n"
+"    lucasu(p,q,n - Jacobi(D,n)) == 0 (mod n)");
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_strong_selfridge_prp() requires 'n' be greater than 0");
-        goto cleanup;
-    }
+static PyObject *
+GMPY_mpz_is_lucas_prp(PyObject *self, PyObject *args)
+{
+    MPZ_Object *z[3];
+    int ret;
 
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
+    if (_GMPy_PRP_Args(args, "is_lucas_prp", 3, z) < 0)
+        return NULL;
 
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
+    ret = GMPy_MPZ_Is_Lucas_PRP(z[0]->z, z[1]->z, z[2]->z);
+    _GMPy_PRP_Release(3, z);
+    return _GMPy_PRP_Result(ret, "is_lucas_prp", "gcd(n,2*q*D)", "values for p,q");
+}
 
+PyDoc_STRVAR(doc_mpz_is_stronglucas_prp,
+"is_strong_lucas_prp(n,p,q) -> boolean\n\n"
+"Return True if n is a strong Lucas probable prime with parameters (p,q).\n"
+"Assuming:\n"
+"    n is odd\n"
+"    D = p*p - 4*q, D != 0\n"
+"    gcd(n, 2*q*D) == 1\n"
+"    n = s*(2**r) + Jacobi(D,n), s odd\n"
+"Then a strong Lucas probable prime requires:\n"
+"    lucasu(p,q,s) == 0 (mod n)\n"
+"    or\n"
+"    lucasv(p,q,s*(2**t)) == 0 (mod n) for some t, 0 <= t < r");
 
-    mpz_set_ui(zD, d);
+static PyObject *
+GMPY_mpz_is_stronglucas_prp(PyObject *self, PyObject *args)
+{
+    MPZ_Object *z[3];
+    int ret;
 
-    while (1) {
-        jacobi = mpz_jacobi(zD, n->z);
+    if (_GMPy_PRP_Args(args, "is_strong_lucas_prp", 3, z) < 0)
+        return NULL;
 
-        /* if jacobi == 0, d is a factor of n, therefore n is composite... */
-        /* if d == n, then either n is either prime or 9... */
-        if (jacobi == 0) {
-            if ((mpz_cmpabs(zD, n->z) == 0) && (mpz_cmp_ui(zD, 9) != 0)) {
-                result = Py_True;
-                goto cleanup;
-            }
-            else {
-                result = Py_False;
-                goto cleanup;
-            }
-        }
-        if (jacobi == -1)
-            break;
+    ret = GMPy_MPZ_Is_StrongLucas_PRP(z[0]->z, z[1]->z, z[2]->z);
+    _GMPy_PRP_Release(3, z);
+    return _GMPy_PRP_Result(ret, "is_strong_lucas_prp", "gcd(n,2*q*D)", "values for p,q");
+}
 
-        /* if we get to the 5th d, make sure we aren't dealing with a square... */
-        if (d == 13) {
-            if (mpz_perfect_square_p(n->z)) {
-                result = Py_False;
-                goto cleanup;
-            }
-        }
+PyDoc_STRVAR(doc_mpz_is_extrastronglucas_prp,
+"is_extra_strong_lucas_prp(n,p) -> boolean\n\n"
+"Return True if n is an extra strong Lucas probable prime with parameters\n"
+"(p,1). Assuming:\n"
+"    n is odd\n"
+"    D = p*p - 4, D != 0\n"
+"    gcd(n, 2*D) == 1\n"
+"    n = s*(2**r) + Jacobi(D,n), s odd\n"
+"Then an extra strong Lucas probable prime requires:\n"
+"    lucasu(p,1,s) == 0 (mod n)\n"
+"    or\n"
+"    lucasv(p,1,s) == +/-2 (mod n)\n"
+"    or\n"
+"    lucasv(p,1,s*(2**t)) == 0 (mod n) for some t, 0 <= t < r");
 
-        if (d < 0) {
-            d *= -1;
-            d += 2;
-        }
-        else {
-            d += 2;
-            d *= -1;
-        }
+static PyObject *
+GMPY_mpz_is_extrastronglucas_prp(PyObject *self, PyObject *args)
+{
+    MPZ_Object *z[2];
+    int ret;
 
-        /* make sure we don't search forever */
-        if (d >= max_d) {
-            VALUE_ERROR("appropriate value for D cannot be found in is_strong_selfridge_prp()");
-            goto cleanup;
-        }
+    if (_GMPy_PRP_Args(args, "is_extra_strong_lucas_prp", 2, z) < 0)
+        return NULL;
 
-        mpz_set_si(zD, d);
-    }
+    ret = GMPy_MPZ_Is_ExtraStrongLucas_PRP(z[0]->z, z[1]->z);
+    _GMPy_PRP_Release(2, z);
+    return _GMPy_PRP_Result(ret, "is_extra_strong_lucas_prp", "gcd(n,2*D)", "value for p");
+}
 
-    q = (1-d)/4;
+PyDoc_STRVAR(doc_mpz_is_selfridge_prp,
+"is_selfridge_prp(n) -> boolean\n\n"
+"Return True if n is a Lucas probable prime with Selfidge parameters\n"
+"(p,q). The Selfridge parameters are chosen by finding the first\n"
+"element D in the sequence {5, -7, 9, -11, 13, ...} such that\n"
+"Jacobi(D,n) == -1. Then let p=1 and q = (1-D)/4. Then perform\n"
+"a Lucas probable prime test.");
 
-    /* Since "O" is used, the refcount for n is incremented so deleting
-     * temp will not delete n.
-     */
-    temp = Py_BuildValue("Oll", n, p, q);
-    if (!temp)
-        goto cleanup;
-    result = GMPY_mpz_is_stronglucas_prp(NULL, temp);
-    Py_DECREF(temp);
-    goto return_result;
+static PyObject *
+GMPY_mpz_is_selfridge_prp(PyObject *self, PyObject *args)
+{
+    MPZ_Object *z[1];
+    int ret;
 
-  cleanup:
-    Py_XINCREF(result);
-  return_result:
-    mpz_clear(zD);
-    Py_DECREF((PyObject*)n);
-    return result;
+    if (_GMPy_PRP_Args(args, "is_selfridge_prp", 1, z) < 0)
+        return NULL;
+
+    ret = GMPy_MPZ_Is_Selfridge_PRP(z[0]->z);
+    _GMPy_PRP_Release(1, z);
+    return _GMPy_PRP_Result(ret, "is_selfridge_prp", NULL, NULL);
 }
 
-/* **********************************************************************************
- * mpz_bpsw_prp:
- * A "Baillie-Pomerance-Selfridge-Wagstaff probable prime" is a composite n such that
- * n is a strong probable prime to the base 2 and
- * n is a Lucas probable prime using the Selfridge parameters.
- * **********************************************************************************/
+PyDoc_STRVAR(doc_mpz_is_strongselfridge_prp,
+"is_strong_selfridge_prp(n) -> boolean\n\n"
+"Return True if n is a strong Lucas probable prime with Selfidge\n"
+"parameters (p,q). The Selfridge parameters are chosen by finding\n"
+"the first element D in the sequence {5, -7, 9, -11, 13, ...} such\n"
+"that Jacobi(D,n) == -1. Then let p=1 and q = (1-D)/4. Then perform\n"
+"a strong Lucas probable prime test.");
+
+static PyObject *
+GMPY_mpz_is_strongselfridge_prp(PyObject *self, PyObject *args)
+{
+    MPZ_Object *z[1];
+    int ret;
+
+    if (_GMPy_PRP_Args(args, "is_strong_selfridge_prp", 1, z) < 0)
+        return NULL;
+
+    ret = GMPy_MPZ_Is_StrongSelfridge_PRP(z[0]->z);
+    _GMPy_PRP_Release(1, z);
+    return _GMPy_PRP_Result(ret, "is_strong_selfridge_prp", NULL, NULL);
+}
 
 PyDoc_STRVAR(doc_mpz_is_bpsw_prp,
 "is_bpsw_prp(n) -> boolean\n\n"
@@ -1444,144 +1268,33 @@ PyDoc_STRVAR(doc_mpz_is_bpsw_prp,
 static PyObject *
 GMPY_mpz_is_bpsw_prp(PyObject *self, PyObject *args)
 {
-    MPZ_Object *n;
-    PyObject *result = 0, *temp = 0;
+    MPZ_Object *z[1];
+    int ret;
 
-    if (PyTuple_Size(args) != 1) {
-        TYPE_ERROR("is_bpsw_prp() requires 1 integer argument");
+    if (_GMPy_PRP_Args(args, "is_bpsw_prp", 1, z) < 0)
         return NULL;
-    }
-
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    if (!n) {
-        TYPE_ERROR("is_bpsw_prp() requires 1 integer argument");
-        goto cleanup;
-    }
-
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_bpsw_prp() requires 'n' be greater than 0");
-        goto cleanup;
-    }
-
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
-
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
-
-    /* "O" is used to increment the reference to n so deleting temp won't
-     * delete n.
-     */
-    temp = Py_BuildValue("Oi", n, 2);
-    if (!temp)
-        goto cleanup;
-    result = GMPY_mpz_is_strong_prp(NULL, temp);
-    Py_DECREF(temp);
-    if (result == Py_False)
-        goto return_result;
-    /* Remember to ignore the preceding result */
-    Py_DECREF(result);
-
-    temp = Py_BuildValue("(O)", n);
-    if (!temp)
-        goto cleanup;
-    result = GMPY_mpz_is_selfridge_prp(NULL, temp);
-    Py_DECREF(temp);
-    goto return_result;
 
-  cleanup:
-    Py_XINCREF(result);
-  return_result:
-    Py_DECREF((PyObject*)n);
-    return result;
+    ret = GMPy_MPZ_Is_BPSW_PRP(z[0]->z);
+    _GMPy_PRP_Release(1, z);
+    return _GMPy_PRP_Result(ret, "is_bpsw_prp", NULL, NULL);
 }
 
-
-/* ****************************************************************************************
- * mpz_strongbpsw_prp:
- * A "strong Baillie-Pomerance-Selfridge-Wagstaff probable prime" is a composite n such that
- * n is a strong probable prime to the base 2 and
- * n is a strong Lucas probable prime using the Selfridge parameters.
- * ****************************************************************************************/
-
 PyDoc_STRVAR(doc_mpz_is_strongbpsw_prp,
 "is_strong_bpsw_prp(n) -> boolean\n\n"
 "Return True if n is a strong Baillie-Pomerance-Selfridge-Wagstaff\n"
 "probable prime. A strong BPSW probable prime passes the is_strong_prp()\n"
-"test with base and the is_strong_selfridge_prp() test.\n");
+"test with base 2 and the is_strong_selfridge_prp() test.\n");
 
 static PyObject *
 GMPY_mpz_is_strongbpsw_prp(PyObject *self, PyObject *args)
 {
-    MPZ_Object *n;
-    PyObject *result = 0, *temp = 0;
+    MPZ_Object *z[1];
+    int ret;
 
-    if (PyTuple_Size(args) != 1) {
-        TYPE_ERROR("is_strong_bpsw_prp() requires 1 integer argument");
+    if (_GMPy_PRP_Args(args, "is_strong_bpsw_prp", 1, z) < 0)
         return NULL;
-    }
-
-    n = GMPy_MPZ_From_Integer(PyTuple_GET_ITEM(args, 0), NULL);
-    if (!n) {
-        TYPE_ERROR("is_strong_bpsw_prp() requires 1 integer argument");
-        goto cleanup;
-    }
 
-    /* Require n > 0. */
-    if (mpz_sgn(n->z) <= 0) {
-        VALUE_ERROR("is_strong_bpsw_prp() requires 'n' be greater than 0");
-        goto cleanup;
-    }
-
-    /* Check for n == 1 */
-    if (mpz_cmp_ui(n->z, 1) == 0) {
-        result = Py_False;
-        goto cleanup;
-    }
-
-    /* Handle n even. */
-    if (mpz_divisible_ui_p(n->z, 2)) {
-        if (mpz_cmp_ui(n->z, 2) == 0)
-            result = Py_True;
-        else
-            result = Py_False;
-        goto cleanup;
-    }
-
-    /* "O" is used to increment the reference to n so deleting temp won't
-     * delete n.
-     */
-    temp = Py_BuildValue("Oi", n, 2);
-    if (!temp)
-        goto cleanup;
-    result = GMPY_mpz_is_strong_prp(NULL, temp);
-    Py_DECREF(temp);
-    if (result == Py_False)
-        goto return_result;
-    /* Remember to ignore the preceding result */
-    Py_DECREF(result);
-
-    temp = Py_BuildValue("(O)", n);
-    if (!temp)
-        goto cleanup;
-    result = GMPY_mpz_is_selfridge_prp(NULL, temp);
-    Py_DECREF(temp);
-    goto return_result;
-
-  cleanup:
-    Py_XINCREF(result);
-  return_result:
-    Py_DECREF((PyObject*)n);
-    return result;
+    ret = GMPy_MPZ_Is_StrongBPSW_PRP(z[0]->z);
+    _GMPy_PRP_Release(1, z);
+    return _GMPy_PRP_Result(ret, "is_strong_bpsw_prp", NULL, NULL);
 }
-
@@ -29,6 +29,20 @@
 extern "C" {
 #endif
 
+static GMPy_MPZ_Is_Fermat_PRP_RETURN GMPy_MPZ_Is_Fermat_PRP GMPy_MPZ_Is_Fermat_PRP_PROTO;
+static GMPy_MPZ_Is_Euler_PRP_RETURN GMPy_MPZ_Is_Euler_PRP GMPy_MPZ_Is_Euler_PRP_PROTO;
+static GMPy_MPZ_Is_Strong_PRP_RETURN GMPy_MPZ_Is_Strong_PRP GMPy_MPZ_Is_Strong_PRP_PROTO;
+static GMPy_MPZ_Is_Fibonacci_PRP_RETURN GMPy_MPZ_Is_Fibonacci_PRP GMPy_MPZ_Is_Fibonacci_PRP_PROTO;
+static GMPy_MPZ_Is_Lucas_PRP_RETURN GMPy_MPZ_Is_Lucas_PRP GMPy_MPZ_Is_Lucas_PRP_PROTO;
+static GMPy_MPZ_Is_StrongLucas_PRP_RETURN GMPy_MPZ_Is_StrongLucas_PRP GMPy_MPZ_Is_StrongLucas_PRP_PROTO;
+static GMPy_MPZ_Is_ExtraStrongLucas_PRP_RETURN GMPy_MPZ_Is_ExtraStrongLucas_PRP GMPy_MPZ_Is_ExtraStrongLucas_PRP_PROTO;
+static GMPy_MPZ_Is_Selfridge_PRP_RETURN GMPy_MPZ_Is_Selfridge_PRP GMPy_MPZ_Is_Selfridge_PRP_PROTO;
+static GMPy_MPZ_Is_StrongSelfridge_PRP_RETURN GMPy_MPZ_Is_StrongSelfridge_PRP GMPy_MPZ_Is_StrongSelfridge_PRP_PROTO;
+static GMPy_MPZ_Is_BPSW_PRP_RETURN GMPy_MPZ_Is_BPSW_PRP GMPy_MPZ_Is_BPSW_PRP_PROTO;
+static GMPy_MPZ_Is_StrongBPSW_PRP_RETURN GMPy_MPZ_Is_StrongBPSW_PRP GMPy_MPZ_Is_StrongBPSW_PRP_PROTO;
+
+static int GMPy_MPZ_Is_Prime_Threaded(mpz_srcptr n, int reps, int threads);
+
 static PyObject * GMPY_mpz_is_fermat_prp(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_is_euler_prp(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_is_strong_prp(PyObject *self, PyObject *args);
@@ -40,6 +54,7 @@ static PyObject * GMPY_mpz_is_selfridge_prp(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_is_strongselfridge_prp(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_is_bpsw_prp(PyObject *self, PyObject *args);
 static PyObject * GMPY_mpz_is_strongbpsw_prp(PyObject *self, PyObject *args);
+static PyObject * GMPY_mpz_strong_prp_bases(PyObject *self, PyObject *args, PyObject *keywds);
 
 #ifdef __cplusplus
 }
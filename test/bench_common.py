@@ -0,0 +1,20 @@
+from __future__ import print_function
+# Helpers shared by the bench_*.py timing scripts. Each script takes an
+# optional repeat count (or size) as its only command line argument.
+
+import sys
+import timeit
+
+def get_arg(default):
+    """Return the first command line argument as a positive integer, or
+    default if it is missing or not an integer."""
+    try:
+        return abs(int(sys.argv[1]))
+    except (IndexError, ValueError):
+        return default
+
+def best_time(stmt, setup="pass", number=1, repeat=5, per=1):
+    """Return the best time, in seconds, for one execution of stmt divided
+    by per, the number of operations that stmt performs."""
+    t = min(timeit.repeat(stmt, setup, repeat=repeat, number=number))
+    return t / number / per
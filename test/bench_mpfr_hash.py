@@ -0,0 +1,32 @@
+from __future__ import print_function
+# Time hash() of new mpfr and mpc values at several precisions, for small
+# integral values and for values that use the full precision. mpfr and mpc
+# cache their hash, so the values are created fresh for each timing.
+
+from bench_common import get_arg, best_time
+
+SETUP = "\n".join([
+    "import gmpy2",
+    "from gmpy2 import mpfr, mpc",
+    "gmpy2.get_context().precision = %d",
+    "rs = gmpy2.random_state(1)",
+    "values = [%s for i in range(%d)]",
+    ])
+
+KINDS = [
+    ("integral", "mpfr(i)"),
+    ("full", "gmpy2.mpfr_random(rs)"),
+    ("mpc", "mpc(i, gmpy2.mpfr_random(rs))"),
+    ]
+
+def bench(precision, expr, count):
+    return best_time("for v in values: hash(v)",
+                     SETUP % (precision, expr, count), repeat=7, per=count)
+
+if __name__ == "__main__":
+    count = get_arg(20000)
+    print("precision" + "".join("%14s" % (k + " (ns)") for k, e in KINDS))
+    for precision in (53, 256, 1000, 10000):
+        print("%9d" % precision +
+              "".join("%14.1f" % (bench(precision, e, count) * 1e9)
+                      for k, e in KINDS))
@@ -0,0 +1,33 @@
+from __future__ import print_function
+# Compare the cost of hashing new mpq values with hashing the equivalent
+# Fraction values. mpq caches its hash, so every timing uses freshly created
+# objects and only the hash() calls are timed.
+
+import random
+import fractions
+import gmpy2
+from bench_common import get_arg, best_time
+
+def make_pairs(bits, count):
+    random.seed(bits)
+    return [(random.getrandbits(bits) - (1 << (bits - 1)),
+             random.getrandbits(bits) | 1) for i in range(count)]
+
+def bench(cls, pairs):
+    setup = "from __main__ import %s as cls, pairs\n" \
+            "values = [cls(n, d) for n, d in pairs]" % cls
+    return best_time("for v in values: hash(v)", setup, repeat=7,
+                     per=len(pairs))
+
+if __name__ == "__main__":
+    count = get_arg(20000)
+    mpq = gmpy2.mpq
+    Fraction = fractions.Fraction
+    print("bits     mpq (ns)   Fraction (ns)   ratio")
+    for bits in (16, 64, 256, 1024):
+        pairs = make_pairs(bits, count)
+        # Check that both types hash equal values identically.
+        assert all(hash(mpq(n, d)) == hash(Fraction(n, d)) for n, d in pairs[:100])
+        q = bench("mpq", pairs)
+        f = bench("Fraction", pairs)
+        print("%4d %12.1f %15.1f %7.1fx" % (bits, q * 1e9, f * 1e9, f / q))
@@ -0,0 +1,32 @@
+from __future__ import print_function
+# Time mpz operations whose results are small enough to be interned. With
+# interning enabled these return a shared object instead of allocating a new
+# mpz. Build with "setup.py build_ext --nointern" to compare.
+
+from bench_common import get_arg, best_time
+
+cases = [
+    ("mpz(0)", "mpz(0)"),
+    ("mpz(100)", "mpz(100)"),
+    ("x - x", "x - x"),
+    ("c + 1", "c + 1"),
+    ("c += 1 (x10)", "d = c\n" + "d += 1\n" * 10),
+    ("c * 3", "c * 3"),
+    ("c // 7", "c // 7"),
+    ("c % 7", "c % 7"),
+    ("sum of 100", "s = zero\nfor i in ones: s = s + i"),
+    ]
+
+setup = "\n".join([
+    "from gmpy2 import mpz",
+    "x = mpz(2)**100",
+    "c = mpz(17)",
+    "zero = mpz(0)",
+    "ones = [mpz(1)] * 100",
+    ])
+
+if __name__ == "__main__":
+    number = get_arg(200000)
+    print("operation       ns/op")
+    for name, stmt in cases:
+        print("%-12s %8.1f" % (name, best_time(stmt, setup, number) * 1e9))
@@ -0,0 +1,34 @@
+from __future__ import print_function
+# Time the probable prime tests on primes of 64 to 320 bits. Primes are the
+# worst case since every step of each test is done. The Lucas sequences for
+# moduli of up to four limbs are calculated in Montgomery form.
+
+import random
+import gmpy2
+from bench_common import get_arg, best_time
+
+def bench(name, bits, number):
+    rand = random.Random(42)
+    setup = "\n".join([
+        "import gmpy2",
+        "values = %r" % [int(gmpy2.next_prime(rand.getrandbits(bits)
+                                              | (1 << (bits - 1))))
+                         for i in range(100)],
+        "values = [gmpy2.mpz(v) for v in values]",
+        "f = gmpy2.%s" % name,
+        ])
+    if name in ("is_fermat_prp", "is_euler_prp", "is_strong_prp"):
+        stmt = "for v in values: f(v, 2)"
+    else:
+        stmt = "for v in values: f(v)"
+    return best_time(stmt, setup, number, per=100)
+
+if __name__ == "__main__":
+    number = get_arg(200)
+    names = ("is_strong_prp", "is_strong_selfridge_prp", "is_bpsw_prp",
+             "is_strong_bpsw_prp")
+    print("bits   " + "   ".join("%23s" % name for name in names) + "   (us/call)")
+    for bits in (64, 96, 128, 192, 256, 320):
+        print("%4d   " % bits +
+              "   ".join("%23.2f" % (bench(name, bits, number) * 1e6)
+                         for name in names))
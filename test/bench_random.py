@@ -0,0 +1,40 @@
+from __future__ import print_function
+# Compare drawing random numbers one call at a time with the bulk
+# mpz_urandomb_many(), mpfr_random_many() and mpfr_grandom_many() functions,
+# both into lists and into float64/uint64 buffers.
+
+from bench_common import get_arg, best_time
+
+SETUP = "\n".join([
+    "import array, gmpy2",
+    "rs = gmpy2.random_state(42)",
+    "n = %d",
+    "q = array.array('Q', [0]) * n",
+    "d = array.array('d', [0.0]) * n",
+    ])
+
+CASES = [
+    ("mpz_urandomb(64)",
+     "[gmpy2.mpz_urandomb(rs, 64) for i in range(n)]",
+     "gmpy2.mpz_urandomb_many(rs, 64, n)",
+     "gmpy2.mpz_urandomb_many(rs, 64, n, q)"),
+    ("mpfr_random",
+     "[gmpy2.mpfr_random(rs) for i in range(n)]",
+     "gmpy2.mpfr_random_many(rs, n)",
+     "gmpy2.mpfr_random_many(rs, n, d)"),
+    ("mpfr_grandom",
+     "[x for i in range(n // 2) for x in gmpy2.mpfr_grandom(rs)]",
+     "gmpy2.mpfr_grandom_many(rs, n)",
+     "gmpy2.mpfr_grandom_many(rs, n, d)"),
+    ]
+
+def bench(stmt, n, number):
+    return best_time(stmt, SETUP % n, number, per=n)
+
+if __name__ == "__main__":
+    n = get_arg(100000)
+    print("function          single (ns)   list (ns)   buffer (ns)")
+    for name, single, many, buf in CASES:
+        print("%-16s %12.1f %11.1f %13.1f"
+              % (name, bench(single, n, 3) * 1e9, bench(many, n, 3) * 1e9,
+                 bench(buf, n, 3) * 1e9))
@@ -0,0 +1,25 @@
+from __future__ import print_function
+# Time mpz operations with small Python integer operands, the most common
+# case in loops: comparisons with constants and arithmetic such as x + 1.
+# Small integers (a single PyLong digit) take a fast path in the mpz slots.
+
+from bench_common import get_arg, best_time
+
+SETUP = "from gmpy2 import mpz; x = mpz(%s)"
+
+CASES = [
+    "x < 0", "x == 1", "0 < x",
+    "x + 1", "1 + x", "x - 1", "1 - x",
+    "x * 3", "3 * x", "x // 7", "x % 7", "7 // x", "7 % x",
+    ]
+
+def bench(stmt, value, number):
+    return best_time(stmt, SETUP % value, number)
+
+if __name__ == "__main__":
+    number = get_arg(1000000)
+    values = ("12345", "2**100 + 1")
+    print("operation   " + "".join("%18s" % ("x=" + v + " (ns)") for v in values))
+    for stmt in CASES:
+        print("%-10s" % stmt +
+              "".join("%18.1f" % (bench(stmt, v, number) * 1e9) for v in values))
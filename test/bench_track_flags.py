@@ -0,0 +1,29 @@
+from __future__ import print_function
+# Compare the cost of mpfr arithmetic with and without exception flag
+# tracking. Setting context.track_flags to False skips clearing and merging
+# the MPFR exception flags when no traps are enabled.
+
+import gmpy2
+from bench_common import get_arg, best_time
+
+def bench(precision, track_flags, number):
+    setup = "\n".join([
+        "import gmpy2",
+        "gmpy2.set_context(gmpy2.context(precision=%d, track_flags=%s))"
+            % (precision, track_flags),
+        "x = gmpy2.mpfr(1) / 3",
+        "y = gmpy2.sqrt(gmpy2.mpfr(2))",
+        ])
+    stmt = "x + y; x - y; x * y; x / y; gmpy2.sqrt(x)"
+    return best_time(stmt, setup, number, per=5)
+
+if __name__ == "__main__":
+    number = get_arg(200000)
+    saved = gmpy2.get_context().copy()
+    print("precision   tracked (ns/op)   untracked (ns/op)   saving")
+    for precision in (53, 64, 113, 128, 256):
+        on = bench(precision, True, number)
+        off = bench(precision, False, number)
+        print("%9d   %15.1f   %17.1f   %5.1f%%"
+              % (precision, on * 1e9, off * 1e9, 100.0 * (on - off) / on))
+    gmpy2.set_context(saved)
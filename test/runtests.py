@@ -4,6 +4,7 @@ import sys
 import os
 import glob
 import doctest
+import pickle
 import gmpy2
 
 # *****************************************************************************
@@ -95,6 +96,12 @@ for test in sorted(all_doctests):
         continue
     if test.endswith("py3.txt") and sys.version < "3":
         continue
+    if test.endswith("pickle5.txt") and pickle.HIGHEST_PROTOCOL < 5:
+        continue
+    if "_contextvars" in test and not getattr(gmpy2, "HAVE_CONTEXTVARS", False):
+        continue
+    if "_mpz_intern_identity" in test and not getattr(gmpy2, "MPZ_INTERN", None):
+        continue
     for r in range(repeat):
         result = doctest.testfile(test, globs=globals(),
                                   optionflags=doctest.IGNORE_EXCEPTION_DETAIL |